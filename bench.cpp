@@ -0,0 +1,745 @@
+
+// g++ -std=c++17 -pedantic -Wall -O3 -flto -DNDEBUG
+// bench.cpp -obench
+
+// ./bench [num. tuples per test]
+
+// Throughput and per-stage hit rates for each predicate
+// over a set of input distributions. Stage fractions are
+// taken from the kernel_stats counters, so these report
+// zero if compiled with -DNO_KERNEL_COUNTERS.
+
+// Then the cost and accuracy of qd_flt vs. dd_flt and the
+// (exact) expansion<N> equivalents, for a 3 x 3 det. and
+// an E^2 power centre on near-collinear input, and the
+// SoA orient-kd_batch calls vs. the scalar predicates.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "geompred.hpp"
+
+/*-------------------------------- predicate descriptions */
+
+    enum _kind { ORIENT, BISECT, INBALL } ;
+
+    struct bench_pred
+    {
+        char const     *_name ;
+        int             _np ;   // num. points per tuple
+        int             _nd ;   // num. geometric dims.
+        _kind           _kd ;
+    } ;
+
+    bench_pred const _pred [] = {
+        { "orient2d", 3, 2, ORIENT } ,
+        { "bisect2d", 3, 2, BISECT } ,
+        { "bisect2w", 3, 2, BISECT } ,
+        { "inball2d", 4, 2, INBALL } ,
+        { "inball2w", 4, 2, INBALL } ,
+        { "orient3d", 4, 3, ORIENT } ,
+        { "bisect3d", 3, 3, BISECT } ,
+        { "bisect3w", 3, 3, BISECT } ,
+        { "inball3d", 5, 3, INBALL } ,
+        { "inball3w", 5, 3, INBALL } ,
+        { "orient4d", 5, 4, ORIENT } ,
+        { "inball4d", 6, 4, INBALL } ,
+        { "inball4w", 6, 4, INBALL } ,
+        } ;
+
+    int const _pred_size =
+        sizeof(_pred) / sizeof(_pred[0]) ;
+
+    int const _stride = +5 ;    // (x,y,z,t,w) per point
+
+    double volatile _sink ;
+
+    double call_pred (
+        int _id, double const *_pp
+        )
+    {
+    /*-------------------------------- dispatch to geompred */
+        double const *_p0 = _pp + _stride * 0 ;
+        double const *_p1 = _pp + _stride * 1 ;
+        double const *_p2 = _pp + _stride * 2 ;
+        double const *_p3 = _pp + _stride * 3 ;
+        double const *_p4 = _pp + _stride * 4 ;
+        double const *_p5 = _pp + _stride * 5 ;
+
+        switch (_id)
+        {
+        case 0: return geompred::orient2d(_p0, _p1, _p2) ;
+        case 1: return geompred::bisect2d(_p0, _p1, _p2) ;
+        case 2: return geompred::bisect2w(_p0, _p1, _p2) ;
+        case 3: return geompred::inball2d(
+                    _p0, _p1, _p2, _p3) ;
+        case 4: return geompred::inball2w(
+                    _p0, _p1, _p2, _p3) ;
+        case 5: return geompred::orient3d(
+                    _p0, _p1, _p2, _p3) ;
+        case 6: return geompred::bisect3d(_p0, _p1, _p2) ;
+        case 7: return geompred::bisect3w(_p0, _p1, _p2) ;
+        case 8: return geompred::inball3d(
+                    _p0, _p1, _p2, _p3, _p4) ;
+        case 9: return geompred::inball3w(
+                    _p0, _p1, _p2, _p3, _p4) ;
+        case 10: return geompred::orient4d(
+                    _p0, _p1, _p2, _p3, _p4) ;
+        case 11: return geompred::inball4d(
+                    _p0, _p1, _p2, _p3, _p4, _p5) ;
+        case 12: return geompred::inball4w(
+                    _p0, _p1, _p2, _p3, _p4, _p5) ;
+        }
+
+        return +0.0 ;
+    }
+
+/*-------------------------------- input distributions    */
+
+    typedef std::mt19937_64 rand_gen ;
+
+    double rand_01 (
+        rand_gen &_rg
+        )
+    {   return std::uniform_real_distribution<double>(
+            +0.0, +1.0) (_rg) ;
+    }
+
+    void make_rand (            // uniform in [0,1]^d
+        bench_pred const& _bp, std::vector<double> &_pp,
+        size_t _nn, rand_gen &_rg
+        )
+    {
+        for (size_t _ii = 0; _ii < _nn * _bp._np; ++_ii)
+        {
+            double *_px = &_pp[_ii * _stride] ;
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                _px[_kk] = rand_01(_rg) ;
+
+            _px[_bp._nd] = rand_01(_rg) * 0.1 ;
+        }
+    }
+
+    void make_huge (            // 2^20 + [0,1]^d
+        bench_pred const& _bp, std::vector<double> &_pp,
+        size_t _nn, rand_gen &_rg
+        )
+    {
+        make_rand(_bp, _pp, _nn, _rg) ;
+
+        for (size_t _ii = 0; _ii < _nn * _bp._np; ++_ii)
+        {
+            double *_px = &_pp[_ii * _stride] ;
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                _px[_kk] += 1048576.0 ;
+        }
+    }
+
+    void make_grid (            // on 8^d lattice
+        bench_pred const& _bp, std::vector<double> &_pp,
+        size_t _nn, rand_gen &_rg
+        )
+    {
+        std::uniform_int_distribution<int> _ig(0, 7) ;
+
+        for (size_t _ii = 0; _ii < _nn * _bp._np; ++_ii)
+        {
+            double *_px = &_pp[_ii * _stride] ;
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                _px[_kk] = _ig(_rg) / 8.0 ;
+
+            _px[_bp._nd] = _ig(_rg) / 64.0 ;
+        }
+    }
+
+    void make_near (            // degenerate, up to round-off
+        bench_pred const& _bp, std::vector<double> &_pp,
+        size_t _nn, rand_gen &_rg
+        )
+    {
+        std::normal_distribution<double> _ng(0., 1.) ;
+
+        for (size_t _ii = 0; _ii < _nn; ++_ii)
+        {
+            double *_pt = &_pp[_ii * _bp._np * _stride] ;
+
+            for (int _jj = 0; _jj < _bp._np; ++_jj)
+            for (int _kk = 0; _kk < _stride; ++_kk)
+                _pt[_jj * _stride + _kk] = +0.0 ;
+
+            if (_bp._kd == ORIENT)
+            {
+        /*------------ last point in span of the others */
+            int _nl = _bp._np - 1 ;
+            for (int _jj = 0; _jj < _nl; ++_jj)
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                _pt[_jj * _stride + _kk] = rand_01(_rg) ;
+
+            double *_pq = _pt + _nl * _stride ;
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                _pq[_kk] = _pt[_kk] ;
+
+            for (int _jj = 1; _jj < _nl; ++_jj)
+            {
+                double _tt = rand_01(_rg) ;
+                for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                    _pq[_kk] += _tt * (
+                        _pt[_jj * _stride + _kk] -
+                        _pt[_kk]) ;
+            }
+            }
+            else
+            if (_bp._kd == BISECT)
+            {
+        /*------------ query on the bisector of (a, b)  */
+            double *_pa = _pt + _stride * 0 ;
+            double *_pb = _pt + _stride * 1 ;
+            double *_pq = _pt + _stride * 2 ;
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+            {
+                _pa[_kk] = rand_01(_rg) ;
+                _pb[_kk] = rand_01(_rg) ;
+            }
+
+            double _ab[3], _rr[3], _nv[3] ;
+            for (int _kk = 0; _kk < 3; ++_kk)
+            {
+                _ab[_kk] = _pb[_kk] - _pa[_kk] ;
+                _rr[_kk] = rand_01(_rg) ;
+            }
+
+            if (_bp._nd == 2)
+            {
+                _nv[0] = -_ab[1] ;
+                _nv[1] = +_ab[0] ;
+            }
+            else
+            {
+                _nv[0] = _ab[1] * _rr[2] - _ab[2] * _rr[1] ;
+                _nv[1] = _ab[2] * _rr[0] - _ab[0] * _rr[2] ;
+                _nv[2] = _ab[0] * _rr[1] - _ab[1] * _rr[0] ;
+            }
+
+            double _tt = rand_01(_rg) - 0.5 ;
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                _pq[_kk] = (_pa[_kk] + _pb[_kk]) * .5
+                         + _tt * _nv[_kk] ;
+            }
+            else
+            {
+        /*------------ all points on a common sphere    */
+            double _pc[4] ;
+            for (int _kk = 0; _kk < 4; ++_kk)
+                _pc[_kk] = rand_01(_rg) ;
+
+            for (int _jj = 0; _jj < _bp._np; ++_jj)
+            {
+                double _uu[4], _ll = 0.0 ;
+                for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                {
+                    _uu[_kk] = _ng(_rg) ;
+                    _ll += _uu[_kk] * _uu[_kk] ;
+                }
+                _ll = 0.5 / std::sqrt(_ll) ;
+
+                for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                    _pt[_jj * _stride + _kk] =
+                        _pc[_kk] + _ll * _uu[_kk] ;
+            }
+            }
+        }
+    }
+
+    typedef void (*make_func) (
+        bench_pred const&, std::vector<double> &,
+        size_t, rand_gen &) ;
+
+    struct bench_dist
+    {
+        char const     *_name ;
+        make_func       _make ;
+    } ;
+
+    bench_dist const _dist [] = {
+        { "random", make_rand } ,
+        { "grid"  , make_grid } ,
+        { "near"  , make_near } ,
+        { "huge"  , make_huge } ,
+        } ;
+
+    int const _dist_size =
+        sizeof(_dist) / sizeof(_dist[0]) ;
+
+/*-------------------------------- stage sums over kernels */
+
+    int const _kern_f [] = {
+        geompred::ORIENT2D_f, geompred::ORIENT3D_f,
+        geompred::BISECT2D_f, geompred::BISECT2W_f,
+        geompred::BISECT3D_f, geompred::BISECT3W_f,
+        geompred::INBALL2D_f, geompred::INBALL2W_f,
+        geompred::INBALL3D_f, geompred::INBALL3W_f,
+        geompred::ORIENT4D_f,
+        geompred::INBALL4D_f, geompred::INBALL4W_f } ;
+    int const _kern_i [] = {
+        geompred::ORIENT2D_i, geompred::ORIENT3D_i,
+        geompred::BISECT2D_i, geompred::BISECT2W_i,
+        geompred::BISECT3D_i, geompred::BISECT3W_i,
+        geompred::INBALL2D_i, geompred::INBALL2W_i,
+        geompred::INBALL3D_i, geompred::INBALL3W_i,
+        geompred::ORIENT4D_i,
+        geompred::INBALL4D_i, geompred::INBALL4W_i } ;
+    int const _kern_e [] = {
+        geompred::ORIENT2D_e, geompred::ORIENT3D_e,
+        geompred::BISECT2D_e, geompred::BISECT2W_e,
+        geompred::BISECT3D_e, geompred::BISECT3W_e,
+        geompred::INBALL2D_e, geompred::INBALL2W_e,
+        geompred::INBALL3D_e, geompred::INBALL3W_e,
+        geompred::ORIENT4D_e,
+        geompred::INBALL4D_e, geompred::INBALL4W_e } ;
+    int const _kern_d [] = {
+        geompred::ORIENT2D_d, geompred::ORIENT3D_d,
+        geompred::BISECT2D_d, geompred::BISECT2W_d,
+        geompred::BISECT3D_d, geompred::BISECT3W_d,
+        geompred::INBALL2D_d, geompred::INBALL2W_d,
+        geompred::INBALL3D_d, geompred::INBALL3W_d,
+        geompred::ORIENT4D_d,
+        geompred::INBALL4D_d, geompred::INBALL4W_d } ;
+    int const _kern_a [] = {
+        geompred::INBALL3D_a, geompred::ORIENT4D_a,
+        geompred::INBALL4D_a, geompred::INBALL4W_a } ;
+
+    template <size_t N>
+    size_t sum_kern (
+        geompred::kernel_counts const& _cc, int const (&_kk) [N]
+        )
+    {
+        size_t _ss = +0 ;
+        for (size_t _ii = 0; _ii < N; ++_ii)
+            _ss += _cc[_kk[_ii]] ;
+        return _ss ;
+    }
+
+/*-------------------------------- qd_flt vs. expansion<N> */
+
+    // E^2 power centre of weighted pts. (a, b, c), taken
+    // relative to a, as in the "construction" use-case.
+
+    void pcen_qd (
+        double const *_pa, double const *_pb,
+        double const *_pc, double *_oo
+        )
+    {
+        qd_flt _bx, _by, _cx, _cy, _wb, _wc ;
+        _bx.from_sub(_pb[0], _pa[0]) ;
+        _by.from_sub(_pb[1], _pa[1]) ;
+        _cx.from_sub(_pc[0], _pa[0]) ;
+        _cy.from_sub(_pc[1], _pa[1]) ;
+        _wb.from_sub(_pb[2], _pa[2]) ;
+        _wc.from_sub(_pc[2], _pa[2]) ;
+
+        qd_flt _lb = _bx * _bx + _by * _by - _wb ;
+        qd_flt _lc = _cx * _cx + _cy * _cy - _wc ;
+
+        qd_flt _dd = (_bx * _cy - _by * _cx) * 2. ;
+
+        _oo[0] = (double) ((_lb * _cy - _lc * _by) / _dd) ;
+        _oo[1] = (double) ((_bx * _lc - _cx * _lb) / _dd) ;
+    }
+
+    void pcen_dd (
+        double const *_pa, double const *_pb,
+        double const *_pc, double *_oo
+        )
+    {
+        dd_flt _bx, _by, _cx, _cy, _wb, _wc ;
+        _bx.from_sub(_pb[0], _pa[0]) ;
+        _by.from_sub(_pb[1], _pa[1]) ;
+        _cx.from_sub(_pc[0], _pa[0]) ;
+        _cy.from_sub(_pc[1], _pa[1]) ;
+        _wb.from_sub(_pb[2], _pa[2]) ;
+        _wc.from_sub(_pc[2], _pa[2]) ;
+
+        dd_flt _lb = _bx * _bx + _by * _by - _wb ;
+        dd_flt _lc = _cx * _cx + _cy * _cy - _wc ;
+
+        dd_flt _dd = (_bx * _cy - _by * _cx) * 2. ;
+
+        _oo[0] = (_lb * _cy - _lc * _by).hi() / _dd.hi() ;
+        _oo[1] = (_bx * _lc - _cx * _lb).hi() / _dd.hi() ;
+    }
+
+    void pcen_mp (
+        double const *_pa, double const *_pb,
+        double const *_pc, double *_oo
+        )
+    {
+        namespace mp = mp_float ;
+
+        mp::expansion< 2> _bx, _by, _cx, _cy, _wb, _wc ;
+        _bx.from_sub(_pb[0], _pa[0]) ;
+        _by.from_sub(_pb[1], _pa[1]) ;
+        _cx.from_sub(_pc[0], _pa[0]) ;
+        _cy.from_sub(_pc[1], _pa[1]) ;
+        _wb.from_sub(_pb[2], _pa[2]) ;
+        _wc.from_sub(_pc[2], _pa[2]) ;
+
+        mp::expansion< 8> _xb, _yb, _xc, _yc ;
+        mp::expansion_mul(_bx, _bx, _xb) ;
+        mp::expansion_mul(_by, _by, _yb) ;
+        mp::expansion_mul(_cx, _cx, _xc) ;
+        mp::expansion_mul(_cy, _cy, _yc) ;
+
+        mp::expansion<16> _sb, _sc ;
+        mp::expansion_add(_xb, _yb, _sb) ;
+        mp::expansion_add(_xc, _yc, _sc) ;
+
+        mp::expansion<18> _lb, _lc ;
+        mp::expansion_sub(_sb, _wb, _lb) ;
+        mp::expansion_sub(_sc, _wc, _lc) ;
+
+        mp::expansion<72> _t1, _t2, _t3, _t4 ;
+        mp::expansion_mul(_lb, _cy, _t1) ;
+        mp::expansion_mul(_lc, _by, _t2) ;
+        mp::expansion_mul(_lc, _bx, _t3) ;
+        mp::expansion_mul(_lb, _cx, _t4) ;
+
+        mp::expansion<144> _nx, _ny ;
+        mp::expansion_sub(_t1, _t2, _nx) ;
+        mp::expansion_sub(_t3, _t4, _ny) ;
+
+        mp::expansion< 8> _d1, _d2 ;
+        mp::expansion_mul(_bx, _cy, _d1) ;
+        mp::expansion_mul(_by, _cx, _d2) ;
+
+        mp::expansion<16> _dd ;
+        mp::expansion_sub(_d1, _d2, _dd) ;
+
+        double _de = 2. * mp::expansion_est(_dd) ;
+
+        _oo[0] = mp::expansion_est(_nx) / _de ;
+        _oo[1] = mp::expansion_est(_ny) / _de ;
+    }
+
+    // 3 x 3 determinant of double entries, row-major.
+
+    double det3_qd (
+        double const *_mm
+        )
+    {
+        qd_flt _aa[9] ;
+        for (int _ii = 0; _ii < 9; ++_ii)
+            _aa[_ii] = _mm[_ii] ;
+
+        return (double) (
+          _aa[0] * (_aa[4] * _aa[8] - _aa[5] * _aa[7])
+        - _aa[1] * (_aa[3] * _aa[8] - _aa[5] * _aa[6])
+        + _aa[2] * (_aa[3] * _aa[7] - _aa[4] * _aa[6])) ;
+    }
+
+    double det3_mp (
+        double const *_mm
+        )
+    {
+        namespace mp = mp_float ;
+
+        mp::expansion< 2> _pp[6] ;
+        _pp[0].from_mul(_mm[4], _mm[8]) ;
+        _pp[1].from_mul(_mm[5], _mm[7]) ;
+        _pp[2].from_mul(_mm[3], _mm[8]) ;
+        _pp[3].from_mul(_mm[5], _mm[6]) ;
+        _pp[4].from_mul(_mm[3], _mm[7]) ;
+        _pp[5].from_mul(_mm[4], _mm[6]) ;
+
+        mp::expansion< 4> _q0, _q1, _q2 ;
+        mp::expansion_sub(_pp[0], _pp[1], _q0) ;
+        mp::expansion_sub(_pp[2], _pp[3], _q1) ;
+        mp::expansion_sub(_pp[4], _pp[5], _q2) ;
+
+        mp::expansion< 8> _r0, _r1, _r2 ;
+        mp::expansion_mul(_q0, _mm[0], _r0) ;
+        mp::expansion_mul(_q1, _mm[1], _r1) ;
+        mp::expansion_mul(_q2, _mm[2], _r2) ;
+
+        mp::expansion<16> _s0 ;
+        mp::expansion_sub(_r0, _r1, _s0) ;
+
+        mp::expansion<24> _s1 ;
+        mp::expansion_add(_s0, _r2, _s1) ;
+
+        return mp::expansion_est(_s1) ;
+    }
+
+    template <
+        typename    func_type
+             >
+    double time_loop (          // ns/call, repeat to >= 50ms
+        size_t _nn, func_type _func
+        )
+    {
+        for (size_t _ii = 0; _ii < _nn; ++_ii) _func(_ii) ;
+
+        auto _t0 = std::chrono::steady_clock::now() ;
+        auto _t1 = _t0 ;
+
+        size_t _nr = +0 ;
+        do {
+            for (size_t _ii = 0; _ii < _nn; ++_ii)
+                _func(_ii) ;
+
+            _nr += +1 ;
+            _t1  = std::chrono::steady_clock::now() ;
+        }
+        while (_t1 - _t0 < std::chrono::milliseconds(50)) ;
+
+        return std::chrono::duration<double,
+            std::nano>(_t1 - _t0).count() / (_nn * _nr) ;
+    }
+
+    void bench_qd (
+        size_t _nn
+        )
+    {
+    /*---------------- c near line (a, b): cancellation */
+        rand_gen _rg(7654321) ;
+
+        std::vector<double> _pp(_nn * 9) ;
+        for (auto &_px : _pp) _px = rand_01(_rg) ;
+
+        for (size_t _ii = 0; _ii < _nn; ++_ii)
+        {
+            double *_pt = &_pp[_ii * 9] ;
+            double  _tt = rand_01(_rg) ;
+            _pt[6] = _pt[0] + _tt * (_pt[3] - _pt[0]) ;
+            _pt[7] = _pt[1] + _tt * (_pt[4] - _pt[1]) ;
+            _pt[2] *= .01 ; _pt[5] *= .01 ; _pt[8] *= .01 ;
+        }
+
+    /*---------------- max. rel. error vs. expansions   */
+        double _eq = 0., _ed = 0., _ss = 0. ;
+        for (size_t _ii = 0; _ii < _nn; ++_ii)
+        {
+            double const *_pt = &_pp[_ii * 9] ;
+            double _om[2], _oq[2], _od[2] ;
+            pcen_mp(_pt, _pt + 3, _pt + 6, _om) ;
+            pcen_qd(_pt, _pt + 3, _pt + 6, _oq) ;
+            pcen_dd(_pt, _pt + 3, _pt + 6, _od) ;
+
+            _eq = std::max(_eq,
+                std::abs(_oq[0] - _om[0]) / std::abs(_om[0])) ;
+            _ed = std::max(_ed,
+                std::abs(_od[0] - _om[0]) / std::abs(_om[0])) ;
+        }
+
+        std::printf("\n%-20s %10s %10s\n",
+            "construction", "ns/call", "rel.err") ;
+
+        auto _pcen = [&](auto _func)
+        {
+            return time_loop(_nn, [&](size_t _ii)
+            {
+                double const *_pt = &_pp[_ii * 9] ;
+                double _oo[2] ;
+                _func(_pt, _pt + 3, _pt + 6, _oo) ;
+                _ss += _oo[0] ;
+            } ) ;
+        } ;
+
+        std::printf("%-20s %10.2f %10.2g\n", "pcen2w dd_flt",
+            _pcen(pcen_dd), _ed) ;
+        std::printf("%-20s %10.2f %10.2g\n", "pcen2w qd_flt",
+            _pcen(pcen_qd), _eq) ;
+        std::printf("%-20s %10.2f %10s\n", "pcen2w expansion",
+            _pcen(pcen_mp), "exact") ;
+
+        auto _det3 = [&](auto _func)
+        {
+            return time_loop(_nn, [&](size_t _ii)
+            {
+                _ss += _func(&_pp[_ii * 9]) ;
+            } ) ;
+        } ;
+
+        std::printf("%-20s %10.2f\n", "det3 qd_flt",
+            _det3(det3_qd)) ;
+        std::printf("%-20s %10.2f\n", "det3 expansion",
+            _det3(det3_mp)) ;
+
+        _sink = _ss ;
+    }
+
+/*-------------------------------- batch vs. scalar calls */
+
+    void bench_batch (
+        size_t _nn
+        )
+    {
+    // orient2d/3d over SoA buffers: one scalar call per
+    // tuple vs. one orient-kd_batch call over all of them,
+    // for random input, and for "near" input where all
+    // lanes fail the filter and take the scalar tail.
+        rand_gen _rg(2345678) ;
+
+        std::vector<double> _xx(_nn * 12), _rr(_nn) ;
+
+        std::printf("\n%-20s %10s %10s %8s\n",
+            "batch", "scalar", "batched", "speedup") ;
+
+        for (int _in = 0; _in < 2; ++_in)
+        for (int _nd = 2; _nd <= 3; ++_nd)
+        {
+            int _np = _nd + 1, _nc = _nd * _np ;
+
+            for (auto &_px : _xx) _px = rand_01(_rg) ;
+
+            if (_in == 1)               // last pt. in span
+            for (size_t _ii = 0; _ii < _nn; ++_ii)
+            {
+                double _t1 = rand_01(_rg), _t2 = rand_01(_rg) ;
+                for (int _kk = 0; _kk < _nd; ++_kk)
+                {
+                    double *_pa = &_xx[(0 * _nd + _kk) * _nn] ;
+                    double *_pb = &_xx[(1 * _nd + _kk) * _nn] ;
+                    double *_pc = &_xx[(2 * _nd + _kk) * _nn] ;
+                    double *_pq =
+                        &_xx[((_np - 1) * _nd + _kk) * _nn] ;
+
+                    _pq[_ii] = _pa[_ii]
+                        + _t1 * (_pb[_ii] - _pa[_ii])
+                        + (_nd == 3 ?
+                           _t2 * (_pc[_ii] - _pa[_ii]) : 0.) ;
+                }
+            }
+
+            double const *_cc[12] ;     // SoA coord. lanes
+            for (int _kk = 0; _kk < _nc; ++_kk)
+                _cc[_kk] = &_xx[_kk * _nn] ;
+
+            double _ts = time_loop(_nn, [&](size_t _ii)
+            {
+                double _pp[4][3] ;
+                for (int _jj = 0; _jj < _np; ++_jj)
+                for (int _kk = 0; _kk < _nd; ++_kk)
+                    _pp[_jj][_kk] = _cc[_jj * _nd + _kk][_ii] ;
+
+                _rr[_ii] = _nd == 2 ?
+                    geompred::orient2d(
+                        _pp[0], _pp[1], _pp[2]) :
+                    geompred::orient3d(
+                        _pp[0], _pp[1], _pp[2], _pp[3]) ;
+            } ) ;
+
+            double _tb = time_loop(1, [&](size_t)
+            {
+                if (_nd == 2)
+                geompred::orient2d_batch(_nn,
+                    _cc[0], _cc[1], _cc[2], _cc[3],
+                    _cc[4], _cc[5], _rr.data()) ;
+                else
+                geompred::orient3d_batch(_nn,
+                    _cc[0], _cc[1], _cc[2],
+                    _cc[3], _cc[4], _cc[5],
+                    _cc[6], _cc[7], _cc[8],
+                    _cc[9], _cc[10], _cc[11], _rr.data()) ;
+            } ) / _nn ;
+
+            char _name[32] ;
+            std::snprintf(_name, sizeof(_name), "orient%dd %s",
+                _nd, _in == 0 ? "random" : "near") ;
+
+            std::printf("%-20s %10.2f %10.2f %8.2f\n",
+                _name, _ts, _tb, _ts / _tb) ;
+
+            _sink = _rr[_nn / 2] ;
+        }
+    }
+
+int main (
+    int _argc, char **_argv
+    ) {
+
+    size_t _nn = _argc > 1 ?
+        std::strtoul(_argv[1], nullptr, 10) : 1 << 15 ;
+
+    if (_nn == 0) _nn = +1 ;
+
+    std::printf("%-9s %-7s %10s %8s %8s %8s %8s %8s\n",
+        "predicate", "inputs", "ns/call",
+        "float%", "inter%", "ddflt%", "adapt%", "exact%") ;
+
+    for (int _ip = 0; _ip < _pred_size; ++_ip)
+    for (int _id = 0; _id < _dist_size; ++_id)
+    {
+        bench_pred const& _bp = _pred[_ip] ;
+
+        rand_gen _rg(1234567 + 31 * _ip + _id) ;
+
+        std::vector<double> _pp(
+            _nn * _bp._np * _stride, 0.0) ;
+
+        _dist[_id]._make(_bp, _pp, _nn, _rg) ;
+
+    /*---------------- warm-up, then repeat to >= 50ms */
+        double _ss = 0.0 ;
+        for (size_t _ii = 0; _ii < _nn; ++_ii)
+            _ss += call_pred(_ip,
+                &_pp[_ii * _bp._np * _stride]) ;
+
+        geompred::kernel_stats::reset() ;
+
+        auto _t0 = std::chrono::steady_clock::now() ;
+        auto _t1 = _t0 ;
+
+        size_t _nr = +0 ;
+        do {
+            for (size_t _ii = 0; _ii < _nn; ++_ii)
+                _ss += call_pred(_ip,
+                    &_pp[_ii * _bp._np * _stride]) ;
+
+            _nr += +1 ;
+            _t1  = std::chrono::steady_clock::now() ;
+        }
+        while (_t1 - _t0 < std::chrono::milliseconds(50)) ;
+
+        geompred::kernel_counts _cc =
+            geompred::kernel_stats::snapshot() ;
+
+    /*---------------- ns/call and fraction at each stage */
+        double _tt = std::chrono::duration<double,
+            std::nano>(_t1 - _t0).count() ;
+
+        double _nc = (double) (_nn * _nr) ;
+
+        double _fi = (double) sum_kern(_cc, _kern_f) ;
+        double _in = (double) sum_kern(_cc, _kern_i) ;
+        double _dd = (double) sum_kern(_cc, _kern_d) ;
+        double _ad = (double) sum_kern(_cc, _kern_a) ;
+        double _ex = (double) sum_kern(_cc, _kern_e) ;
+
+        if (_fi <= 0.0) _fi = 1.0 ;
+
+        std::printf(
+            "%-9s %-7s %10.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+            _bp._name, _dist[_id]._name, _tt / _nc,
+            100. * (_fi - _in) / _fi,
+            100. * _in / _fi,
+            100. * _dd / _fi,
+            100. * _ad / _fi,
+            100. * _ex / _fi) ;
+
+        _sink = _ss ;           // keep the calls live
+    }
+
+    bench_qd(_nn) ;
+
+    bench_batch(_nn) ;
+
+    return 0 ;
+}
+
+
+
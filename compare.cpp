@@ -0,0 +1,321 @@
+
+// gcc -O3 -c predicates.c -opredicates.o
+// g++ -std=c++17 -pedantic -Wall -O3 -DNDEBUG
+// compare.cpp predicates.o -ocompare
+
+// ./compare [num. tuples per test]
+
+// Side-by-side timing of geompred::orient2d, orient3d,
+// inball2d, inball3d vs. the original orient2d, orient3d,
+// incircle, insphere routines from J. R. Shewchuk's
+// predicates.c, on identical input streams. The signs of
+// the two are cross-checked for every tuple.
+
+// predicates.c is not distributed here: ./compare.sh
+// fetches it from https://www.cs.cmu.edu/~quake/robust.html
+// into the tree, builds as above and runs the comparison.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "geompred.hpp"
+
+/*-------------------------------- shewchuk's predicates.c */
+
+extern "C" {
+    void   exactinit (void) ;
+    double orient2d  (double *, double *, double *) ;
+    double orient3d  (double *, double *, double *,
+                      double *) ;
+    double incircle  (double *, double *, double *,
+                      double *) ;
+    double insphere  (double *, double *, double *,
+                      double *, double *) ;
+}
+
+/*-------------------------------- predicate descriptions */
+
+    struct bench_pred
+    {
+        char const     *_name ;
+        int             _np ;   // num. points per tuple
+        int             _nd ;   // num. geometric dims.
+    } ;
+
+    bench_pred const _pred [] = {
+        { "orient2d", 3, 2 } ,
+        { "orient3d", 4, 3 } ,
+        { "inball2d", 4, 2 } ,
+        { "inball3d", 5, 3 } ,
+        } ;
+
+    int const _pred_size =
+        sizeof(_pred) / sizeof(_pred[0]) ;
+
+    int const _stride = +4 ;    // (x,y,z,w) per point
+
+    double volatile _sink ;
+
+    double call_geompred (
+        int _id, double *_pp
+        )
+    {
+        double *_p0 = _pp + _stride * 0 ;
+        double *_p1 = _pp + _stride * 1 ;
+        double *_p2 = _pp + _stride * 2 ;
+        double *_p3 = _pp + _stride * 3 ;
+        double *_p4 = _pp + _stride * 4 ;
+
+        switch (_id)
+        {
+        case 0: return geompred::orient2d(
+                    _p0, _p1, _p2) ;
+        case 1: return geompred::orient3d(
+                    _p0, _p1, _p2, _p3) ;
+        case 2: return geompred::inball2d(
+                    _p0, _p1, _p2, _p3) ;
+        case 3: return geompred::inball3d(
+                    _p0, _p1, _p2, _p3, _p4) ;
+        }
+
+        return +0.0 ;
+    }
+
+    double call_shewchuk (
+        int _id, double *_pp
+        )
+    {
+        double *_p0 = _pp + _stride * 0 ;
+        double *_p1 = _pp + _stride * 1 ;
+        double *_p2 = _pp + _stride * 2 ;
+        double *_p3 = _pp + _stride * 3 ;
+        double *_p4 = _pp + _stride * 4 ;
+
+        switch (_id)
+        {
+        case 0: return ::orient2d(
+                    _p0, _p1, _p2) ;
+        case 1: return ::orient3d(
+                    _p0, _p1, _p2, _p3) ;
+        case 2: return ::incircle(
+                    _p0, _p1, _p2, _p3) ;
+        case 3: return ::insphere(
+                    _p0, _p1, _p2, _p3, _p4) ;
+        }
+
+        return +0.0 ;
+    }
+
+/*-------------------------------- input distributions    */
+
+    typedef std::mt19937_64 rand_gen ;
+
+    double rand_01 (
+        rand_gen &_rg
+        )
+    {   return std::uniform_real_distribution<double>(
+            +0.0, +1.0) (_rg) ;
+    }
+
+    void make_rand (            // uniform in [0,1]^d
+        bench_pred const& _bp, std::vector<double> &_pp,
+        size_t _nn, rand_gen &_rg
+        )
+    {
+        for (size_t _ii = 0; _ii < _nn * _bp._np; ++_ii)
+        for (int _kk = 0; _kk < _bp._nd; ++_kk)
+            _pp[_ii * _stride + _kk] = rand_01(_rg) ;
+    }
+
+    void make_grid (            // on 8^d lattice
+        bench_pred const& _bp, std::vector<double> &_pp,
+        size_t _nn, rand_gen &_rg
+        )
+    {
+        std::uniform_int_distribution<int> _ig(0, 7) ;
+
+        for (size_t _ii = 0; _ii < _nn * _bp._np; ++_ii)
+        for (int _kk = 0; _kk < _bp._nd; ++_kk)
+            _pp[_ii * _stride + _kk] = _ig(_rg) / 8.0 ;
+    }
+
+    void make_near (            // degenerate, up to round-off
+        bench_pred const& _bp, std::vector<double> &_pp,
+        size_t _nn, rand_gen &_rg
+        )
+    {
+        std::normal_distribution<double> _ng(0., 1.) ;
+
+        bool _on_sphere = _bp._np == _bp._nd + 2 ;
+
+        for (size_t _ii = 0; _ii < _nn; ++_ii)
+        {
+            double *_pt = &_pp[_ii * _bp._np * _stride] ;
+
+            if (!_on_sphere)
+            {
+        /*------------ last point in span of the others */
+            int _nl = _bp._np - 1 ;
+            for (int _jj = 0; _jj < _nl; ++_jj)
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                _pt[_jj * _stride + _kk] = rand_01(_rg) ;
+
+            double *_pq = _pt + _nl * _stride ;
+            for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                _pq[_kk] = _pt[_kk] ;
+
+            for (int _jj = 1; _jj < _nl; ++_jj)
+            {
+                double _tt = rand_01(_rg) ;
+                for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                    _pq[_kk] += _tt * (
+                        _pt[_jj * _stride + _kk] -
+                        _pt[_kk]) ;
+            }
+            }
+            else
+            {
+        /*------------ all points on a common sphere    */
+            double _pc[3] ;
+            for (int _kk = 0; _kk < 3; ++_kk)
+                _pc[_kk] = rand_01(_rg) ;
+
+            for (int _jj = 0; _jj < _bp._np; ++_jj)
+            {
+                double _uu[3], _ll = 0.0 ;
+                for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                {
+                    _uu[_kk] = _ng(_rg) ;
+                    _ll += _uu[_kk] * _uu[_kk] ;
+                }
+                _ll = 0.5 / std::sqrt(_ll) ;
+
+                for (int _kk = 0; _kk < _bp._nd; ++_kk)
+                    _pt[_jj * _stride + _kk] =
+                        _pc[_kk] + _ll * _uu[_kk] ;
+            }
+            }
+        }
+    }
+
+    typedef void (*make_func) (
+        bench_pred const&, std::vector<double> &,
+        size_t, rand_gen &) ;
+
+    struct bench_dist
+    {
+        char const     *_name ;
+        make_func       _make ;
+    } ;
+
+    bench_dist const _dist [] = {
+        { "random", make_rand } ,
+        { "grid"  , make_grid } ,
+        { "near"  , make_near } ,
+        } ;
+
+    int const _dist_size =
+        sizeof(_dist) / sizeof(_dist[0]) ;
+
+/*-------------------------------- time one implementation */
+
+    typedef double (*call_func) (int, double *) ;
+
+    double time_pred (
+        call_func _call, int _id, bench_pred const& _bp,
+        std::vector<double> &_pp, size_t _nn
+        )
+    {
+        double _ss = 0.0 ;
+        for (size_t _ii = 0; _ii < _nn; ++_ii)
+            _ss += _call(_id,
+                &_pp[_ii * _bp._np * _stride]) ;
+
+        auto _t0 = std::chrono::steady_clock::now() ;
+        auto _t1 = _t0 ;
+
+        size_t _nr = +0 ;
+        do {
+            for (size_t _ii = 0; _ii < _nn; ++_ii)
+                _ss += _call(_id,
+                    &_pp[_ii * _bp._np * _stride]) ;
+
+            _nr += +1 ;
+            _t1  = std::chrono::steady_clock::now() ;
+        }
+        while (_t1 - _t0 < std::chrono::milliseconds(50)) ;
+
+        _sink = _ss ;           // keep the calls live
+
+        return std::chrono::duration<double,
+            std::nano>(_t1 - _t0).count() / (_nn * _nr) ;
+    }
+
+    int sign_of (
+        double _xx
+        )
+    {   return (_xx > 0.) - (_xx < 0.) ;
+    }
+
+int main (
+    int _argc, char **_argv
+    ) {
+
+    size_t _nn = _argc > 1 ?
+        std::strtoul(_argv[1], nullptr, 10) : 1 << 15 ;
+
+    if (_nn == 0) _nn = +1 ;
+
+    ::exactinit() ;
+
+    std::printf("%-9s %-7s %10s %10s %8s %10s\n",
+        "predicate", "inputs", "geompred", "shewchuk",
+        "ratio", "mismatch") ;
+
+    size_t _nbad = +0 ;
+
+    for (int _ip = 0; _ip < _pred_size; ++_ip)
+    for (int _id = 0; _id < _dist_size; ++_id)
+    {
+        bench_pred const& _bp = _pred[_ip] ;
+
+        rand_gen _rg(7654321 + 31 * _ip + _id) ;
+
+        std::vector<double> _pp(
+            _nn * _bp._np * _stride, 0.0) ;
+
+        _dist[_id]._make(_bp, _pp, _nn, _rg) ;
+
+    /*---------------- cross-check signs on every tuple */
+        size_t _nmis = +0 ;
+        for (size_t _ii = 0; _ii < _nn; ++_ii)
+        {
+            double *_pt = &_pp[_ii * _bp._np * _stride] ;
+
+            if (sign_of(call_geompred(_ip, _pt)) !=
+                sign_of(call_shewchuk(_ip, _pt)) )
+                _nmis += +1 ;
+        }
+
+        _nbad += _nmis ;
+
+    /*---------------- ns/call for each implementation  */
+        double _tg = time_pred(
+            call_geompred, _ip, _bp, _pp, _nn) ;
+        double _ts = time_pred(
+            call_shewchuk, _ip, _bp, _pp, _nn) ;
+
+        std::printf(
+            "%-9s %-7s %10.2f %10.2f %8.3f %10zu\n",
+            _bp._name, _dist[_id]._name,
+            _tg, _ts, _tg / _ts, _nmis) ;
+    }
+
+    return _nbad == 0 ? 0 : 1 ;
+}
+
+
+
@@ -0,0 +1,28 @@
+#!/bin/sh
+
+# ./compare.sh [num. tuples per test]
+
+# Fetch J. R. Shewchuk's (public domain) predicates.c into
+# the tree if not already present, build compare.cpp
+# against it and run the side-by-side comparison.
+
+set -e
+
+cd "$(dirname "$0")"
+
+URL=https://www.cs.cmu.edu/afs/cs/project/quake/public/code/predicates.c
+
+if [ ! -f predicates.c ]; then
+    if command -v curl >/dev/null 2>&1; then
+        curl -fsSL -o predicates.c "$URL"
+    else
+        wget -q -O predicates.c "$URL"
+    fi
+fi
+
+${CC:-gcc} -O3 -c predicates.c -o predicates.o
+
+${CXX:-g++} -std=c++17 -pedantic -Wall -O3 -DNDEBUG \
+    compare.cpp predicates.o -o compare
+
+./compare "$@"
@@ -8,8 +8,8 @@
 
 int main () {
 
-    // Initialise the internal library state. Call at the
-    // start of any program.
+    // Optional: machine constants are fixed at compile-
+    // time, this call is retained as a no-op.
 
     mp_float::exactinit() ;
 
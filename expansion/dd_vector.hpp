@@ -0,0 +1,741 @@
+/*
+    --------------------------------------------------------
+     * MPFLOAT: multi-precision floating-point arithmetic.
+    --------------------------------------------------------
+     *
+     * Packed "double-double" arithmetic: NN dd_flt lanes,
+     * stored as separate hi/lo planes. Each op. is a
+     * branch-free loop over the lanes, calling the same
+     * error-free kernels as dd_flt, so that it vectorises
+     * to SSE/AVX/AVX-512/NEON at -O3 (with -march=native,
+     * etc). Products use the FMA-based kernels whenever
+     * FP_FAST_FMA is defined (-mfma, etc). Do not compile
+     * with -ffast-math, or similar.
+     *
+     * M. Joldes, J-M. Muller, V. Popescu (2017): Tight &
+     * rigourous error bounds for basic building blocks of
+     * double-word arithmetic. ACM Transactions on
+     * Mathematical Software, ACM, 44 (2), pp. 1-27.
+     *
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __DD_VECTOR__
+#   define __DD_VECTOR__
+
+#   include "dd_float.hpp"
+
+//  namespace mp_float {                    // hmmm no...
+
+    /*
+    --------------------------------------------------------
+     * DD_VEC: packed (double-double) precision numbers
+    --------------------------------------------------------
+     */
+
+#   define  REAL_TYPE mp_float::real_type
+#   define  INDX_TYPE mp_float::indx_type
+
+#   ifndef  DD_VEC_SIZE
+#   define  DD_VEC_SIZE  8          // lanes per dd_vec
+#   endif
+
+    template <
+        size_t NN = DD_VEC_SIZE
+             >
+    class dd_vec
+    {
+/*------------------------------ packed doubledouble type */
+    public  :
+    typedef REAL_TYPE           real_type;
+    typedef INDX_TYPE           indx_type;
+
+    size_t static constexpr _size = NN ;
+
+    alignas(64) real_type      _xhi [ NN ] ;
+    alignas(64) real_type      _xlo [ NN ] ;
+
+    public  :
+/*------------------------------ access to expansion bits */
+    __inline_call real_type&      hi (
+        size_t _ii
+        )
+    {   return this->_xhi[_ii] ;
+    }
+    __inline_call real_type&      lo (
+        size_t _ii
+        )
+    {   return this->_xlo[_ii] ;
+    }
+
+    __inline_call real_type const&hi (
+        size_t _ii
+        ) const
+    {   return this->_xhi[_ii] ;
+    }
+    __inline_call real_type const&lo (
+        size_t _ii
+        ) const
+    {   return this->_xlo[_ii] ;
+    }
+
+    __inline_call dd_flt operator[] (       // lane as dd
+        size_t _ii
+        ) const
+    {   return dd_flt(hi(_ii), lo(_ii)) ;
+    }
+
+    __inline_call void set (
+        size_t _ii, dd_flt const& _aa
+        )
+    {   hi(_ii) = _aa.hi() ;
+        lo(_ii) = _aa.lo() ;
+    }
+
+/*------------------------------ initialising constructor */
+    __inline_call dd_vec (                  // broadcast
+        real_type _hi = real_type(+0.) ,
+        real_type _lo = real_type(+0.)
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        {
+            this->_xhi[_ii] = _hi ;
+            this->_xlo[_ii] = _lo ;
+        }
+    }
+
+    __inline_call dd_vec (                  // broadcast
+        dd_flt const& _aa
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        {
+            this->_xhi[_ii] = _aa.hi() ;
+            this->_xlo[_ii] = _aa.lo() ;
+        }
+    }
+
+/*------------------------------ load/store from hi/lo [] */
+    __inline_call void load (
+      __const_ptr(real_type) _hi
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        {
+            this->_xhi[_ii] = _hi[_ii] ;
+            this->_xlo[_ii] = (real_type)+0. ;
+        }
+    }
+
+    __inline_call void load (
+      __const_ptr(real_type) _hi ,
+      __const_ptr(real_type) _lo
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        {
+            this->_xhi[_ii] = _hi[_ii] ;
+            this->_xlo[_ii] = _lo[_ii] ;
+        }
+    }
+
+    __inline_call void store (
+      __write_ptr(real_type) _hi ,
+      __write_ptr(real_type) _lo
+        ) const
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        {
+            _hi[_ii] = this->_xhi[_ii] ;
+            _lo[_ii] = this->_xlo[_ii] ;
+        }
+    }
+
+/*------------------------------ helper: init. from a + b */
+    __inline_call void from_add (
+      __const_ptr(real_type) _aa ,
+      __const_ptr(real_type) _bb
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        mp_float::one_one_add_full(_aa[_ii], _bb[_ii],
+            this->_xhi[_ii],
+            this->_xlo[_ii]) ;
+    }
+
+/*------------------------------ helper: init. from a - b */
+    __inline_call void from_sub (
+      __const_ptr(real_type) _aa ,
+      __const_ptr(real_type) _bb
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        mp_float::one_one_sub_full(_aa[_ii], _bb[_ii],
+            this->_xhi[_ii],
+            this->_xlo[_ii]) ;
+    }
+
+/*------------------------------ helper: init. from a * a */
+    __inline_call void from_sqr (
+      __const_ptr(real_type) _aa
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        mp_float::one_one_sqr_full(_aa[_ii],
+            this->_xhi[_ii],
+            this->_xlo[_ii]) ;
+    }
+
+/*------------------------------ helper: init. from a * b */
+    __inline_call void from_mul (
+      __const_ptr(real_type) _aa ,
+      __const_ptr(real_type) _bb
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        mp_float::one_one_mul_full(_aa[_ii], _bb[_ii],
+            this->_xhi[_ii],
+            this->_xlo[_ii]) ;
+    }
+
+/*------------------------------ helper: init. from a * b */
+    __inline_call void from_mul (
+        dd_flt const&          _aa ,
+      __const_ptr(real_type) _bb
+        )
+    {
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        mp_float::two_one_mul_clip(
+            _aa.hi(), _aa.lo(), _bb[_ii],
+            this->_xhi[_ii],
+            this->_xlo[_ii]) ;
+    }
+
+/*---------------------------------------- math operators */
+    __inline_call dd_vec  operator + (
+        ) const
+    {   return ( *this ) ;
+    }
+
+    __inline_call dd_vec  operator - (
+        ) const
+    {
+        dd_vec _rr ;
+        for (size_t _ii = 0; _ii < NN; ++_ii)
+        {
+            _rr._xhi[_ii] = -this->_xhi[_ii] ;
+            _rr._xlo[_ii] = -this->_xlo[_ii] ;
+        }
+        return ( _rr ) ;
+    }
+
+    __inline_call dd_vec& operator+= (      // via double
+        real_type _aa
+        )
+    {   return ( *this = *this + _aa ) ;
+    }
+    __inline_call dd_vec& operator-= (
+        real_type _aa
+        )
+    {   return ( *this = *this - _aa ) ;
+    }
+    __inline_call dd_vec& operator*= (
+        real_type _aa
+        )
+    {   return ( *this = *this * _aa ) ;
+    }
+    __inline_call dd_vec& operator/= (
+        real_type _aa
+        )
+    {   return ( *this = *this / _aa ) ;
+    }
+
+    __inline_call dd_vec& operator+= (      // via dd_flt
+        dd_flt const& _aa
+        )
+    {   return ( *this = *this + _aa ) ;
+    }
+    __inline_call dd_vec& operator-= (
+        dd_flt const& _aa
+        )
+    {   return ( *this = *this - _aa ) ;
+    }
+    __inline_call dd_vec& operator*= (
+        dd_flt const& _aa
+        )
+    {   return ( *this = *this * _aa ) ;
+    }
+    __inline_call dd_vec& operator/= (
+        dd_flt const& _aa
+        )
+    {   return ( *this = *this / _aa ) ;
+    }
+
+    __inline_call dd_vec& operator+= (      // via dd_vec
+        dd_vec const& _aa
+        )
+    {   return ( *this = *this + _aa ) ;
+    }
+    __inline_call dd_vec& operator-= (
+        dd_vec const& _aa
+        )
+    {   return ( *this = *this - _aa ) ;
+    }
+    __inline_call dd_vec& operator*= (
+        dd_vec const& _aa
+        )
+    {   return ( *this = *this * _aa ) ;
+    }
+    __inline_call dd_vec& operator/= (
+        dd_vec const& _aa
+        )
+    {   return ( *this = *this / _aa ) ;
+    }
+
+    } ;
+
+    /*
+    --------------------------------------------------------
+     * packed double-double lane-wise kernels
+    --------------------------------------------------------
+     */
+
+#   define __dd_vec_two_one(_op)                            \
+        dd_vec<NN> _rr ;                                    \
+        for (size_t _ii = 0; _ii < NN; ++_ii)               \
+        mp_float::_op(                                      \
+            _aa._xhi[_ii], _aa._xlo[_ii], _bb,              \
+            _rr._xhi[_ii], _rr._xlo[_ii]) ;                 \
+        return ( _rr ) ;
+
+#   define __dd_vec_two_dd(_op)                             \
+        dd_vec<NN> _rr ;                                    \
+        for (size_t _ii = 0; _ii < NN; ++_ii)               \
+        mp_float::_op(                                      \
+            _aa._xhi[_ii], _aa._xlo[_ii],                   \
+            _bb.hi(), _bb.lo(),                             \
+            _rr._xhi[_ii], _rr._xlo[_ii]) ;                 \
+        return ( _rr ) ;
+
+#   define __dd_vec_two_two(_op)                            \
+        dd_vec<NN> _rr ;                                    \
+        for (size_t _ii = 0; _ii < NN; ++_ii)               \
+        mp_float::_op(                                      \
+            _aa._xhi[_ii], _aa._xlo[_ii],                   \
+            _bb._xhi[_ii], _bb._xlo[_ii],                   \
+            _rr._xhi[_ii], _rr._xlo[_ii]) ;                 \
+        return ( _rr ) ;
+
+    /*
+    --------------------------------------------------------
+     * packed double-double a + b operators
+    --------------------------------------------------------
+     */
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator + (
+        dd_vec<NN> const& _aa,
+        REAL_TYPE         _bb
+        )
+    {   __dd_vec_two_one(two_one_add_clip)
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator + (
+        REAL_TYPE         _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   return ( _bb + _aa ) ;
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator + (
+        dd_vec<NN> const& _aa,
+        dd_flt     const& _bb
+        )
+    {   __dd_vec_two_dd(two_two_add_clip)
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator + (
+        dd_flt     const& _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   return ( _bb + _aa ) ;
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator + (
+        dd_vec<NN> const& _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   __dd_vec_two_two(two_two_add_clip)
+    }
+
+    /*
+    --------------------------------------------------------
+     * packed double-double a - b operators
+    --------------------------------------------------------
+     */
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator - (
+        dd_vec<NN> const& _aa,
+        REAL_TYPE         _bb
+        )
+    {   __dd_vec_two_one(two_one_sub_clip)
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator - (
+        REAL_TYPE         _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   return ( -(_bb - _aa) ) ;
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator - (
+        dd_vec<NN> const& _aa,
+        dd_flt     const& _bb
+        )
+    {   __dd_vec_two_dd(two_two_sub_clip)
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator - (
+        dd_flt     const& _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   return ( -(_bb - _aa) ) ;
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator - (
+        dd_vec<NN> const& _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   __dd_vec_two_two(two_two_sub_clip)
+    }
+
+    /*
+    --------------------------------------------------------
+     * packed double-double a * b operators
+    --------------------------------------------------------
+     */
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator * (
+        dd_vec<NN> const& _aa,
+        REAL_TYPE         _bb
+        )
+    {   __dd_vec_two_one(two_one_mul_clip)
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator * (
+        REAL_TYPE         _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   return ( _bb * _aa ) ;
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator * (
+        dd_vec<NN> const& _aa,
+        dd_flt     const& _bb
+        )
+    {   __dd_vec_two_dd(two_two_mul_clip)
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator * (
+        dd_flt     const& _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   return ( _bb * _aa ) ;
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator * (
+        dd_vec<NN> const& _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   __dd_vec_two_two(two_two_mul_clip)
+    }
+
+    /*
+    --------------------------------------------------------
+     * packed double-double a / b operators
+    --------------------------------------------------------
+     */
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator / (
+        dd_vec<NN> const& _aa,
+        REAL_TYPE         _bb
+        )
+    {   __dd_vec_two_one(two_one_div_clip)
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator / (
+        REAL_TYPE         _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   return ( dd_vec<NN>(_aa) / _bb ) ;
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator / (
+        dd_vec<NN> const& _aa,
+        dd_flt     const& _bb
+        )
+    {   __dd_vec_two_dd(two_two_div_clip)
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator / (
+        dd_flt     const& _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   return ( dd_vec<NN>(_aa) / _bb ) ;
+    }
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> operator / (
+        dd_vec<NN> const& _aa,
+        dd_vec<NN> const& _bb
+        )
+    {   __dd_vec_two_two(two_two_div_clip)
+    }
+
+#   undef  __dd_vec_two_one
+#   undef  __dd_vec_two_dd
+#   undef  __dd_vec_two_two
+
+    /*
+    --------------------------------------------------------
+     * DD_VEC_SUM: sum over the lanes of a dd_vec.
+    --------------------------------------------------------
+     */
+
+    template <size_t NN>
+    __inline_call dd_flt dd_vec_sum (
+        dd_vec<NN> const& _aa
+        )
+    {
+        dd_flt _ss = _aa[0] ;
+        for (size_t _ii = 1; _ii < NN; ++_ii)
+            _ss += _aa[_ii] ;
+
+        return ( _ss ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * DD_DET3: 3 x 3 determinant in each dd_vec lane.
+    --------------------------------------------------------
+     */
+
+    template <size_t NN>
+    __inline_call dd_vec<NN> dd_det3 (
+        dd_vec<NN> const& _a00 ,
+        dd_vec<NN> const& _a01 ,
+        dd_vec<NN> const& _a02 ,
+        dd_vec<NN> const& _a10 ,
+        dd_vec<NN> const& _a11 ,
+        dd_vec<NN> const& _a12 ,
+        dd_vec<NN> const& _a20 ,
+        dd_vec<NN> const& _a21 ,
+        dd_vec<NN> const& _a22
+        )
+    {
+        return _a00 * (_a11 * _a22 - _a12 * _a21)
+             - _a01 * (_a10 * _a22 - _a12 * _a20)
+             + _a02 * (_a10 * _a21 - _a11 * _a20) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Array-level kernels, processing NN lanes at a time.
+     * Trailing lanes are padded with zeros, so that every
+     * block runs through the same (packed) code path.
+     *
+    --------------------------------------------------------
+     */
+
+    /*
+    --------------------------------------------------------
+     * DD_DOT: dot(x, y) in double-double, for REAL x, y.
+    --------------------------------------------------------
+     */
+
+    template <size_t NN = DD_VEC_SIZE>
+    __normal_call dd_flt dd_dot (
+        size_t _nn ,
+      __const_ptr(REAL_TYPE) _xx ,
+      __const_ptr(REAL_TYPE) _yy
+        )
+    {
+        dd_vec<NN> _ss, _pp;
+
+        size_t _ii = 0 ;
+        for ( ; _ii + NN <= _nn; _ii += NN)
+        {
+            _pp.from_mul(_xx + _ii, _yy + _ii) ;
+            _ss += _pp ;
+        }
+
+        if (_ii < _nn)
+        {
+            REAL_TYPE _xt [NN] = { +0. } ;
+            REAL_TYPE _yt [NN] = { +0. } ;
+            for (size_t _jj = 0; _ii + _jj < _nn; ++_jj)
+            {
+                _xt[_jj] = _xx[_ii + _jj] ;
+                _yt[_jj] = _yy[_ii + _jj] ;
+            }
+
+            _pp.from_mul(_xt, _yt) ;
+            _ss += _pp ;
+        }
+
+        return ( dd_vec_sum(_ss) ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * DD_AXPY: y = a * x + y, for dd a, REAL x, and dd y
+     * stored as separate hi/lo arrays. Memory-bound, so
+     * a plain (vectorisable) loop over the hi/lo planes.
+    --------------------------------------------------------
+     */
+
+    __inline_call void dd_axpy (
+        size_t _nn ,
+        dd_flt const&          _aa ,
+      __const_ptr(REAL_TYPE) _xx ,
+      __write_ptr(REAL_TYPE) _yh ,
+      __write_ptr(REAL_TYPE) _yl
+        )
+    {
+        REAL_TYPE const _ah = _aa.hi() ;
+        REAL_TYPE const _al = _aa.lo() ;
+
+        for (size_t _ii = 0; _ii < _nn; ++_ii)
+        {
+            REAL_TYPE _t1, _t0 ;
+            mp_float::two_one_mul_clip(
+                _ah, _al, _xx[_ii], _t1, _t0) ;
+            mp_float::two_two_add_clip(
+                _yh[_ii], _yl[_ii], _t1, _t0,
+                _yh[_ii], _yl[_ii]) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * DD_DET3: d = det([a00 a01 a02; a10 ...; ... a22]),
+     * for REAL matrix entries in SoA arrays _mm[9], row-
+     * major. Output d as separate hi/lo arrays.
+    --------------------------------------------------------
+     */
+
+    template <size_t NN = DD_VEC_SIZE>
+    __normal_call void dd_det3 (
+        size_t _nn ,
+        REAL_TYPE const *const _mm [9] ,
+      __write_ptr(REAL_TYPE) _dh ,
+      __write_ptr(REAL_TYPE) _dl
+        )
+    {
+        dd_vec<NN> _aa [9] ;
+
+        size_t _ii = 0 ;
+        for ( ; _ii + NN <= _nn; _ii += NN)
+        {
+            for (auto _kk = 0; _kk < 9; ++_kk)
+                _aa[_kk].load(_mm[_kk] + _ii) ;
+
+            dd_det3(_aa[0], _aa[1], _aa[2],
+                    _aa[3], _aa[4], _aa[5],
+                    _aa[6], _aa[7], _aa[8]).store(
+                _dh + _ii, _dl + _ii) ;
+        }
+
+        if (_ii < _nn)
+        {
+            REAL_TYPE _th [NN], _tl [NN] ;
+            for (auto _kk = 0; _kk < 9; ++_kk)
+            {
+                REAL_TYPE _tt [NN] = { +0. } ;
+                for (size_t _jj = 0; _ii + _jj < _nn; ++_jj)
+                    _tt[_jj] = _mm[_kk][_ii + _jj] ;
+
+                _aa[_kk].load(_tt) ;
+            }
+
+            dd_det3(_aa[0], _aa[1], _aa[2],
+                    _aa[3], _aa[4], _aa[5],
+                    _aa[6], _aa[7], _aa[8]).store(
+                _th, _tl) ;
+
+            for (size_t _jj = 0; _ii + _jj < _nn; ++_jj)
+            {
+                _dh[_ii + _jj] = _th[_jj] ;
+                _dl[_ii + _jj] = _tl[_jj] ;
+            }
+        }
+    }
+
+#   undef REAL_TYPE
+#   undef INDX_TYPE
+
+
+//  }
+
+#   endif//__DD_VECTOR__
+
+
+
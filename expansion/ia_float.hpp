@@ -64,53 +64,203 @@
 #   define  REAL_TYPE mp_float::real_type
 #   define  INDX_TYPE mp_float::indx_type
 
-//  silliness with "volatile" to try to stop the compiler
-//  from spuriously(!) optimising floating-point op's and
-//  breaking rounding-mode behaviour...
+    /*
+    --------------------------------------------------------
+     *
+     * Outward rounded op's, without switching the FPU's
+     * rounding mode: each op. is evaluated in round-to-
+     * nearest, with its (exact) rounding error E found
+     * via an error-free transformation. The result is
+     * then bumped to its succ./pred. as the sign of E
+     * requires, giving RU(a op b) and RD(a op b) exactly.
+     *
+     * succ./pred. are computed a'la Rump et al:
+     *
+     * S. M. Rump, P. Zimmermann, S. Boldo, G. Melquiond
+     * (2009), Computing predecessor and successor in
+     * rounding to nearest. BIT Numer. Math., 49, 419-431.
+     *
+     * Products use the FMA-based EFT where hardware FMA is
+     * available, and are otherwise (or near underflow) just
+     * widened by an ulp each side, as Dekker's splitting is
+     * both slow and unsafe for large operands. Products
+     * with a zero operand are exact, and are kept as +0.
+     * rather than widened to +-eta.
+     *
+    --------------------------------------------------------
+     */
+
+    REAL_TYPE constexpr _ia_unit =          // unit round
+        std::numeric_limits<REAL_TYPE>::epsilon() / 2 ;
+
+    REAL_TYPE constexpr _ia_phi =
+        _ia_unit * (+1. + 2. * _ia_unit) ;
+
+    REAL_TYPE constexpr _ia_eta =
+        std::numeric_limits<REAL_TYPE>::denorm_min() ;
+
+    REAL_TYPE constexpr _ia_max =
+        std::numeric_limits<REAL_TYPE>::max() ;
+
+    REAL_TYPE constexpr _ia_tiny =          // no underflow
+        std::numeric_limits<REAL_TYPE>::min() /
+       (_ia_unit * _ia_unit) ;
+
+    __inline_call REAL_TYPE nxt_ulp (       // succ(x) - x
+        REAL_TYPE _xx
+        )
+    {
+        REAL_TYPE _XX = std::abs(_xx) ;
+        if (_XX >= _ia_tiny)    // keep subnormal eta out of
+            return _ia_phi * _XX ;              // hot path
+        else
+            return _ia_phi * _XX + _ia_eta ;
+    }
+
+    __inline_call REAL_TYPE nxt_up (        // >= succ(x)
+        REAL_TYPE _xx
+        )
+    {   return _xx + nxt_ulp(_xx) ;
+    }
+
+    __inline_call REAL_TYPE nxt_dn (        // <= pred(x)
+        REAL_TYPE _xx
+        )
+    {   return _xx - nxt_ulp(_xx) ;
+    }
+
+//  the sign of E is "random", so select branch-free...
+
+    __inline_call REAL_TYPE rnd_up (        // x + e, RU
+        REAL_TYPE _xx, REAL_TYPE _ee
+        )
+    {
+        if (_xx < -_ia_max) return -_ia_max ;
 
-//  really, proper compiler support is needed instead and
-//  it's unclear whether this is actually reliable or not
+        REAL_TYPE _dd = nxt_ulp(_xx) ;
+        return _ee > (REAL_TYPE)+0. ?
+            _xx + _dd : _xx ;
+    }
 
-    __normal_call REAL_TYPE add_up (        // for rnd up
+    __inline_call REAL_TYPE rnd_dn (        // x + e, RD
+        REAL_TYPE _xx, REAL_TYPE _ee
+        )
+    {
+        if (_xx > +_ia_max) return +_ia_max ;
+
+        REAL_TYPE _dd = nxt_ulp(_xx) ;
+        return _ee < (REAL_TYPE)+0. ?
+            _xx - _dd : _xx ;
+    }
+
+    __inline_call REAL_TYPE add_up (        // for rnd up
         REAL_TYPE _aa, REAL_TYPE _bb
         )
-    {   REAL_TYPE volatile _cc = (+_aa) + (+_bb) ;
-        return +_cc ;
+    {   REAL_TYPE _x1, _x0 ;
+        mp_float::one_one_add_full(_aa, _bb, _x1, _x0) ;
+        return rnd_up(_x1, _x0) ;
     }
 
-    __normal_call REAL_TYPE add_dn (
+    __inline_call REAL_TYPE add_dn (
         REAL_TYPE _aa, REAL_TYPE _bb
         )
-    {   REAL_TYPE volatile _cc = (-_aa) + (-_bb) ;
-        return -_cc ;
+    {   REAL_TYPE _x1, _x0 ;
+        mp_float::one_one_add_full(_aa, _bb, _x1, _x0) ;
+        return rnd_dn(_x1, _x0) ;
     }
 
-    __normal_call REAL_TYPE sub_up (
+    __inline_call REAL_TYPE sub_up (
         REAL_TYPE _aa, REAL_TYPE _bb
         )
-    {   REAL_TYPE volatile _cc = (+_aa) - (+_bb) ;
-        return +_cc ;
+    {   REAL_TYPE _x1, _x0 ;
+        mp_float::one_one_sub_full(_aa, _bb, _x1, _x0) ;
+        return rnd_up(_x1, _x0) ;
     }
 
-    __normal_call REAL_TYPE sub_dn (
+    __inline_call REAL_TYPE sub_dn (
         REAL_TYPE _aa, REAL_TYPE _bb
         )
-    {   REAL_TYPE volatile _cc = (+_bb) - (+_aa) ;
-        return -_cc ;
+    {   REAL_TYPE _x1, _x0 ;
+        mp_float::one_one_sub_full(_aa, _bb, _x1, _x0) ;
+        return rnd_dn(_x1, _x0) ;
     }
 
-    __normal_call REAL_TYPE mul_up (
+    __inline_call REAL_TYPE mul_up (
         REAL_TYPE _aa, REAL_TYPE _bb
         )
-    {   REAL_TYPE volatile _cc = (+_aa) * (+_bb) ;
-        return +_cc ;
+    {
+        if constexpr (mp_float::_has_fma)
+        {
+        REAL_TYPE _x1, _x0 ;
+        _x1 = _aa * _bb;
+        _x0 = fma(_aa, _bb, -_x1);
+
+        REAL_TYPE _XX = std::abs(_x1) ;
+        if (_XX >= _ia_tiny && _XX <= _ia_max)
+            return rnd_up(_x1, _x0) ;   // EFT is exact
+        else
+        if (_aa == (REAL_TYPE)+0. ||
+            _bb == (REAL_TYPE)+0. )
+            return (REAL_TYPE)+0. ;     // keep exact zero
+        else
+        if (_XX <= _ia_max)
+            return nxt_up(_x1) ;
+        else
+            return rnd_up(_x1, +0.) ;
+        }
+        else        // no fma: skip Dekker's EFT, just widen
+        {
+        REAL_TYPE _x1 = _aa * _bb;
+
+        if (_x1 == (REAL_TYPE)+0. &&
+           (_aa == (REAL_TYPE)+0. ||
+            _bb == (REAL_TYPE)+0.))
+            return (REAL_TYPE)+0. ;     // keep exact zero
+        else
+        if (std::abs(_x1) <= _ia_max)
+            return nxt_up(_x1) ;
+        else
+            return rnd_up(_x1, +0.) ;
+        }
     }
 
-    __normal_call REAL_TYPE mul_dn (
+    __inline_call REAL_TYPE mul_dn (
         REAL_TYPE _aa, REAL_TYPE _bb
         )
-    {   REAL_TYPE volatile _cc = (+_aa) * (-_bb) ;
-        return -_cc ;
+    {
+        if constexpr (mp_float::_has_fma)
+        {
+        REAL_TYPE _x1, _x0 ;
+        _x1 = _aa * _bb;
+        _x0 = fma(_aa, _bb, -_x1);
+
+        REAL_TYPE _XX = std::abs(_x1) ;
+        if (_XX >= _ia_tiny && _XX <= _ia_max)
+            return rnd_dn(_x1, _x0) ;   // EFT is exact
+        else
+        if (_aa == (REAL_TYPE)+0. ||
+            _bb == (REAL_TYPE)+0. )
+            return (REAL_TYPE)+0. ;     // keep exact zero
+        else
+        if (_XX <= _ia_max)
+            return nxt_dn(_x1) ;
+        else
+            return rnd_dn(_x1, +0.) ;
+        }
+        else        // no fma: skip Dekker's EFT, just widen
+        {
+        REAL_TYPE _x1 = _aa * _bb;
+
+        if (_x1 == (REAL_TYPE)+0. &&
+           (_aa == (REAL_TYPE)+0. ||
+            _bb == (REAL_TYPE)+0.))
+            return (REAL_TYPE)+0. ;     // keep exact zero
+        else
+        if (std::abs(_x1) <= _ia_max)
+            return nxt_dn(_x1) ;
+        else
+            return rnd_dn(_x1, +0.) ;
+        }
     }
 
     class ia_flt;
@@ -145,28 +295,6 @@
         ia_flt const&,
         ia_flt const&) ;
 
-    class ia_rnd
-    {
-/*---------------------------------- interval FP-rnd type */
-    public  :
-    int volatile _rndstate = 0;
-
-    public  :
-/*---------------------------------- floating pt rounding */
-    __normal_call  ia_rnd (
-        )
-    {
-        _rndstate=fegetround();
-
-        fesetround (FE_UPWARD);
-    }
-    __normal_call ~ia_rnd (
-        )
-    {
-        fesetround (_rndstate);
-    }
-    } ;
-
     class ia_flt
     {
 /*---------------------------------- interval number type */
@@ -271,7 +399,7 @@
 
     __inline_call ia_flt  operator - (
         ) const
-    {   return   ia_flt(-lo(), -up());
+    {   return   ia_flt(-up(), -lo());
     }
 
     __inline_call ia_flt& operator+= (      // via double
@@ -526,7 +654,7 @@
             REAL_TYPE _u1, _u2;
             _u1 = mul_up(_aa.lo(), _bb.lo());
             _u2 = mul_up(_aa.up(), _bb.up());
-            _up = std::min(_u1, _u2);
+            _up = std::max(_u1, _u2);
         }
         else                            // mix * -ve
         {
@@ -97,37 +97,24 @@
     --------------------------------------------------------
      */
 
-    REAL_TYPE _splitter;
-    REAL_TYPE _epsilon ;
-
-    __normal_call void exactinit (
+    __inline_call REAL_TYPE constexpr pow_two (
+        INDX_TYPE _nn
         )
-    {
-    /*-------------- find machine eps, etc, a'la shewchuk */
-        INDX_TYPE _alternate = +1 ;
-        REAL_TYPE _lastcheck ;
-        REAL_TYPE _halve = +0.5;
-        REAL_TYPE _check = +1.0;
-
-    /*-------------- find eps: bisect until 1. + eps ~ 1. */
-
-        _epsilon = _splitter = +1.00 ;
-
-        do {
-            _lastcheck = _check;
-            _epsilon  *= _halve;
+    {   return _nn > +0 ? 2. * pow_two(_nn - 1) : 1. ;
+    }
 
-            if (_alternate)
-            _splitter *= +2.00 ;
+    REAL_TYPE constexpr _epsilon =          // unit round
+        std::numeric_limits<REAL_TYPE>::epsilon() / 2 ;
 
-            _alternate = !_alternate ;
+    REAL_TYPE constexpr _splitter =         // 2^ceil(p/2)+1
+        pow_two((std::numeric_limits<
+            REAL_TYPE>::digits + 1) / 2) + 1. ;
 
-            _check = 1.00 + _epsilon ;
-        }
-        while (_check != +1.00 &&
-               _check != _lastcheck) ;
-
-        _splitter += 1.00 ;
+    __normal_call void exactinit (
+        )
+    {
+    /*-------------- constants are now fixed at compile-time,
+                     retained for backwards compatibility */
     }
 
     /*
@@ -562,7 +549,7 @@
 
         _ss = _a0 * _b0 ;
         _ss = fma(_a1, _b0, _ss);
-        _ss = fma(_a0, _b0, _ss);
+        _ss = fma(_a0, _b1, _ss);
 
         _t0 = _t0 + _ss ;
 
@@ -648,6 +635,367 @@
             ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     * quad-double "clip" routines, a'la hida-li-bailey
+    --------------------------------------------------------
+     *
+     * Quad-doubles are four non-overlapping components,
+     * x3 + x2 + x1 + x0, with x3 the leading term. Bits
+     * beyond the 4th component are truncated on each op.
+     *
+    --------------------------------------------------------
+     */
+
+    __inline_call void three_one_add_full (
+        REAL_TYPE &_aa, REAL_TYPE &_bb,
+        REAL_TYPE &_cc
+        )
+    {   // (a, b, c) <- a + b + c, with a the leading term
+        REAL_TYPE _t1, _t2, _t3 ;
+        one_one_add_full(_aa, _bb, _t1, _t2
+            ) ;
+        one_one_add_full(_cc, _t1, _aa, _t3
+            ) ;
+        one_one_add_full(_t2, _t3, _bb, _cc
+            ) ;
+    }
+
+    __inline_call void three_one_add_clip (
+        REAL_TYPE &_aa, REAL_TYPE &_bb,
+        REAL_TYPE  _cc
+        )
+    {   // (a, b) <- a + b + c, with a the leading term
+        REAL_TYPE _t1, _t2, _t3 ;
+        one_one_add_full(_aa, _bb, _t1, _t2
+            ) ;
+        one_one_add_full(_cc, _t1, _aa, _t3
+            ) ;
+
+        _bb = _t2 + _t3 ;
+    }
+
+    __inline_call void four_renorm_clip (   // qd_flt
+        REAL_TYPE &_x3, REAL_TYPE &_x2,
+        REAL_TYPE &_x1, REAL_TYPE &_x0
+        )
+    {
+        if (std::isinf(_x3)) return ;
+
+        REAL_TYPE _s3, _s2, _s1 = +0., _s0 = +0. ;
+        one_one_add_fast(_x1, _x0, _s3, _x0) ;
+        one_one_add_fast(_x2, _s3, _s3, _x1) ;
+        one_one_add_fast(_x3, _s3, _x3, _x2) ;
+
+        _s3 = _x3; _s2 = _x2;
+
+        if (_s2 != +0.)
+        {
+            one_one_add_fast(_s2, _x1, _s2, _s1) ;
+            if (_s1 != +0.)
+            one_one_add_fast(_s1, _x0, _s1, _s0) ;
+            else
+            one_one_add_fast(_s2, _x0, _s2, _s1) ;
+        }
+        else
+        {
+            one_one_add_fast(_s3, _x1, _s3, _s2) ;
+            if (_s2 != +0.)
+            one_one_add_fast(_s2, _x0, _s2, _s1) ;
+            else
+            one_one_add_fast(_s3, _x0, _s3, _s2) ;
+        }
+
+        _x3 = _s3; _x2 = _s2; _x1 = _s1; _x0 = _s0;
+    }
+
+    __inline_call void five_renorm_clip (   // qd_flt
+        REAL_TYPE  _c4, REAL_TYPE  _c3,
+        REAL_TYPE  _c2, REAL_TYPE  _c1,
+        REAL_TYPE  _c0,
+        REAL_TYPE &_x3, REAL_TYPE &_x2,
+        REAL_TYPE &_x1, REAL_TYPE &_x0
+        )
+    {
+        if (std::isinf(_c4))
+        {
+            _x3 = _c4; _x2 = _c3; _x1 = _c2; _x0 = _c1;
+            return ;
+        }
+
+        REAL_TYPE _ss ;
+        one_one_add_fast(_c1, _c0, _ss, _c0) ;
+        one_one_add_fast(_c2, _ss, _ss, _c1) ;
+        one_one_add_fast(_c3, _ss, _ss, _c2) ;
+        one_one_add_fast(_c4, _ss, _c4, _c3) ;
+
+        REAL_TYPE _s3 = _c4, _s2 = _c3 ;
+        REAL_TYPE _s1 = +0., _s0 = +0. ;
+
+        if (_s2 != +0.)
+        {
+            one_one_add_fast(_s2, _c2, _s2, _s1) ;
+            if (_s1 != +0.)
+            {
+            one_one_add_fast(_s1, _c1, _s1, _s0) ;
+            if (_s0 != +0.)
+                _s0 += _c0 ;
+            else
+            one_one_add_fast(_s1, _c0, _s1, _s0) ;
+            }
+            else
+            {
+            one_one_add_fast(_s2, _c1, _s2, _s1) ;
+            if (_s1 != +0.)
+            one_one_add_fast(_s1, _c0, _s1, _s0) ;
+            else
+            one_one_add_fast(_s2, _c0, _s2, _s1) ;
+            }
+        }
+        else
+        {
+            one_one_add_fast(_s3, _c2, _s3, _s2) ;
+            if (_s2 != +0.)
+            {
+            one_one_add_fast(_s2, _c1, _s2, _s1) ;
+            if (_s1 != +0.)
+            one_one_add_fast(_s1, _c0, _s1, _s0) ;
+            else
+            one_one_add_fast(_s2, _c0, _s2, _s1) ;
+            }
+            else
+            {
+            one_one_add_fast(_s3, _c1, _s3, _s2) ;
+            if (_s2 != +0.)
+            one_one_add_fast(_s2, _c0, _s2, _s1) ;
+            else
+            one_one_add_fast(_s3, _c0, _s3, _s2) ;
+            }
+        }
+
+        _x3 = _s3; _x2 = _s2; _x1 = _s1; _x0 = _s0;
+    }
+
+    __inline_call void four_one_add_clip (  // qd_flt
+        REAL_TYPE  _a3, REAL_TYPE  _a2,
+        REAL_TYPE  _a1, REAL_TYPE  _a0,
+        REAL_TYPE  _bb,
+        REAL_TYPE &_x3, REAL_TYPE &_x2,
+        REAL_TYPE &_x1, REAL_TYPE &_x0
+        )
+    {
+        REAL_TYPE _c3, _c2, _c1, _c0, _ee ;
+        one_one_add_full(_a3, _bb, _c3, _ee) ;
+        one_one_add_full(_a2, _ee, _c2, _ee) ;
+        one_one_add_full(_a1, _ee, _c1, _ee) ;
+        one_one_add_full(_a0, _ee, _c0, _ee) ;
+
+        five_renorm_clip(_c3, _c2, _c1, _c0, _ee,
+            _x3, _x2, _x1, _x0
+            ) ;
+    }
+
+    __inline_call REAL_TYPE three_accum_fast (
+        REAL_TYPE &_aa, REAL_TYPE &_bb,
+        REAL_TYPE  _cc
+        )
+    {   // (a, b) <- a + b + c, returning any completed term
+        REAL_TYPE _ss ;
+        one_one_add_full(_bb, _cc, _ss, _bb) ;
+        one_one_add_full(_aa, _ss, _ss, _aa) ;
+
+        if (_aa != +0. && _bb != +0.) return _ss ;
+
+        if (_bb == +0.)
+        {
+            _bb = _aa; _aa = _ss;
+        }
+        else
+        {
+            _aa = _ss;
+        }
+
+        return (REAL_TYPE) +0. ;
+    }
+
+    __inline_call void four_four_add_clip ( // qd_flt
+        REAL_TYPE  _a3, REAL_TYPE  _a2,
+        REAL_TYPE  _a1, REAL_TYPE  _a0,
+        REAL_TYPE  _b3, REAL_TYPE  _b2,
+        REAL_TYPE  _b1, REAL_TYPE  _b0,
+        REAL_TYPE &_x3, REAL_TYPE &_x2,
+        REAL_TYPE &_x1, REAL_TYPE &_x0
+        )
+    {
+    /*------ merge a, b by magnitude, accumulating terms */
+        REAL_TYPE const _aa[4] = {_a3, _a2, _a1, _a0} ;
+        REAL_TYPE const _bb[4] = {_b3, _b2, _b1, _b0} ;
+
+        REAL_TYPE _xx[4] = {+0., +0., +0., +0.} ;
+
+        int _ia = 0, _ib = 0, _kk = 0 ;
+        REAL_TYPE _uu, _vv ;
+
+        if (std::abs(_aa[_ia]) > std::abs(_bb[_ib]))
+            _uu = _aa[_ia++] ;
+        else
+            _uu = _bb[_ib++] ;
+
+        if (std::abs(_aa[_ia]) > std::abs(_bb[_ib]))
+            _vv = _aa[_ia++] ;
+        else
+            _vv = _bb[_ib++] ;
+
+        one_one_add_fast(_uu, _vv, _uu, _vv) ;
+
+        while (_kk < 4)
+        {
+            if (_ia >= 4 && _ib >= 4)
+            {
+                _xx[_kk] = _uu;
+                if (_kk < 3) _xx[++_kk] = _vv;
+                break ;
+            }
+
+            REAL_TYPE _tt ;
+            if (_ia >= 4)
+                _tt = _bb[_ib++] ;
+            else
+            if (_ib >= 4)
+                _tt = _aa[_ia++] ;
+            else
+            if (std::abs(_aa[_ia]) > std::abs(_bb[_ib]))
+                _tt = _aa[_ia++] ;
+            else
+                _tt = _bb[_ib++] ;
+
+            REAL_TYPE _ss =
+                three_accum_fast(_uu, _vv, _tt) ;
+
+            if (_ss != +0.) _xx[_kk++] = _ss ;
+        }
+
+        for ( ; _ia < 4; ++_ia) _xx[3] += _aa[_ia] ;
+        for ( ; _ib < 4; ++_ib) _xx[3] += _bb[_ib] ;
+
+        four_renorm_clip(_xx[0], _xx[1], _xx[2], _xx[3]
+            ) ;
+
+        _x3 = _xx[0]; _x2 = _xx[1];
+        _x1 = _xx[2]; _x0 = _xx[3];
+    }
+
+    __inline_call void four_one_mul_clip (  // qd_flt
+        REAL_TYPE  _a3, REAL_TYPE  _a2,
+        REAL_TYPE  _a1, REAL_TYPE  _a0,
+        REAL_TYPE  _bb,
+        REAL_TYPE &_x3, REAL_TYPE &_x2,
+        REAL_TYPE &_x1, REAL_TYPE &_x0
+        )
+    {
+        REAL_TYPE _p3, _p2, _p1, _p0 ;
+        REAL_TYPE _q3, _q2, _q1 ;
+        one_one_mul_full(_a3, _bb, _p3, _q3) ;
+        one_one_mul_full(_a2, _bb, _p2, _q2) ;
+        one_one_mul_full(_a1, _bb, _p1, _q1) ;
+        _p0 = _a0 * _bb ;
+
+        REAL_TYPE _s3, _s2, _s1, _s0, _sx ;
+        _s3 = _p3 ;
+        one_one_add_full(_q3, _p2, _s2, _s1) ;
+
+        three_one_add_full(_s1, _q2, _p1) ;
+        three_one_add_clip(_q2, _q1, _p0) ;
+
+        _s0 = _q2 ;
+        _sx = _q1 + _p1 ;
+
+        five_renorm_clip(_s3, _s2, _s1, _s0, _sx,
+            _x3, _x2, _x1, _x0
+            ) ;
+    }
+
+    __inline_call void four_four_mul_clip ( // qd_flt
+        REAL_TYPE  _a3, REAL_TYPE  _a2,
+        REAL_TYPE  _a1, REAL_TYPE  _a0,
+        REAL_TYPE  _b3, REAL_TYPE  _b2,
+        REAL_TYPE  _b1, REAL_TYPE  _b0,
+        REAL_TYPE &_x3, REAL_TYPE &_x2,
+        REAL_TYPE &_x1, REAL_TYPE &_x0
+        )
+    {
+    /*------ partial products, by order of magnitude eps^k */
+        REAL_TYPE _p0, _p1, _p2, _p3, _p4, _p5 ;
+        REAL_TYPE _q0, _q1, _q2, _q3, _q4, _q5 ;
+        one_one_mul_full(_a3, _b3, _p0, _q0) ;
+
+        one_one_mul_full(_a3, _b2, _p1, _q1) ;
+        one_one_mul_full(_a2, _b3, _p2, _q2) ;
+
+        one_one_mul_full(_a3, _b1, _p3, _q3) ;
+        one_one_mul_full(_a2, _b2, _p4, _q4) ;
+        one_one_mul_full(_a1, _b3, _p5, _q5) ;
+
+    /*------ accumulate O(eps^1) and O(eps^2) terms */
+        three_one_add_full(_p1, _p2, _q0) ;
+
+        three_one_add_full(_p2, _q1, _q2) ;
+        three_one_add_full(_p3, _p4, _p5) ;
+
+        REAL_TYPE _s0, _s1, _s2, _t0, _t1 ;
+        one_one_add_full(_p2, _p3, _s0, _t0) ;
+        one_one_add_full(_q1, _p4, _s1, _t1) ;
+        _s2 = _q2 + _p5 ;
+
+        one_one_add_full(_s1, _t0, _s1, _t0) ;
+        _s2 += (_t0 + _t1) ;
+
+    /*------ O(eps^3) terms are summed in "float" only */
+        _s1 += _a3 * _b0 + _a2 * _b1
+             + _a1 * _b2 + _a0 * _b3
+             + _q0 + _q3 + _q4 + _q5 ;
+
+        five_renorm_clip(_p0, _p1, _s0, _s1, _s2,
+            _x3, _x2, _x1, _x0
+            ) ;
+    }
+
+    __inline_call void four_four_div_clip ( // qd_flt
+        REAL_TYPE  _a3, REAL_TYPE  _a2,
+        REAL_TYPE  _a1, REAL_TYPE  _a0,
+        REAL_TYPE  _b3, REAL_TYPE  _b2,
+        REAL_TYPE  _b1, REAL_TYPE  _b0,
+        REAL_TYPE &_x3, REAL_TYPE &_x2,
+        REAL_TYPE &_x1, REAL_TYPE &_x0
+        )
+    {
+    /*------ long division: q_k = r_k / b3, r -= b * q_k */
+        REAL_TYPE _qq[5] ;
+        REAL_TYPE _r3 = _a3, _r2 = _a2,
+                  _r1 = _a1, _r0 = _a0 ;
+
+        for (int _kk = 0; _kk < 4; ++_kk)
+        {
+            _qq[_kk] = _r3 / _b3 ;
+
+            REAL_TYPE _m3, _m2, _m1, _m0 ;
+            four_one_mul_clip(_b3, _b2, _b1, _b0,
+                _qq[_kk], _m3, _m2, _m1, _m0
+                ) ;
+            four_four_add_clip(_r3, _r2, _r1, _r0,
+                -_m3, -_m2, -_m1, -_m0,
+                _r3, _r2, _r1, _r0
+                ) ;
+        }
+
+        _qq[4] = _r3 / _b3 ;
+
+        five_renorm_clip(
+            _qq[0], _qq[1], _qq[2], _qq[3], _qq[4],
+            _x3, _x2, _x1, _x0
+            ) ;
+    }
+
 #   undef REAL_TYPE
 #   undef INDX_TYPE
 
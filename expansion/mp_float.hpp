@@ -24,7 +24,9 @@
      * Here, various compile-time techniques and template
      * patterns are used to build a "zero-overhead"
      * framework that doesn't require run-time stack/heap
-     * manipulation or pointer indirection.
+     * manipulation or pointer indirection. Very large
+     * expansions are the exception: these are placed in
+     * a thread-local arena to keep stack usage bounded.
      *
     --------------------------------------------------------
      *
@@ -74,19 +76,225 @@
 
     namespace mp_float {
 
+#   define  REAL_TYPE mp_float::real_type
+#   define  INDX_TYPE mp_float::indx_type
+
     /*
     --------------------------------------------------------
-     * EXPANSION: multi-precision floating-point numbers.
+     * ARENA: thread-local scratch for large expansions.
+    --------------------------------------------------------
+     *
+     * Expansions of more than MP_STACK_LIMIT floats are
+     * not placed on the stack, but are instead bump-
+     * allocated from a thread-local arena of
+     * MP_ARENA_SIZE floats. Expansions are "automatic"
+     * objects, so blocks are released in LIFO order; the
+     * arena is reset once the last live block (i.e. at
+     * the end of each predicate call) is released. Any
+     * overflow falls back to the heap.
+     *
+     * Blocks must be released on the thread that took
+     * them: a large expansion cannot be handed to (and
+     * destroyed on) another thread. This is asserted in
+     * debug builds.
+     *
     --------------------------------------------------------
      */
 
-#   define  REAL_TYPE mp_float::real_type
-#   define  INDX_TYPE mp_float::indx_type
+#   ifndef  MP_STACK_LIMIT
+#   define  MP_STACK_LIMIT    256   // max. floats on stack
+#   endif
+
+#   ifndef  MP_ARENA_SIZE
+#   define  MP_ARENA_SIZE   65536   // floats in thread arena
+#   endif
+
+    class expansion_arena
+    {
+/*-------------- a thread-local LIFO "bump" arena of REAL */
+    public  :
+    typedef REAL_TYPE           real_type;
+    typedef INDX_TYPE           indx_type;
+
+    indx_type static constexpr _size = MP_ARENA_SIZE ;
+
+    real_type                 *_base = nullptr ;
+    indx_type                  _next = 0 ;
+    indx_type                  _live = 0 ;
+
+    public  :
+/*------------------------------ _destruct and free arena */
+    __inline_call~expansion_arena (
+        )
+    {   delete [] this->_base ;
+    }
+
+/*------------------------------ per-thread arena (lazy!) */
+    __inline_call static expansion_arena& local (
+        )
+    {   thread_local expansion_arena _arena ;
+        return  _arena ;
+    }
+
+/*------------------------------ take N floats from arena */
+    __inline_call real_type* alloc (
+        indx_type  _nn
+        )
+    {
+        if (this->_base == nullptr)
+            this->_base =
+                new real_type[this->_size] ;
+
+        this->_live += +1 ;
+
+        if (this->_next + _nn <= this->_size)
+        {
+            real_type *_ptr =
+                this->_base + this->_next ;
+            this->_next += _nn ;
+            return _ptr ;
+        }
+        else                    // overflow: push to heap
+        {
+            return new real_type [_nn] ;
+        }
+    }
+
+/*------------------------------ give N floats back: LIFO */
+    __inline_call void release (
+        real_type *_ptr, indx_type _nn
+        )
+    {
+        this->_live -= +1 ;
+
+        if (_ptr <  this->_base ||
+            _ptr >= this->_base + this->_size)
+        {
+            delete [] _ptr ;
+        }
+        else
+        if (_ptr + _nn ==
+                this->_base + this->_next)
+        {
+            this->_next -= _nn ;
+        }
+
+        if (this->_live == +0)
+            this->_next  = +0 ; // reset: all released
+    }
+
+    } ;
+
+    /*
+    --------------------------------------------------------
+     * storage policy: stack for small, arena for large N
+    --------------------------------------------------------
+     */
+
+    template <
+    size_t   N ,
+    bool     L = (N > MP_STACK_LIMIT)
+             >
+    class expansion_data
+    {
+/*-------------- small expansion: allocate on local stack */
+    public  :
+    REAL_TYPE                  _xdat [ N ] ;
+
+    INDX_TYPE                  _xlen = 0 ;
+
+    public  :
+    __inline_call expansion_data (
+        )
+    {   // just default...
+    }
+
+    __inline_call expansion_data (      // live terms only
+        expansion_data const& _src
+        )
+    {   this->_xlen = _src._xlen ;
+
+        std::copy(_src._xdat ,
+            _src._xdat + _src._xlen, this->_xdat) ;
+    }
+
+    __inline_call expansion_data& operator = (
+        expansion_data const& _src
+        )
+    {   this->_xlen = _src._xlen ;
+
+        std::copy(_src._xdat ,
+            _src._xdat + _src._xlen, this->_xdat) ;
+        return *this ;
+    }
+    } ;
+
+    template <
+    size_t   N
+             >
+    class expansion_data < N, true >
+    {
+/*-------------- large expansion: alloc. in thread arena */
+    public  :
+    REAL_TYPE                 *_xdat ;
+
+    INDX_TYPE                  _xlen = 0 ;
+
+#   ifndef  NDEBUG
+    expansion_arena           *_xown ;  // owning arena
+#   endif
+
+    public  :
+    __inline_call expansion_data (
+        )
+    {   this->_xdat = expansion_arena::
+            local().alloc((INDX_TYPE) N) ;
+#   ifndef  NDEBUG
+        this->_xown = &expansion_arena::local() ;
+#   endif
+    }
+
+    __inline_call expansion_data (      // live terms only
+        expansion_data const& _src
+        ) : expansion_data()
+    {   this->_xlen = _src._xlen ;
+
+        std::copy(_src._xdat ,
+            _src._xdat + _src._xlen, this->_xdat) ;
+    }
+
+    __inline_call expansion_data& operator = (
+        expansion_data const& _src
+        )
+    {   this->_xlen = _src._xlen ;
+
+        std::copy(_src._xdat ,
+            _src._xdat + _src._xlen, this->_xdat) ;
+        return *this ;
+    }
+
+    __inline_call~expansion_data (
+        )
+    {
+        assert( this->_xown ==
+            &expansion_arena::local() &&
+            "expansion: released off-thread") ;
+
+        expansion_arena::local().
+            release(this->_xdat, (INDX_TYPE) N) ;
+    }
+    } ;
+
+    /*
+    --------------------------------------------------------
+     * EXPANSION: multi-precision floating-point numbers.
+    --------------------------------------------------------
+     */
 
     template <
     size_t   N = +1           // max. floats in expansion
              >
-    class expansion
+    class expansion : public expansion_data<N>
     {
 /*-------------- a compile-time multi-precision expansion */
     public  :
@@ -95,9 +303,6 @@
 
     indx_type static constexpr _size = N ;
 
-    real_type                  _xdat [ N ] ;
-    indx_type                  _xlen = 0 ;
-
     public  :
 /*------------------------------ initialising constructor */
     __inline_call expansion ()
@@ -145,7 +350,7 @@
         indx_type  _ii
         ) const
     {
-        assert ( _ii<= this->_size &&
+        assert ( _ii < this->_size &&
             "expansion: index out of bounds") ;
 
         return ( this->_xdat[_ii] ) ;
@@ -303,71 +508,76 @@
         REAL_TYPE _fx = _ff [0];
         INDX_TYPE _ei = +0, _fi = +0 ;
 
+        INDX_TYPE const _ne =           // explicit size guard
+            std::min(_ee._xlen, (INDX_TYPE) NE) ;
+        INDX_TYPE const _nf =
+            std::min(_ff._xlen, (INDX_TYPE) NF) ;
+
         _hh._xlen = 0;
 
         if((_fx > _ex) == (_fx > -_ex))
         {
             _qq = _ex;
-            _ex = _ee[++_ei];
+            if (++_ei < _ne) _ex = _ee[_ei];
         }
         else
         {
             _qq = _fx;
-            _fx = _ff[++_fi];
+            if (++_fi < _nf) _fx = _ff[_fi];
         }
 
-        if((_ei < _ee._xlen) && (_fi < _ff._xlen))
+        if((_ei < _ne) && (_fi < _nf))
         {
             if((_fx > _ex) == (_fx > -_ex))
             {
                 one_one_add_fast(
                     _ex, _qq, _qn, _hx);
                 _qq = _qn;
-                _ex = _ee[++_ei];
+                if (++_ei < _ne) _ex = _ee[_ei];
             }
             else
             {
                 one_one_add_fast(
                     _fx, _qq, _qn, _hx);
                 _qq = _qn;
-                _fx = _ff[++_fi];
+                if (++_fi < _nf) _fx = _ff[_fi];
             }
             if (_hx != +0.0) _hh.push (_hx) ;
 
-            while ((_ei < _ee._xlen) &&
-                   (_fi < _ff._xlen) )
+            while ((_ei < _ne) &&
+                   (_fi < _nf) )
             {
             if((_fx > _ex) == (_fx > -_ex))
             {
                 one_one_add_full(
                     _qq, _ex, _qn, _hx);
                 _qq = _qn;
-                _ex = _ee[++_ei] ;
+                if (++_ei < _ne) _ex = _ee[_ei];
             }
             else
             {
                 one_one_add_full(
                     _qq, _fx, _qn, _hx);
                 _qq = _qn;
-                _fx = _ff[++_fi] ;
+                if (++_fi < _nf) _fx = _ff[_fi];
             }
             if (_hx != +0.0) _hh.push (_hx) ;
             }
         }
 
-        while (_ei < _ee._xlen)
+        while (_ei < _ne)
         {
             one_one_add_full(_qq, _ex, _qn, _hx);
             _qq = _qn;
-            _ex = _ee[++_ei];
+            if (++_ei < _ne) _ex = _ee[_ei];
             if (_hx != +0.0) _hh.push (_hx) ;
         }
 
-        while (_fi < _ff._xlen)
+        while (_fi < _nf)
         {
             one_one_add_full(_qq, _fx, _qn, _hx);
             _qq = _qn;
-            _fx = _ff[++_fi];
+            if (++_fi < _nf) _fx = _ff[_fi];
             if (_hx != +0.0) _hh.push (_hx) ;
         }
 
@@ -479,71 +689,76 @@
         REAL_TYPE _fx =-_ff [0];
         INDX_TYPE _ei = +0, _fi = +0 ;
 
+        INDX_TYPE const _ne =           // explicit size guard
+            std::min(_ee._xlen, (INDX_TYPE) NE) ;
+        INDX_TYPE const _nf =
+            std::min(_ff._xlen, (INDX_TYPE) NF) ;
+
         _hh._xlen = 0;
 
         if((_fx > _ex) == (_fx > -_ex))
         {
             _qq = _ex;
-            _ex = _ee[++_ei];
+            if (++_ei < _ne) _ex = _ee[_ei];
         }
         else
         {
             _qq = _fx;
-            _fx =-_ff[++_fi];
+            if (++_fi < _nf) _fx =-_ff[_fi];
         }
 
-        if((_ei < _ee._xlen) && (_fi < _ff._xlen))
+        if((_ei < _ne) && (_fi < _nf))
         {
             if((_fx > _ex) == (_fx > -_ex))
             {
                 one_one_add_fast(
                     _ex, _qq, _qn, _hx);
                 _qq = _qn;
-                _ex = _ee[++_ei];
+                if (++_ei < _ne) _ex = _ee[_ei];
             }
             else
             {
                 one_one_add_fast(
                     _fx, _qq, _qn, _hx);
                 _qq = _qn;
-                _fx =-_ff[++_fi];
+                if (++_fi < _nf) _fx =-_ff[_fi];
             }
             if (_hx != +0.0) _hh.push (_hx) ;
 
-            while ((_ei < _ee._xlen) &&
-                   (_fi < _ff._xlen) )
+            while ((_ei < _ne) &&
+                   (_fi < _nf) )
             {
             if((_fx > _ex) == (_fx > -_ex))
             {
                 one_one_add_full(
                     _qq, _ex, _qn, _hx);
                 _qq = _qn;
-                _ex = _ee[++_ei] ;
+                if (++_ei < _ne) _ex = _ee[_ei];
             }
             else
             {
                 one_one_add_full(
                     _qq, _fx, _qn, _hx);
                 _qq = _qn;
-                _fx =-_ff[++_fi] ;
+                if (++_fi < _nf) _fx =-_ff[_fi];
             }
             if (_hx != +0.0) _hh.push (_hx) ;
             }
         }
 
-        while (_ei < _ee._xlen)
+        while (_ei < _ne)
         {
             one_one_add_full(_qq, _ex, _qn, _hx);
             _qq = _qn;
-            _ex = _ee[++_ei];
+            if (++_ei < _ne) _ex = _ee[_ei];
             if (_hx != +0.0) _hh.push (_hx) ;
         }
 
-        while (_fi < _ff._xlen)
+        while (_fi < _nf)
         {
             one_one_add_full(_qq, _fx, _qn, _hx);
             _qq = _qn;
-            _fx =-_ff[++_fi];
+            if (++_fi < _nf) _fx =-_ff[_fi];
             if (_hx != +0.0) _hh.push (_hx) ;
         }
 
@@ -899,6 +1114,65 @@
         }
     }
 
+    /*
+    --------------------------------------------------------
+     *
+     * Compress a multi-precision expansion, a'la shewchuk
+     *
+     * Renormalise an expansion in-place, such that all but
+     * the leading component are "small" and the result is
+     * (usually) much shorter. Zero-elimination alone only
+     * drops components that vanish, so the length of sums
+     * and products otherwise grows as that of their args.
+     *
+    --------------------------------------------------------
+     */
+
+    template <
+        size_t NN
+             >
+    __normal_call void      expansion_compress (
+        expansion <NN> & _ee
+        ) // adapted from:                         compress
+    {
+        if (_ee._xlen <= +1) return ;
+
+        REAL_TYPE _qq, _qn, _qx;
+        INDX_TYPE _bi = _ee._xlen - 1 ;
+        INDX_TYPE _ti = +0, _ii ;
+
+        _qq = _ee [_bi] ;
+        for (_ii = _ee._xlen - 2; _ii >= +0; --_ii)
+        {
+            one_one_add_fast(
+                _qq, _ee[_ii], _qn, _qx);
+
+            if (_qx != +0.0)
+            {
+                _ee[_bi--] = _qn ;
+                _qq = _qx ;
+            }
+            else
+            {
+                _qq = _qn ;
+            }
+        }
+
+        for (_ii = _bi + 1; _ii < _ee._xlen; ++_ii)
+        {
+            one_one_add_fast(
+                _ee[_ii], _qq, _qn, _qx);
+
+            if (_qx != +0.0)
+            {
+                _ee[_ti++] = _qx ;
+            }
+            _qq = _qn ;
+        }
+
+        _ee[_ti] = _qq ; _ee._xlen = _ti + 1 ;
+    }
+
     /*
     --------------------------------------------------------
      * est. of multi-precision expansion, a'la shewchuk
@@ -922,6 +1196,132 @@
         return    _rr ;
     }
 
+    /*
+    --------------------------------------------------------
+     * sgn. of multi-precision expansion, a'la shewchuk
+    --------------------------------------------------------
+     */
+
+    template <
+        size_t NN
+             >
+    __inline_call INDX_TYPE expansion_sgn (
+        expansion <NN> const& _aa
+        )
+    {   // nonoverlapping, increasing mag.: top bit wins
+        if (_aa._xlen == +0) return +0 ;
+
+        REAL_TYPE _xx = _aa[_aa._xlen - 1] ;
+
+        return (_xx > 0.) - (_xx < 0.) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Compute sgn(A + S * B), S = +1 or -1, for expansions
+     * A, B "lazily", without forming the full sum.
+     *
+     * Components are consumed from the most significant
+     * down, and accumulated in a float S with rounding
+     * error E. Since expansions are nonoverlapping and
+     * sorted by increasing magnitude, the unconsumed part
+     * of each is bounded by 2 * |top. remaining comp.|.
+     * Once |S| exceeds E + the remaining bounds the sign
+     * is known; otherwise fall back to an exact sum.
+     *
+    --------------------------------------------------------
+     */
+
+    template <
+        size_t NA, size_t NB
+             >
+    __normal_call INDX_TYPE expansion_sum_sgn (
+        expansion <NA> const& _aa ,
+        expansion <NB> const& _bb ,
+        REAL_TYPE        _sb
+        )
+    {
+        INDX_TYPE _ia = _aa._xlen - 1 ;
+        INDX_TYPE _ib = _bb._xlen - 1 ;
+        INDX_TYPE _nn = +0 ;
+
+        REAL_TYPE _ss = +0., _ee = +0.;
+        REAL_TYPE _t1, _t0, _xx, _rr ;
+
+        while (_ia >= +0 || _ib >= +0)
+        {
+            REAL_TYPE _ax = _ia >= +0 ?
+                        _aa[_ia] : (REAL_TYPE) +0. ;
+            REAL_TYPE _bx = _ib >= +0 ?
+                  _sb * _bb[_ib] : (REAL_TYPE) +0. ;
+
+            if (_ib < +0 || (_ia >= +0 &&
+                std::abs(_ax) >= std::abs(_bx)))
+            {
+                _xx = _ax; _ia -= +1 ;
+            }
+            else
+            {
+                _xx = _bx; _ib -= +1 ;
+            }
+
+            one_one_add_full(_ss, _xx, _t1, _t0) ;
+
+            _ss = _t1 ;
+            _ee+= std::abs(_t0) ;
+            _nn+= +1 ;
+
+            _rr = +0. ;                 // bound remainders
+            if (_ia >= +0)
+                _rr += std::abs(_aa[_ia]) ;
+            if (_ib >= +0)
+                _rr += std::abs(_bb[_ib]) ;
+
+            _rr = (+2. * _rr + _ee) *
+                  (+1. + (_nn + 4) * _epsilon) ;
+
+            if (std::abs(_ss) > _rr)
+            {
+                return (_ss > 0.) - (_ss < 0.) ;
+            }
+        }
+
+        if (_ee == (REAL_TYPE) +0.)     // accum. was exact
+        {
+            return (_ss > 0.) - (_ss < 0.) ;
+        }
+
+    /*------------------------ ambiguous: form exact sum */
+        expansion<add_alloc(NA, NB)> _cc ;
+        if (_sb > (REAL_TYPE) +0.)
+            expansion_add(_aa, _bb, _cc) ;
+        else
+            expansion_sub(_aa, _bb, _cc) ;
+
+        return expansion_sgn(_cc) ;
+    }
+
+    template <
+        size_t NA, size_t NB
+             >
+    __inline_call INDX_TYPE expansion_add_sgn (
+        expansion <NA> const& _aa ,
+        expansion <NB> const& _bb
+        )
+    {   return expansion_sum_sgn(_aa, _bb, +1.) ;
+    }
+
+    template <
+        size_t NA, size_t NB
+             >
+    __inline_call INDX_TYPE expansion_sub_sgn (
+        expansion <NA> const& _aa ,
+        expansion <NB> const& _bb
+        )
+    {   return expansion_sum_sgn(_aa, _bb, -1.) ;
+    }
+
     /*
     --------------------------------------------------------
      * form dot-products for multi-precision expansions
@@ -0,0 +1,525 @@
+/*
+    --------------------------------------------------------
+     * MPFLOAT: multi-precision floating-point arithmetic.
+    --------------------------------------------------------
+     *
+     * "quad-double" arithmetic. Here mp-expansion size
+     * is capped at 4, with subsequent bits truncated:
+     *
+     * Y. Hida, X. Li, and D. Bailey (2000): Quad-double
+     * arithmetic: Algorithms, implementation, and
+     * application. In the 15th IEEE Symposium on Computer
+     * Arithmetic, pp. 155-162.
+     *
+     * Sums use the "accurate" (merge-based) algorithm, so
+     * that relative error is bounded even with heavy
+     * cancellation, giving ~4 x 53 bits (~2^-208) overall.
+     *
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __QD_FLOAT__
+#   define __QD_FLOAT__
+
+#   include "mp_basic.hpp"
+#   include "dd_float.hpp"
+
+//  namespace mp_float {                    // hmmm no...
+
+    /*
+    --------------------------------------------------------
+     * QD_FLT: (quad-double) precision numbers
+    --------------------------------------------------------
+     */
+
+#   define  REAL_TYPE mp_float::real_type
+#   define  INDX_TYPE mp_float::indx_type
+
+    class qd_flt;
+
+    __inline_call qd_flt operator + (       // fwd. dec's
+        qd_flt const&,
+        REAL_TYPE    ) ;
+    __inline_call qd_flt operator + (
+        REAL_TYPE    ,
+        qd_flt const&) ;
+    __inline_call qd_flt operator + (
+        qd_flt const&,
+        qd_flt const&) ;
+
+    __inline_call qd_flt operator - (
+        qd_flt const&,
+        REAL_TYPE    ) ;
+    __inline_call qd_flt operator - (
+        REAL_TYPE    ,
+        qd_flt const&) ;
+    __inline_call qd_flt operator - (
+        qd_flt const&,
+        qd_flt const&) ;
+
+    __inline_call qd_flt operator * (
+        qd_flt const&,
+        REAL_TYPE    ) ;
+    __inline_call qd_flt operator * (
+        REAL_TYPE    ,
+        qd_flt const&) ;
+    __inline_call qd_flt operator * (
+        qd_flt const&,
+        qd_flt const&) ;
+
+    __inline_call qd_flt operator / (
+        qd_flt const&,
+        REAL_TYPE    ) ;
+    __inline_call qd_flt operator / (
+        REAL_TYPE    ,
+        qd_flt const&) ;
+    __inline_call qd_flt operator / (
+        qd_flt const&,
+        qd_flt const&) ;
+
+    class qd_flt
+    {
+/*------------------------------ quad-double number type */
+    public  :
+    typedef REAL_TYPE           real_type;
+    typedef INDX_TYPE           indx_type;
+
+    indx_type static constexpr _size = 4 ;
+    indx_type static constexpr _xlen = 4 ;
+
+    real_type                  _xdat [ 4 ] ;
+
+    public  :
+/*------------------------------ access to expansion bits */
+    __inline_call real_type&      operator[] (
+        indx_type _ii
+        )
+    {   return this->_xdat[_ii] ;
+    }
+    __inline_call real_type const&operator[] (
+        indx_type _ii
+        ) const
+    {   return this->_xdat[_ii] ;
+    }
+
+    __inline_call real_type&      hi (
+        )
+    {   return this->_xdat[3] ;
+    }
+    __inline_call real_type const&hi (
+        ) const
+    {   return this->_xdat[3] ;
+    }
+
+/*------------------------------ initialising constructor */
+    __inline_call qd_flt (
+        real_type _x3 = real_type(+0.) ,
+        real_type _x2 = real_type(+0.) ,
+        real_type _x1 = real_type(+0.) ,
+        real_type _x0 = real_type(+0.)
+        )
+    {   this->_xdat[0] = _x0 ;
+        this->_xdat[1] = _x1 ;
+        this->_xdat[2] = _x2 ;
+        this->_xdat[3] = _x3 ;
+    }
+
+    __inline_call qd_flt (                  // from dd_flt
+        dd_flt const& _aa
+        )
+    {   this->_xdat[0] = +0. ;
+        this->_xdat[1] = +0. ;
+        this->_xdat[2] = _aa.lo();
+        this->_xdat[3] = _aa.hi();
+    }
+
+    __inline_call qd_flt (                  // copy c'tor
+        qd_flt const& _aa
+        )
+    {
+        this->_xdat[0] = _aa[0];
+        this->_xdat[1] = _aa[1];
+        this->_xdat[2] = _aa[2];
+        this->_xdat[3] = _aa[3];
+    }
+
+    __inline_call qd_flt& operator = (      // assignment
+        qd_flt const& _aa
+        )
+    {
+        this->_xdat[0] = _aa[0];
+        this->_xdat[1] = _aa[1];
+        this->_xdat[2] = _aa[2];
+        this->_xdat[3] = _aa[3];
+
+        return ( *this ) ;
+    }
+    __inline_call qd_flt& operator = (      // assignment
+        real_type _aa
+        )
+    {
+        this->_xdat[0] = +0. ;
+        this->_xdat[1] = +0. ;
+        this->_xdat[2] = +0. ;
+        this->_xdat[3] = (real_type)_aa;
+
+        return ( *this ) ;
+    }
+
+/*---------------------------------------- cast operators */
+    __inline_call operator real_type (
+        ) const
+    {   return (real_type)(_xdat[3] + _xdat[2]) ;
+    }
+
+    __inline_call operator indx_type (
+        ) const
+    {   return (indx_type)(_xdat[3] + _xdat[2]) ;
+    }
+
+    __inline_call dd_flt to_dd (            // truncate
+        ) const
+    {
+        REAL_TYPE _x1, _x0 ;
+        mp_float::one_one_add_fast(
+            _xdat[3], _xdat[2] + _xdat[1], _x1, _x0) ;
+
+        return ( dd_flt(_x1, _x0) ) ;
+    }
+
+/*---------------------------------------- math operators */
+    __inline_call qd_flt  operator + (
+        ) const
+    {   return ( *this ) ;
+    }
+
+    __inline_call qd_flt  operator - (
+        ) const
+    {   return   qd_flt(-_xdat[3], -_xdat[2],
+                        -_xdat[1], -_xdat[0]) ;
+    }
+
+/*------------------------------ helper: init. from a + b */
+    __inline_call void from_add (
+        real_type  _aa, real_type  _bb
+        )
+    {
+        this->_xdat[0] = +0. ;
+        this->_xdat[1] = +0. ;
+        mp_float::one_one_add_full(_aa, _bb,
+            this->_xdat[3],
+            this->_xdat[2]) ;
+    }
+
+/*------------------------------ helper: init. from a - b */
+    __inline_call void from_sub (
+        real_type  _aa, real_type  _bb
+        )
+    {
+        this->_xdat[0] = +0. ;
+        this->_xdat[1] = +0. ;
+        mp_float::one_one_sub_full(_aa, _bb,
+            this->_xdat[3],
+            this->_xdat[2]) ;
+    }
+
+/*------------------------------ helper: init. from a * a */
+    __inline_call void from_sqr (
+        real_type  _aa
+        )
+    {
+        this->_xdat[0] = +0. ;
+        this->_xdat[1] = +0. ;
+        mp_float::one_one_sqr_full(_aa,
+            this->_xdat[3],
+            this->_xdat[2]) ;
+    }
+
+/*------------------------------ helper: init. from a * b */
+    __inline_call void from_mul (
+        real_type  _aa, real_type  _bb
+        )
+    {
+        this->_xdat[0] = +0. ;
+        this->_xdat[1] = +0. ;
+        mp_float::one_one_mul_full(_aa, _bb,
+            this->_xdat[3],
+            this->_xdat[2]) ;
+    }
+
+    __inline_call qd_flt& operator+= (      // via double
+        real_type _aa
+        )
+    {   return ( *this = *this + _aa ) ;
+    }
+    __inline_call qd_flt& operator-= (
+        real_type _aa
+        )
+    {   return ( *this = *this - _aa ) ;
+    }
+    __inline_call qd_flt& operator*= (
+        real_type _aa
+        )
+    {   return ( *this = *this * _aa ) ;
+    }
+    __inline_call qd_flt& operator/= (
+        real_type _aa
+        )
+    {   return ( *this = *this / _aa ) ;
+    }
+
+    __inline_call qd_flt& operator+= (      // via qd_flt
+        qd_flt const& _aa
+        )
+    {   return ( *this = *this + _aa ) ;
+    }
+    __inline_call qd_flt& operator-= (
+        qd_flt const& _aa
+        )
+    {   return ( *this = *this - _aa ) ;
+    }
+    __inline_call qd_flt& operator*= (
+        qd_flt const& _aa
+        )
+    {   return ( *this = *this * _aa ) ;
+    }
+    __inline_call qd_flt& operator/= (
+        qd_flt const& _aa
+        )
+    {   return ( *this = *this / _aa ) ;
+    }
+
+    } ;
+
+    /*
+    --------------------------------------------------------
+     * quad-double a + b operators
+    --------------------------------------------------------
+     */
+
+    __inline_call qd_flt operator + (
+        qd_flt const& _aa,
+        REAL_TYPE     _bb
+        )
+    {
+        qd_flt _xx ;
+        mp_float::four_one_add_clip(
+            _aa[3], _aa[2], _aa[1], _aa[0], _bb,
+            _xx[3], _xx[2], _xx[1], _xx[0]
+            ) ;
+
+        return ( _xx ) ;
+    }
+
+    __inline_call qd_flt operator + (
+        REAL_TYPE     _aa,
+        qd_flt const& _bb
+        )
+    {   return ( +(_bb + _aa) ) ;
+    }
+
+    __inline_call qd_flt operator + (
+        qd_flt const& _aa,
+        qd_flt const& _bb
+        )
+    {
+        qd_flt _xx ;
+        mp_float::four_four_add_clip(
+            _aa[3], _aa[2], _aa[1], _aa[0],
+            _bb[3], _bb[2], _bb[1], _bb[0],
+            _xx[3], _xx[2], _xx[1], _xx[0]
+            ) ;
+
+        return ( _xx ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * quad-double a - b operators
+    --------------------------------------------------------
+     */
+
+    __inline_call qd_flt operator - (
+        qd_flt const& _aa,
+        REAL_TYPE     _bb
+        )
+    {   return ( _aa + (-_bb) ) ;
+    }
+
+    __inline_call qd_flt operator - (
+        REAL_TYPE     _aa,
+        qd_flt const& _bb
+        )
+    {   return ( -(_bb - _aa) ) ;
+    }
+
+    __inline_call qd_flt operator - (
+        qd_flt const& _aa,
+        qd_flt const& _bb
+        )
+    {   return ( _aa + (-_bb) ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * quad-double a * b operators
+    --------------------------------------------------------
+     */
+
+    __inline_call qd_flt operator * (
+        qd_flt const& _aa,
+        REAL_TYPE     _bb
+        )
+    {
+        qd_flt _xx ;
+        mp_float::four_one_mul_clip(
+            _aa[3], _aa[2], _aa[1], _aa[0], _bb,
+            _xx[3], _xx[2], _xx[1], _xx[0]
+            ) ;
+
+        return ( _xx ) ;
+    }
+
+    __inline_call qd_flt operator * (
+        REAL_TYPE     _aa,
+        qd_flt const& _bb
+        )
+    {   return ( _bb * _aa ) ;
+    }
+
+    __inline_call qd_flt operator * (
+        qd_flt const& _aa,
+        qd_flt const& _bb
+        )
+    {
+        qd_flt _xx ;
+        mp_float::four_four_mul_clip(
+            _aa[3], _aa[2], _aa[1], _aa[0],
+            _bb[3], _bb[2], _bb[1], _bb[0],
+            _xx[3], _xx[2], _xx[1], _xx[0]
+            ) ;
+
+        return ( _xx ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * quad-double a / b operators
+    --------------------------------------------------------
+     */
+
+    __inline_call qd_flt operator / (
+        qd_flt const& _aa,
+        REAL_TYPE     _bb
+        )
+    {   return ( _aa / qd_flt(_bb) ) ;
+    }
+
+    __inline_call qd_flt operator / (
+        REAL_TYPE     _aa,
+        qd_flt const& _bb
+        )
+    {   return ( qd_flt(_aa) / _bb ) ;
+    }
+
+    __inline_call qd_flt operator / (
+        qd_flt const& _aa,
+        qd_flt const& _bb
+        )
+    {
+        qd_flt _xx ;
+        mp_float::four_four_div_clip(
+            _aa[3], _aa[2], _aa[1], _aa[0],
+            _bb[3], _bb[2], _bb[1], _bb[0],
+            _xx[3], _xx[2], _xx[1], _xx[0]
+            ) ;
+
+        return ( _xx ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * quad-double equal operators
+    --------------------------------------------------------
+     */
+
+    __inline_call  bool operator == (
+        qd_flt const& _aa,
+        qd_flt const& _bb
+        )
+    {   return _aa[3] == _bb[3] && _aa[2] == _bb[2] &&
+               _aa[1] == _bb[1] && _aa[0] == _bb[0] ;
+    }
+
+    __inline_call  bool operator != (
+        qd_flt const& _aa,
+        qd_flt const& _bb
+        )
+    {   return !(_aa == _bb) ;
+    }
+
+    __inline_call  bool operator <  (
+        qd_flt const& _aa,
+        qd_flt const& _bb
+        )
+    {   return _aa[3] != _bb[3] ? _aa[3] < _bb[3] :
+               _aa[2] != _bb[2] ? _aa[2] < _bb[2] :
+               _aa[1] != _bb[1] ? _aa[1] < _bb[1] :
+                                  _aa[0] < _bb[0] ;
+    }
+
+    __inline_call  bool operator >  (
+        qd_flt const& _aa,
+        qd_flt const& _bb
+        )
+    {   return ( _bb < _aa ) ;
+    }
+
+#   undef REAL_TYPE
+#   undef INDX_TYPE
+
+
+//  }
+
+#   endif//__QD_FLOAT__
+
+
+
@@ -50,6 +50,15 @@
 #   include "mpfloats.hpp"
 
 #   include <cmath>
+#   include <limits>
+#   include <atomic>
+#   include <condition_variable>
+#   include <cstdint>
+#   include <memory>
+#   include <mutex>
+#   include <thread>
+#   include <type_traits>
+#   include <vector>
 
 #   include "predicate/predicate_k.hpp"
 
@@ -57,10 +57,13 @@
 #   include <algorithm>
 #   include <cmath>
 #   include <cfenv>
+#   include <limits>
 
 //  pragma STDC FENV_ACCESS ON
 
 #   include "expansion/dd_float.hpp"
+#   include "expansion/dd_vector.hpp"
+#   include "expansion/qd_float.hpp"
 #   include "expansion/ia_float.hpp"
 #   include "expansion/mp_float.hpp"
 
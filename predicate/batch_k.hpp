@@ -0,0 +1,497 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 16 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Batched predicates, evaluating the "float" filters
+     * over blocks of inputs in structure-of-arrays form.
+     *
+     * The filters are written as branch-free loops over
+     * contiguous lanes, so that they auto-vectorise to
+     * SSE/AVX/NEON at -O3 (with -march=native, etc), in
+     * place of hand-written intrinsics per ISA. Lanes
+     * that fail the filter are compacted and passed on to
+     * the scalar interval/exact kernels. Inputs are either
+     * SoA coordinate buffers, or a point array (xy / xyz
+     * per point) plus an index array of simplices.
+     *
+    --------------------------------------------------------
+     */
+
+#   ifndef  BATCH_BLOCK_SIZE
+#   define  BATCH_BLOCK_SIZE  128   // lanes per filter block
+#   endif
+
+    /*--------------- is filter result FT < |S| "normal"? */
+
+    __inline_call bool_type batch_pass (
+        REAL_TYPE  _sgn ,
+        REAL_TYPE  _FT
+        )
+    {
+        REAL_TYPE _SGN = std::abs (_sgn) ;
+
+        return (_SGN > _FT) &
+               (_SGN >= std::numeric_limits<
+                        REAL_TYPE>::min())  &
+               (_SGN <= std::numeric_limits<
+                        REAL_TYPE>::max())  ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * ORIENT-2D: batched orientation test in E^2.
+    --------------------------------------------------------
+     */
+
+    __normal_call void orient2d_f_block (
+        size_t     _nb ,
+      __const_ptr(REAL_TYPE) _ax ,
+      __const_ptr(REAL_TYPE) _ay ,
+      __const_ptr(REAL_TYPE) _bx ,
+      __const_ptr(REAL_TYPE) _by ,
+      __const_ptr(REAL_TYPE) _cx ,
+      __const_ptr(REAL_TYPE) _cy ,
+      __write_ptr(REAL_TYPE) _rr ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- orient2d predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+        +  4. * mp::_epsilon ;
+
+        for (size_t _ii = +0; _ii < _nb; ++_ii)
+        {
+        REAL_TYPE _acx, _acy ;
+        REAL_TYPE _bcx, _bcy ;
+        REAL_TYPE _acxbcy, _acybcx ;
+
+        REAL_TYPE _sgn, _FT;
+
+        _acx = _ax [_ii] - _cx [_ii] ;    // coord. diff.
+        _acy = _ay [_ii] - _cy [_ii] ;
+
+        _bcx = _bx [_ii] - _cx [_ii] ;
+        _bcy = _by [_ii] - _cy [_ii] ;
+
+        _acxbcy = _acx * _bcy ;
+        _acybcx = _acy * _bcx ;
+
+        _FT  = std::abs (_acxbcy)         // roundoff tol
+             + std::abs (_acybcx) ;
+        _FT *= _ER ;
+
+        _sgn = _acxbcy - _acybcx ;        // 2 x 2 result
+
+        _rr[_ii] = _sgn ;
+        _OK[_ii] = batch_pass(_sgn, _FT) ;
+        }
+    }
+
+    __inline_call REAL_TYPE orient2d_tail (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc
+        )
+    {
+    /*--------------- orient2d predicate, after filtering */
+        REAL_TYPE _rr;
+        bool_type _OK;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(ORIENT2D_i);
+
+        _rr = orient2d_i(               // "bound" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(ORIENT2D_d);
+
+        _rr = orient2d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(ORIENT2D_e);
+
+        _rr = orient2d_e(               // "exact" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+
+        return (REAL_TYPE) +0.0E+00;
+    }
+
+    __normal_call void orient2d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _ax ,
+      __const_ptr(REAL_TYPE) _ay ,
+      __const_ptr(REAL_TYPE) _bx ,
+      __const_ptr(REAL_TYPE) _by ,
+      __const_ptr(REAL_TYPE) _cx ,
+      __const_ptr(REAL_TYPE) _cy ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ orient2d predicate, "batched" SoA form */
+        size_t    _ix[BATCH_BLOCK_SIZE] ;
+        bool_type _OK[BATCH_BLOCK_SIZE] ;
+
+        for (size_t _i0 = +0; _i0 < _nn;
+                _i0 += BATCH_BLOCK_SIZE)
+        {
+            size_t _nb = std::min (
+                (size_t)BATCH_BLOCK_SIZE, _nn - _i0) ;
+
+            __kernel_tock(ORIENT2D_f, _nb);
+
+            orient2d_f_block(_nb,
+                _ax + _i0, _ay + _i0,
+                _bx + _i0, _by + _i0,
+                _cx + _i0, _cy + _i0,
+                _rr + _i0, _OK) ;
+
+            size_t _nf = +0 ;           // compact failures
+            for (size_t _ii = +0; _ii < _nb; ++_ii)
+            {
+                _ix[_nf] = _ii ; _nf += !_OK[_ii] ;
+            }
+
+            for (size_t _jj = +0; _jj < _nf; ++_jj)
+            {
+                size_t _kk = _i0 + _ix[_jj] ;
+
+                REAL_TYPE _pa[2] = {_ax[_kk], _ay[_kk]} ;
+                REAL_TYPE _pb[2] = {_bx[_kk], _by[_kk]} ;
+                REAL_TYPE _pc[2] = {_cx[_kk], _cy[_kk]} ;
+
+                _rr[_kk] = orient2d_tail(_pa, _pb, _pc) ;
+            }
+        }
+    }
+
+    __normal_call void orient2d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __const_ptr(INDX_TYPE) _tt ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ orient2d predicate, "batched" xy + tri */
+        REAL_TYPE _ax[BATCH_BLOCK_SIZE] ,
+                  _ay[BATCH_BLOCK_SIZE] ,
+                  _bx[BATCH_BLOCK_SIZE] ,
+                  _by[BATCH_BLOCK_SIZE] ,
+                  _cx[BATCH_BLOCK_SIZE] ,
+                  _cy[BATCH_BLOCK_SIZE] ;
+
+        for (size_t _i0 = +0; _i0 < _nn;
+                _i0 += BATCH_BLOCK_SIZE)
+        {
+            size_t _nb = std::min (
+                (size_t)BATCH_BLOCK_SIZE, _nn - _i0) ;
+
+            for (size_t _ii = +0; _ii < _nb; ++_ii)
+            {                           // gather into SoA
+                __const_ptr(INDX_TYPE) _ti =
+                    _tt + (_i0 + _ii) * 3 ;
+
+                _ax[_ii] = _pp[_ti[0] * 2 + 0] ;
+                _ay[_ii] = _pp[_ti[0] * 2 + 1] ;
+                _bx[_ii] = _pp[_ti[1] * 2 + 0] ;
+                _by[_ii] = _pp[_ti[1] * 2 + 1] ;
+                _cx[_ii] = _pp[_ti[2] * 2 + 0] ;
+                _cy[_ii] = _pp[_ti[2] * 2 + 1] ;
+            }
+
+            orient2d_batch(_nb,
+                _ax, _ay, _bx, _by, _cx, _cy,
+                _rr + _i0) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * ORIENT-3D: batched orientation test in E^3.
+    --------------------------------------------------------
+     */
+
+    __normal_call void orient3d_f_block (
+        size_t     _nb ,
+      __const_ptr(REAL_TYPE) _ax ,
+      __const_ptr(REAL_TYPE) _ay ,
+      __const_ptr(REAL_TYPE) _az ,
+      __const_ptr(REAL_TYPE) _bx ,
+      __const_ptr(REAL_TYPE) _by ,
+      __const_ptr(REAL_TYPE) _bz ,
+      __const_ptr(REAL_TYPE) _cx ,
+      __const_ptr(REAL_TYPE) _cy ,
+      __const_ptr(REAL_TYPE) _cz ,
+      __const_ptr(REAL_TYPE) _dx ,
+      __const_ptr(REAL_TYPE) _dy ,
+      __const_ptr(REAL_TYPE) _dz ,
+      __write_ptr(REAL_TYPE) _rr ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- orient3d predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+        +  8. * mp::_epsilon ;
+
+        for (size_t _ii = +0; _ii < _nb; ++_ii)
+        {
+        REAL_TYPE _adx, _ady, _adz ,
+                  _bdx, _bdy, _bdz ,
+                  _cdx, _cdy, _cdz ;
+        REAL_TYPE _bdxcdy, _cdxbdy ,
+                  _cdxady, _adxcdy ,
+                  _adxbdy, _bdxady ;
+
+        REAL_TYPE _sgn, _FT;
+
+        _adx = _ax [_ii] - _dx [_ii] ;    // coord. diff.
+        _ady = _ay [_ii] - _dy [_ii] ;
+        _adz = _az [_ii] - _dz [_ii] ;
+
+        _bdx = _bx [_ii] - _dx [_ii] ;
+        _bdy = _by [_ii] - _dy [_ii] ;
+        _bdz = _bz [_ii] - _dz [_ii] ;
+
+        _cdx = _cx [_ii] - _dx [_ii] ;
+        _cdy = _cy [_ii] - _dy [_ii] ;
+        _cdz = _cz [_ii] - _dz [_ii] ;
+
+        _bdxcdy = _bdx * _cdy ;           // 2 x 2 minors
+        _cdxbdy = _cdx * _bdy ;
+        _cdxady = _cdx * _ady ;
+        _adxcdy = _adx * _cdy ;
+        _adxbdy = _adx * _bdy ;
+        _bdxady = _bdx * _ady ;
+
+        _FT  =                            // roundoff tol
+          std::abs(_adz) * (std::abs(_bdxcdy)
+                          + std::abs(_cdxbdy))
+        + std::abs(_bdz) * (std::abs(_cdxady)
+                          + std::abs(_adxcdy))
+        + std::abs(_cdz) * (std::abs(_adxbdy)
+                          + std::abs(_bdxady)) ;
+
+        _FT *= _ER ;
+
+        _sgn =                            // 3 x 3 result
+          _adz * (_bdxcdy - _cdxbdy)
+        + _bdz * (_cdxady - _adxcdy)
+        + _cdz * (_adxbdy - _bdxady) ;
+
+        _rr[_ii] = _sgn ;
+        _OK[_ii] = batch_pass(_sgn, _FT) ;
+        }
+    }
+
+    __inline_call REAL_TYPE orient3d_tail (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+    /*--------------- orient3d predicate, after filtering */
+        REAL_TYPE _rr;
+        bool_type _OK;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(ORIENT3D_i);
+
+        _rr = orient3d_i(               // "bound" kernel
+            _pa, _pb, _pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(ORIENT3D_d);
+
+        _rr = orient3d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(ORIENT3D_e);
+
+        _rr = orient3d_e(               // "exact" kernel
+            _pa, _pb, _pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+
+        return (REAL_TYPE) +0.0E+00;
+    }
+
+    __normal_call void orient3d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _ax ,
+      __const_ptr(REAL_TYPE) _ay ,
+      __const_ptr(REAL_TYPE) _az ,
+      __const_ptr(REAL_TYPE) _bx ,
+      __const_ptr(REAL_TYPE) _by ,
+      __const_ptr(REAL_TYPE) _bz ,
+      __const_ptr(REAL_TYPE) _cx ,
+      __const_ptr(REAL_TYPE) _cy ,
+      __const_ptr(REAL_TYPE) _cz ,
+      __const_ptr(REAL_TYPE) _dx ,
+      __const_ptr(REAL_TYPE) _dy ,
+      __const_ptr(REAL_TYPE) _dz ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ orient3d predicate, "batched" SoA form */
+        size_t    _ix[BATCH_BLOCK_SIZE] ;
+        bool_type _OK[BATCH_BLOCK_SIZE] ;
+
+        for (size_t _i0 = +0; _i0 < _nn;
+                _i0 += BATCH_BLOCK_SIZE)
+        {
+            size_t _nb = std::min (
+                (size_t)BATCH_BLOCK_SIZE, _nn - _i0) ;
+
+            __kernel_tock(ORIENT3D_f, _nb);
+
+            orient3d_f_block(_nb,
+                _ax + _i0, _ay + _i0, _az + _i0,
+                _bx + _i0, _by + _i0, _bz + _i0,
+                _cx + _i0, _cy + _i0, _cz + _i0,
+                _dx + _i0, _dy + _i0, _dz + _i0,
+                _rr + _i0, _OK) ;
+
+            size_t _nf = +0 ;           // compact failures
+            for (size_t _ii = +0; _ii < _nb; ++_ii)
+            {
+                _ix[_nf] = _ii ; _nf += !_OK[_ii] ;
+            }
+
+            for (size_t _jj = +0; _jj < _nf; ++_jj)
+            {
+                size_t _kk = _i0 + _ix[_jj] ;
+
+                REAL_TYPE _pa[3] = {
+                    _ax[_kk], _ay[_kk], _az[_kk]} ;
+                REAL_TYPE _pb[3] = {
+                    _bx[_kk], _by[_kk], _bz[_kk]} ;
+                REAL_TYPE _pc[3] = {
+                    _cx[_kk], _cy[_kk], _cz[_kk]} ;
+                REAL_TYPE _pd[3] = {
+                    _dx[_kk], _dy[_kk], _dz[_kk]} ;
+
+                _rr[_kk] =
+                    orient3d_tail(_pa, _pb, _pc, _pd) ;
+            }
+        }
+    }
+
+    __normal_call void orient3d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __const_ptr(INDX_TYPE) _tt ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ orient3d predicate, "batched" xyz + tet */
+        REAL_TYPE _ax[BATCH_BLOCK_SIZE] ,
+                  _ay[BATCH_BLOCK_SIZE] ,
+                  _az[BATCH_BLOCK_SIZE] ,
+                  _bx[BATCH_BLOCK_SIZE] ,
+                  _by[BATCH_BLOCK_SIZE] ,
+                  _bz[BATCH_BLOCK_SIZE] ,
+                  _cx[BATCH_BLOCK_SIZE] ,
+                  _cy[BATCH_BLOCK_SIZE] ,
+                  _cz[BATCH_BLOCK_SIZE] ,
+                  _dx[BATCH_BLOCK_SIZE] ,
+                  _dy[BATCH_BLOCK_SIZE] ,
+                  _dz[BATCH_BLOCK_SIZE] ;
+
+        for (size_t _i0 = +0; _i0 < _nn;
+                _i0 += BATCH_BLOCK_SIZE)
+        {
+            size_t _nb = std::min (
+                (size_t)BATCH_BLOCK_SIZE, _nn - _i0) ;
+
+            for (size_t _ii = +0; _ii < _nb; ++_ii)
+            {                           // gather into SoA
+                __const_ptr(INDX_TYPE) _ti =
+                    _tt + (_i0 + _ii) * 4 ;
+
+                _ax[_ii] = _pp[_ti[0] * 3 + 0] ;
+                _ay[_ii] = _pp[_ti[0] * 3 + 1] ;
+                _az[_ii] = _pp[_ti[0] * 3 + 2] ;
+                _bx[_ii] = _pp[_ti[1] * 3 + 0] ;
+                _by[_ii] = _pp[_ti[1] * 3 + 1] ;
+                _bz[_ii] = _pp[_ti[1] * 3 + 2] ;
+                _cx[_ii] = _pp[_ti[2] * 3 + 0] ;
+                _cy[_ii] = _pp[_ti[2] * 3 + 1] ;
+                _cz[_ii] = _pp[_ti[2] * 3 + 2] ;
+                _dx[_ii] = _pp[_ti[3] * 3 + 0] ;
+                _dy[_ii] = _pp[_ti[3] * 3 + 1] ;
+                _dz[_ii] = _pp[_ti[3] * 3 + 2] ;
+            }
+
+            orient3d_batch(_nb,
+                _ax, _ay, _az, _bx, _by, _bz,
+                _cx, _cy, _cz, _dx, _dy, _dz,
+                _rr + _i0) ;
+        }
+    }
+
+
@@ -96,6 +96,50 @@
         return mp::expansion_est(_absum_) ;
     }
 
+    __normal_call REAL_TYPE bisect2d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- bisect2d predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        +  5. * _dd_eps ;
+
+        dd_flt    _acx, _acy;
+        dd_flt    _bcx, _bcy;
+        dd_flt    _acsqr, _bcsqr ;
+
+        dd_flt    _sgn ;
+        REAL_TYPE _FT ;
+
+        REAL_TYPE _ACSQR, _BCSQR ;
+
+        _acx.from_sub(_pa[0], _pc[0]) ;   // coord. diff.
+        _acy.from_sub(_pa[1], _pc[1]) ;
+
+        _bcx.from_sub(_pb[0], _pc[0]) ;
+        _bcy.from_sub(_pb[1], _pc[1]) ;
+
+        _acsqr = _acx * _acx +
+                 _acy * _acy ;
+        _bcsqr = _bcx * _bcx +
+                 _bcy * _bcy ;
+
+        _ACSQR = std::abs(_acsqr.hi());
+        _BCSQR = std::abs(_bcsqr.hi());
+
+        _FT  = _ACSQR + _BCSQR ;          // roundoff tol
+        _FT *= _ER  ;
+
+        _sgn = _acsqr - _bcsqr ;          // d_ab - d_bc
+
+        _OK  = _sgn.hi() > +_FT || _sgn.hi() < -_FT ;
+
+        return _sgn.hi() ;
+    }
+
     __normal_call REAL_TYPE bisect2d_i (
       __const_ptr(REAL_TYPE) _pa ,
       __const_ptr(REAL_TYPE) _pb ,
@@ -108,8 +152,6 @@
                   _bcx, _bcy,
                   _abx, _aby, _sgn;
 
-        ia_rnd    _rnd;                   // up rounding!
-
         _abx.from_sub(_pa[0], _pb[0]) ;   // coord. diff.
         _aby.from_sub(_pa[1], _pb[1]) ;
 
@@ -123,8 +165,10 @@
              + (_aby * (_acy + _bcy)) ;
 
         _OK  =
-           _sgn.lo() >= (REAL_TYPE)0.
-        || _sgn.up() <= (REAL_TYPE)0. ;
+           _sgn.lo() >  (REAL_TYPE)0.
+        || _sgn.up() <  (REAL_TYPE)0.
+        || (_sgn.lo() == (REAL_TYPE)0. &&
+            _sgn.up() == (REAL_TYPE)0.) ;
 
         return ( _sgn.mid () ) ;
     }
@@ -137,8 +181,8 @@
         )
     {
     /*--------------- bisect2d predicate, "float" version */
-        REAL_TYPE static const _ER =
-        +  5. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        +  5. * mp::_epsilon ;
 
         REAL_TYPE _acx, _acy;
         REAL_TYPE _bcx, _bcy;
@@ -230,6 +274,56 @@
         return mp::expansion_est(_absum_) ;
     }
 
+    __normal_call REAL_TYPE bisect2w_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- bisect2w predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        +  6. * _dd_eps ;
+
+        dd_flt    _acx, _acy;
+        dd_flt    _bcx, _bcy;
+        dd_flt    _acsqr, _bcsqr ;
+        dd_flt    _a_sum, _b_sum ;
+
+        REAL_TYPE _A_SUM, _B_SUM ;
+
+        dd_flt    _sgn ;
+        REAL_TYPE _FT ;
+
+        _acx.from_sub(_pa[0], _pc[0]) ;   // coord. diff.
+        _acy.from_sub(_pa[1], _pc[1]) ;
+
+        _bcx.from_sub(_pb[0], _pc[0]) ;
+        _bcy.from_sub(_pb[1], _pc[1]) ;
+
+        _acsqr = _acx * _acx +
+                 _acy * _acy ;
+        _bcsqr = _bcx * _bcx +
+                 _bcy * _bcy ;
+
+        _a_sum = _acsqr - _pa[2] ;
+        _b_sum = _bcsqr - _pb[2] ;
+
+        _A_SUM = std::abs(_acsqr.hi())
+               + std::abs(_pa[2]);
+        _B_SUM = std::abs(_bcsqr.hi())
+               + std::abs(_pb[2]);
+
+        _FT  = _A_SUM + _B_SUM ;          // roundoff tol
+        _FT *= _ER ;
+
+        _sgn = _a_sum - _b_sum ;          // d_ab - d_bc
+
+        _OK  = _sgn.hi() > +_FT || _sgn.hi() < -_FT ;
+
+        return _sgn.hi() ;
+    }
+
     __normal_call REAL_TYPE bisect2w_i (
       __const_ptr(REAL_TYPE) _pa ,
       __const_ptr(REAL_TYPE) _pb ,
@@ -242,8 +336,6 @@
                   _bcx, _bcy,
                   _abx, _aby, _sgn;
 
-        ia_rnd    _rnd;                   // up rounding!
-
         _abx.from_sub(_pa[0], _pb[0]) ;   // coord. diff.
         _aby.from_sub(_pa[1], _pb[1]) ;
         _abw.from_sub(_pa[2], _pb[2]) ;
@@ -260,8 +352,10 @@
         _sgn-=  _abw ;
 
         _OK  =
-           _sgn.lo() >= (REAL_TYPE)0.
-        || _sgn.up() <= (REAL_TYPE)0. ;
+           _sgn.lo() >  (REAL_TYPE)0.
+        || _sgn.up() <  (REAL_TYPE)0.
+        || (_sgn.lo() == (REAL_TYPE)0. &&
+            _sgn.up() == (REAL_TYPE)0.) ;
 
         return ( _sgn.mid () ) ;
     }
@@ -274,8 +368,8 @@
         )
     {
     /*--------------- bisect2w predicate, "float" version */
-        REAL_TYPE static const _ER =
-        +  6. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        +  6. * mp::_epsilon ;
 
         REAL_TYPE _acx, _acy;
         REAL_TYPE _bcx, _bcy;
@@ -377,6 +471,54 @@
         return mp::expansion_est(_absum_) ;
     }
 
+    __normal_call REAL_TYPE bisect3d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- bisect3d predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        +  6. * _dd_eps ;
+
+        dd_flt    _acx, _acy, _acz ;
+        dd_flt    _bcx, _bcy, _bcz ;
+        dd_flt    _acsqr, _bcsqr ;
+
+        dd_flt    _sgn ;
+        REAL_TYPE _FT ;
+
+        REAL_TYPE _ACSQR, _BCSQR ;
+
+        _acx.from_sub(_pa[0], _pc[0]) ;   // coord. diff.
+        _acy.from_sub(_pa[1], _pc[1]) ;
+        _acz.from_sub(_pa[2], _pc[2]) ;
+
+        _bcx.from_sub(_pb[0], _pc[0]) ;
+        _bcy.from_sub(_pb[1], _pc[1]) ;
+        _bcz.from_sub(_pb[2], _pc[2]) ;
+
+        _acsqr = _acx * _acx +
+                 _acy * _acy +
+                 _acz * _acz ;
+        _bcsqr = _bcx * _bcx +
+                 _bcy * _bcy +
+                 _bcz * _bcz ;
+
+        _ACSQR = std::abs(_acsqr.hi());
+        _BCSQR = std::abs(_bcsqr.hi());
+
+        _FT  = _ACSQR + _BCSQR ;          // roundoff tol
+        _FT *= _ER  ;
+
+        _sgn = _acsqr - _bcsqr ;          // d_ab - d_bc
+
+        _OK  = _sgn.hi() > +_FT || _sgn.hi() < -_FT ;
+
+        return _sgn.hi() ;
+    }
+
     __normal_call REAL_TYPE bisect3d_i (
       __const_ptr(REAL_TYPE) _pa ,
       __const_ptr(REAL_TYPE) _pb ,
@@ -390,8 +532,6 @@
                   _abx, _aby, _abz ;
         ia_flt    _sgn;
 
-        ia_rnd    _rnd;                   // up rounding!
-
         _abx.from_sub(_pa[0], _pb[0]) ;   // coord. diff.
         _aby.from_sub(_pa[1], _pb[1]) ;
         _abz.from_sub(_pa[2], _pb[2]) ;
@@ -409,8 +549,10 @@
              + (_abz * (_acz + _bcz)) ;
 
         _OK  =
-           _sgn.lo() >= (REAL_TYPE)0.
-        || _sgn.up() <= (REAL_TYPE)0. ;
+           _sgn.lo() >  (REAL_TYPE)0.
+        || _sgn.up() <  (REAL_TYPE)0.
+        || (_sgn.lo() == (REAL_TYPE)0. &&
+            _sgn.up() == (REAL_TYPE)0.) ;
 
         return ( _sgn.mid () ) ;
     }
@@ -423,8 +565,8 @@
         )
     {
     /*--------------- bisect3d predicate, "float" version */
-        REAL_TYPE static const _ER =
-        +  6. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        +  6. * mp::_epsilon ;
 
         REAL_TYPE _acx, _acy, _acz ;
         REAL_TYPE _bcx, _bcy, _bcz ;
@@ -529,6 +671,60 @@
         return mp::expansion_est(_absum_) ;
     }
 
+    __normal_call REAL_TYPE bisect3w_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- bisect3w predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        +  7. * _dd_eps ;
+
+        dd_flt    _acx, _acy, _acz ;
+        dd_flt    _bcx, _bcy, _bcz ;
+        dd_flt    _acsqr, _bcsqr ;
+        dd_flt    _a_sum, _b_sum ;
+
+        REAL_TYPE _A_SUM, _B_SUM ;
+
+        dd_flt    _sgn ;
+        REAL_TYPE _FT ;
+
+        _acx.from_sub(_pa[0], _pc[0]) ;   // coord. diff.
+        _acy.from_sub(_pa[1], _pc[1]) ;
+        _acz.from_sub(_pa[2], _pc[2]) ;
+
+        _bcx.from_sub(_pb[0], _pc[0]) ;
+        _bcy.from_sub(_pb[1], _pc[1]) ;
+        _bcz.from_sub(_pb[2], _pc[2]) ;
+
+        _acsqr = _acx * _acx +
+                 _acy * _acy +
+                 _acz * _acz ;
+        _bcsqr = _bcx * _bcx +
+                 _bcy * _bcy +
+                 _bcz * _bcz ;
+
+        _a_sum = _acsqr - _pa[3] ;
+        _b_sum = _bcsqr - _pb[3] ;
+
+        _A_SUM = std::abs(_acsqr.hi())
+               + std::abs(_pa[3]);
+        _B_SUM = std::abs(_bcsqr.hi())
+               + std::abs(_pb[3]);
+
+        _FT  = _A_SUM + _B_SUM ;          // roundoff tol
+        _FT *= _ER ;
+
+        _sgn = _a_sum - _b_sum ;          // d_ab - d_bc
+
+        _OK  = _sgn.hi() > +_FT || _sgn.hi() < -_FT ;
+
+        return _sgn.hi() ;
+    }
+
     __normal_call REAL_TYPE bisect3w_i (
       __const_ptr(REAL_TYPE) _pa ,
       __const_ptr(REAL_TYPE) _pb ,
@@ -543,8 +739,6 @@
                   _abx, _aby, _abz ;
         ia_flt    _sgn;
 
-        ia_rnd    _rnd;                   // up rounding!
-
         _abx.from_sub(_pa[0], _pb[0]) ;   // coord. diff.
         _aby.from_sub(_pa[1], _pb[1]) ;
         _abz.from_sub(_pa[2], _pb[2]) ;
@@ -565,8 +759,10 @@
         _sgn-=  _abw ;
 
         _OK  =
-           _sgn.lo() >= (REAL_TYPE)0.
-        || _sgn.up() <= (REAL_TYPE)0. ;
+           _sgn.lo() >  (REAL_TYPE)0.
+        || _sgn.up() <  (REAL_TYPE)0.
+        || (_sgn.lo() == (REAL_TYPE)0. &&
+            _sgn.up() == (REAL_TYPE)0.) ;
 
         return ( _sgn.mid () ) ;
     }
@@ -579,8 +775,8 @@
         )
     {
     /*--------------- bisect3w predicate, "float" version */
-        REAL_TYPE static const _ER =
-        +  7. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        +  7. * mp::_epsilon ;
 
         REAL_TYPE _acx, _acy, _acz ;
         REAL_TYPE _bcx, _bcy, _bcz ;
@@ -0,0 +1,1883 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Correctly-rounded geometric constructions:
+     *
+     *   circum2d(pa,pb,pc,pp)      circumcentre in E^2
+     *   circum2w(pa,pb,pc,pp)      orthocentre  in E^2
+     *   circum3d(pa,pb,pc,pd,pp)   circumcentre in E^3
+     *   circum3w(pa,pb,pc,pd,pp)   orthocentre  in E^3
+     *   lineplane3d(pa,pb,pc,pd,pe,pp)
+     *                              line [a,b] vs. plane
+     *                              through [c,d,e]
+     *
+     * Weighted points carry their weight as a trailing
+     * coord., as per inball2w, inball3w. Each writes the
+     * constructed point to PP, with every coord. rounded
+     * to nearest (ties-to-even) from its exact value, and
+     * returns FALSE (leaving PP untouched) if the point is
+     * undefined, e.g. for collinear/coplanar vertices or a
+     * line parallel to the plane.
+     *
+     * Each coord. is a ratio X = P + N / D, and is found in
+     * "float", "ddflt" then "exact" stages. The first two
+     * bound the forward error E in P + N / D, and accept
+     * the rounded R only if |R - (P + N / D)| + E is less
+     * than half the gap to either neighbour of R, so that
+     * no other float can be nearer. The exact stage forms
+     * N, D as expansions, via the same minors as inball-kd
+     * and orient-kd, and brackets X between adjacent floats
+     * through exact sign tests. Only those coord. not yet
+     * certain are re-evaluated at each stage.
+     *
+     * Overflow and underflow are not accounted for.
+     *
+    --------------------------------------------------------
+     */
+
+    /*--------------- is R = RN(X), for |X - (R + T)| <= E */
+
+    __inline_call bool_type construct_near (
+        REAL_TYPE  _rr ,
+        REAL_TYPE  _tt ,
+        REAL_TYPE  _ee
+        )
+    {
+    /*------------ neighbours of R as RN(R +/- phi * |R|),
+                   with phi = u * (1 + 2u), see Rump et
+                   al. (2009). Exact with or without FMA
+                   contraction, for |R| >= 2^-969 */
+        REAL_TYPE constexpr _phi =
+            mp::_epsilon * (1. + 2. * mp::_epsilon) ;
+
+        REAL_TYPE _dr = _phi * std::abs(_rr) ;
+        REAL_TYPE _ga = (_rr + _dr) - _rr ;
+        REAL_TYPE _gb = _rr - (_rr - _dr) ;
+
+    /*------------ X lies strictly within half the gap to
+                   each neighbour of R, E padded for its
+                   own rounding error */
+        _ee *= (REAL_TYPE)1. + 32. * mp::_epsilon ;
+
+        return _ee < (REAL_TYPE).5 * _ga - _tt &&
+               _ee < (REAL_TYPE).5 * _gb + _tt ;
+    }
+
+    /*--------------- "float" stage: R = P + N / D, if RN */
+
+    __inline_call bool_type construct_f (
+        REAL_TYPE  _pp ,
+        REAL_TYPE  _nn , REAL_TYPE _en ,
+        REAL_TYPE  _dd , REAL_TYPE _ed ,
+        REAL_TYPE &_rr
+        )
+    {
+        REAL_TYPE _DD = std::abs(_dd) ;
+        if (!(_DD > _ed)) return false ;  // D ~ 0
+
+        REAL_TYPE _qq = _nn / _dd ;
+        REAL_TYPE _QQ = std::abs(_qq) ;
+
+        REAL_TYPE _EE =                   // |q - N / D|
+            (_en + _QQ * _ed) / (_DD - _ed)
+          + mp::_epsilon * _QQ ;
+
+        REAL_TYPE _xx, _tt ;
+        mp::one_one_add_full(_pp, _qq, _xx, _tt) ;
+
+        if (construct_near(_xx, _tt, _EE))
+        {
+            _rr = _xx ; return true ;
+        }
+
+        return false ;
+    }
+
+    /*--------------- "ddflt" stage: R = P + N / D, if RN */
+
+    __inline_call bool_type construct_d (
+        REAL_TYPE  _pp ,
+        dd_flt const& _nn, REAL_TYPE _en ,
+        dd_flt const& _dd, REAL_TYPE _ed ,
+        REAL_TYPE &_rr
+        )
+    {
+        REAL_TYPE _DD = std::abs(_dd.hi()) ;
+        if (!(_DD > _ed)) return false ;  // D ~ 0
+
+        dd_flt    _qq = _nn / _dd ;
+        REAL_TYPE _QQ = std::abs(_qq.hi()) ;
+
+        dd_flt    _xx = _qq + _pp ;
+
+        REAL_TYPE _EE =                   // |x - P - N / D|
+            (_en + _QQ * _ed) / (_DD - _ed)
+          + 2. * _dd_eps * _QQ
+          + 1. * _dd_eps * std::abs(_xx.hi()) ;
+
+        if (construct_near(_xx.hi(), _xx.lo(), _EE))
+        {
+            _rr = _xx.hi() ; return true ;
+        }
+
+        return false ;
+    }
+
+    /*--------------- "exact" stage: sgn(R * S * D - N) */
+
+    template <
+        size_t NN, size_t ND
+             >
+    __inline_call INDX_TYPE construct_sgn (
+        mp::expansion<NN> const& _nn ,
+        mp::expansion<ND> const& _dd ,
+        REAL_TYPE  _ss ,
+        REAL_TYPE  _r1 ,
+        REAL_TYPE  _r0 = (REAL_TYPE)+0.
+        )
+    {   // R = r1 + r0, non-overlapping, S a power of 2
+        mp::expansion< 2 > _rs;
+        if (_r0 != (REAL_TYPE)+0.)
+            _rs.push(_r0 * _ss) ;
+        if (_r1 != (REAL_TYPE)+0. || _rs.empty())
+            _rs.push(_r1 * _ss) ;
+
+        mp::expansion<mp::mul_alloc(2, ND)> _rd;
+        mp::expansion_mul(_rs, _dd, _rd) ;
+
+        return mp::expansion_sub_sgn(_rd, _nn) ;
+    }
+
+    __inline_call bool_type construct_even (
+        REAL_TYPE  _xx
+        )
+    {   // ties-to-even: is the last bit of x clear?
+        int _ex; REAL_TYPE _mm =
+            std::frexp(_xx, &_ex) ;
+
+        _mm = std::ldexp(_mm,
+            std::numeric_limits<REAL_TYPE>::digits) ;
+
+        return std::fmod(_mm, (REAL_TYPE)+2.) == +0. ;
+    }
+
+    template <
+        size_t NN, size_t ND
+             >
+    __normal_call bool_type construct_e (
+        mp::expansion<NN> const& _nn ,
+        mp::expansion<ND> const& _dd ,
+        REAL_TYPE  _ss ,
+        REAL_TYPE &_rr
+        )
+    {   // R = RN(N / (S * D)), S a power of 2
+        INDX_TYPE _sd = mp::expansion_sgn(_dd) ;
+        if (_sd == +0) return false ;     // D == 0
+
+        REAL_TYPE constexpr _inf =
+            std::numeric_limits<REAL_TYPE>::infinity();
+
+        REAL_TYPE _lo = mp::expansion_est(_nn) /
+                (_ss * mp::expansion_est(_dd)) ;
+
+        if (!std::isfinite(_lo)) return false ;
+
+    /*------------ bracket lo < x < up, via sgn(r - x) */
+        REAL_TYPE _up = _lo ;
+        INDX_TYPE _sl =
+            construct_sgn(_nn, _dd, _ss, _lo) * _sd ;
+
+        if (_sl == +0) { _rr = _lo; return true; }
+
+        if (_sl > +0)
+        {
+            for ( ; _sl > +0; )           // walk down
+            {
+                _up = _lo ;
+                _lo = std::nextafter(_lo, -_inf) ;
+                _sl =
+            construct_sgn(_nn, _dd, _ss, _lo) * _sd ;
+            }
+            if (_sl == +0) { _rr = _lo; return true; }
+        }
+        else
+        {
+            INDX_TYPE _su = -1 ;
+            for ( ; _su < +0; )           // walk up
+            {
+                _lo = _up ;
+                _up = std::nextafter(_up, +_inf) ;
+                _su =
+            construct_sgn(_nn, _dd, _ss, _up) * _sd ;
+            }
+            if (_su == +0) { _rr = _up; return true; }
+        }
+
+    /*------------ round to nearest: test the mid-point */
+        REAL_TYPE _hg = (_up - _lo) * (REAL_TYPE).5 ;
+
+        INDX_TYPE _sm =
+            construct_sgn(_nn, _dd, _ss, _lo, _hg) * _sd ;
+
+        if (_sm > +0) _rr = _lo ;
+        else
+        if (_sm < +0) _rr = _up ;
+        else
+            _rr = construct_even(_lo) ? _lo : _up ;
+
+        return true ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Circumcentre in E^2, as X = C + N / (2 * D) with
+     *
+     *   D = | acx  acy |  Nx = | acl  acy |
+     *       | bcx  bcy |       | bcl  bcy |
+     *
+     * with AC = A - C, ACL = dot(AC, AC), etc. Exactly, in
+     * the (un-translated) lifted form
+     *
+     *   X = | al  ay  1 | / 2 * | ax  ay  1 |
+     *       | bl  by  1 |       | bx  by  1 |
+     *       | cl  cy  1 |       | cx  cy  1 |
+     *
+     * and so on for Y.
+     *
+    --------------------------------------------------------
+     */
+
+    template <
+        size_t NL, size_t NR
+             >
+    __inline_call void circum2x_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        INDX_TYPE  _jj ,
+        mp::expansion<NL> const& _al ,
+        mp::expansion<NL> const& _bl ,
+        mp::expansion<NL> const& _cl ,
+        mp::expansion<NR> & _final
+        )
+    {
+    /*--------------- det. of [l, x_j, 1], for lifted l */
+        mp::expansion<mp::mul_alloc(NL, 1)>
+            _albj, _blaj, _alcj, _clai,
+            _blcj, _clbj;
+
+        mp::expansion<mp::mul_alloc(NL, 2)>
+            _d2_ab_, _d2_ac_, _d2_bc_;
+
+        mp::expansion_mul(_al, _pb[_jj], _albj) ;
+        mp::expansion_mul(_bl, _pa[_jj], _blaj) ;
+        mp::expansion_sub(_albj, _blaj, _d2_ab_);
+
+        mp::expansion_mul(_al, _pc[_jj], _alcj) ;
+        mp::expansion_mul(_cl, _pa[_jj], _clai) ;
+        mp::expansion_sub(_alcj, _clai, _d2_ac_);
+
+        mp::expansion_mul(_bl, _pc[_jj], _blcj) ;
+        mp::expansion_mul(_cl, _pb[_jj], _clbj) ;
+        mp::expansion_sub(_blcj, _clbj, _d2_bc_);
+
+        unitary_det_3x3(_d2_bc_, _d2_ac_,
+                        _d2_ab_,
+                        _final , +3) ;
+    }
+
+    __normal_call bool_type circum2d_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum2d construct, "exact" version */
+        mp::expansion< 4 > _a_lift, _b_lift,
+                           _c_lift;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_bc_;
+        mp::expansion< 12> _d3_abc;
+        mp::expansion< 48> _d3_num;
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pb[ 0], _pb[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_bc_ ) ;
+
+        unitary_det_3x3(_d2_bc_, _d2_ac_,
+                        _d2_ab_,
+                        _d3_abc, +3) ;
+
+        if (mp::expansion_sgn(_d3_abc) == +0)
+            return false ;
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pa[ 0]),
+            mp::expansion_from_sqr(_pa[ 1]),
+            _a_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pb[ 0]),
+            mp::expansion_from_sqr(_pb[ 1]),
+            _b_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pc[ 0]),
+            mp::expansion_from_sqr(_pc[ 1]),
+            _c_lift ) ;
+
+    /*-------------------------------------- N / (2 * D) */
+        if (!_OK[0])
+        {
+        circum2x_e(_pa, _pb, _pc, +1,
+            _a_lift, _b_lift, _c_lift, _d3_num) ;
+
+        _OK[0] = construct_e(
+            _d3_num, _d3_abc, +2., _pp[0]) ;
+        }
+
+        if (!_OK[1])
+        {
+        circum2x_e(_pa, _pb, _pc, +0,
+            _a_lift, _b_lift, _c_lift, _d3_num) ;
+
+        mp::expansion_neg(_d3_num) ;      // [x, l, 1]
+
+        _OK[1] = construct_e(
+            _d3_num, _d3_abc, +2., _pp[1]) ;
+        }
+
+        return _OK[0] && _OK[1] ;
+    }
+
+    __normal_call void circum2d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum2d construct, "ddflt" version */
+        REAL_TYPE constexpr _ED =
+        +  3. * _dd_eps ;
+        REAL_TYPE constexpr _EN =
+        +  6. * _dd_eps ;
+
+        dd_flt    _acx, _acy, _acl ,
+                  _bcx, _bcy, _bcl ;
+        dd_flt    _den, _num ;
+
+        REAL_TYPE _ACL, _BCL ;
+        REAL_TYPE _FD , _FN ;
+
+        _acx.from_sub(_pa[0], _pc[0]) ;   // coord. diff.
+        _acy.from_sub(_pa[1], _pc[1]) ;
+
+        _bcx.from_sub(_pb[0], _pc[0]) ;
+        _bcy.from_sub(_pb[1], _pc[1]) ;
+
+        _acl = _acx * _acx + _acy * _acy; // lifted terms
+        _bcl = _bcx * _bcx + _bcy * _bcy;
+
+        _ACL = _acl.hi() ;
+        _BCL = _bcl.hi() ;
+
+        _den = _acx * _bcy - _acy * _bcx; // 2 x 2 denom.
+
+        _FD  = _ED * (
+            std::abs(_acx.hi() * _bcy.hi())
+          + std::abs(_acy.hi() * _bcx.hi()) ) ;
+
+        if (!_OK[0])
+        {
+        _num = _acl * _bcy - _bcl * _acy;
+
+        _FN  = _EN * (
+            _ACL * std::abs(_bcy.hi())
+          + _BCL * std::abs(_acy.hi()) ) ;
+
+        _OK[0] = construct_d(_pc[0],
+            _num, _FN, _den * 2., _FD * 2., _pp[0]) ;
+        }
+
+        if (!_OK[1])
+        {
+        _num = _bcl * _acx - _acl * _bcx;
+
+        _FN  = _EN * (
+            _BCL * std::abs(_acx.hi())
+          + _ACL * std::abs(_bcx.hi()) ) ;
+
+        _OK[1] = construct_d(_pc[1],
+            _num, _FN, _den * 2., _FD * 2., _pp[1]) ;
+        }
+    }
+
+    __normal_call void circum2d_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum2d construct, "float" version */
+        REAL_TYPE constexpr _ED =
+        +  5. * mp::_epsilon ;
+        REAL_TYPE constexpr _EN =
+        + 10. * mp::_epsilon ;
+
+        REAL_TYPE _acx, _acy, _acl ,
+                  _bcx, _bcy, _bcl ;
+        REAL_TYPE _den, _num ;
+        REAL_TYPE _FD , _FN  ;
+
+        _acx = _pa [0] - _pc [0] ;        // coord. diff.
+        _acy = _pa [1] - _pc [1] ;
+
+        _bcx = _pb [0] - _pc [0] ;
+        _bcy = _pb [1] - _pc [1] ;
+
+        _acl = _acx * _acx + _acy * _acy; // lifted terms
+        _bcl = _bcx * _bcx + _bcy * _bcy;
+
+        _den = _acx * _bcy - _acy * _bcx; // 2 x 2 denom.
+
+        _FD  = _ED * (
+            std::abs(_acx * _bcy)
+          + std::abs(_acy * _bcx) ) ;
+
+        _num = _acl * _bcy - _bcl * _acy;
+
+        _FN  = _EN * (
+            _acl * std::abs(_bcy)
+          + _bcl * std::abs(_acy) ) ;
+
+        _OK[0] = construct_f(_pc[0],
+            _num, _FN, _den * 2., _FD * 2., _pp[0]) ;
+
+        _num = _bcl * _acx - _acl * _bcx;
+
+        _FN  = _EN * (
+            _bcl * std::abs(_acx)
+          + _acl * std::abs(_bcx) ) ;
+
+        _OK[1] = construct_f(_pc[1],
+            _num, _FN, _den * 2., _FD * 2., _pp[1]) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Orthocentre in E^2, as per circum2d, but with lifted
+     * terms ACL = dot(AC, AC) - (AW - CW), etc.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call bool_type circum2w_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum2w construct, "exact" version */
+        mp::expansion< 5 > _a_lift, _b_lift,
+                           _c_lift;
+        mp::expansion< 4 > _t_lift;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_bc_;
+        mp::expansion< 12> _d3_abc;
+        mp::expansion< 60> _d3_num;
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pb[ 0], _pb[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_bc_ ) ;
+
+        unitary_det_3x3(_d2_bc_, _d2_ac_,
+                        _d2_ab_,
+                        _d3_abc, +3) ;
+
+        if (mp::expansion_sgn(_d3_abc) == +0)
+            return false ;
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pa[ 0]),
+            mp::expansion_from_sqr(_pa[ 1]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pa[ 2] , _a_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pb[ 0]),
+            mp::expansion_from_sqr(_pb[ 1]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pb[ 2] , _b_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pc[ 0]),
+            mp::expansion_from_sqr(_pc[ 1]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pc[ 2] , _c_lift);
+
+    /*-------------------------------------- N / (2 * D) */
+        if (!_OK[0])
+        {
+        circum2x_e(_pa, _pb, _pc, +1,
+            _a_lift, _b_lift, _c_lift, _d3_num) ;
+
+        _OK[0] = construct_e(
+            _d3_num, _d3_abc, +2., _pp[0]) ;
+        }
+
+        if (!_OK[1])
+        {
+        circum2x_e(_pa, _pb, _pc, +0,
+            _a_lift, _b_lift, _c_lift, _d3_num) ;
+
+        mp::expansion_neg(_d3_num) ;      // [x, l, 1]
+
+        _OK[1] = construct_e(
+            _d3_num, _d3_abc, +2., _pp[1]) ;
+        }
+
+        return _OK[0] && _OK[1] ;
+    }
+
+    __normal_call void circum2w_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum2w construct, "ddflt" version */
+        REAL_TYPE constexpr _ED =
+        +  3. * _dd_eps ;
+        REAL_TYPE constexpr _EN =
+        +  7. * _dd_eps ;
+
+        dd_flt    _acx, _acy, _acw, _acl ,
+                  _bcx, _bcy, _bcw, _bcl ;
+        dd_flt    _acs, _bcs;
+        dd_flt    _den, _num;
+
+        REAL_TYPE _ACL, _BCL ;
+        REAL_TYPE _FD , _FN ;
+
+        _acx.from_sub(_pa[0], _pc[0]) ;   // coord. diff.
+        _acy.from_sub(_pa[1], _pc[1]) ;
+        _acw.from_sub(_pa[2], _pc[2]) ;
+
+        _bcx.from_sub(_pb[0], _pc[0]) ;
+        _bcy.from_sub(_pb[1], _pc[1]) ;
+        _bcw.from_sub(_pb[2], _pc[2]) ;
+
+        _acs = _acx * _acx + _acy * _acy; // lifted terms
+        _bcs = _bcx * _bcx + _bcy * _bcy;
+
+        _acl = _acs - _acw ;
+        _bcl = _bcs - _bcw ;
+
+        _ACL = _acs.hi() + std::abs(_acw.hi());
+        _BCL = _bcs.hi() + std::abs(_bcw.hi());
+
+        _den = _acx * _bcy - _acy * _bcx; // 2 x 2 denom.
+
+        _FD  = _ED * (
+            std::abs(_acx.hi() * _bcy.hi())
+          + std::abs(_acy.hi() * _bcx.hi()) ) ;
+
+        if (!_OK[0])
+        {
+        _num = _acl * _bcy - _bcl * _acy;
+
+        _FN  = _EN * (
+            _ACL * std::abs(_bcy.hi())
+          + _BCL * std::abs(_acy.hi()) ) ;
+
+        _OK[0] = construct_d(_pc[0],
+            _num, _FN, _den * 2., _FD * 2., _pp[0]) ;
+        }
+
+        if (!_OK[1])
+        {
+        _num = _bcl * _acx - _acl * _bcx;
+
+        _FN  = _EN * (
+            _BCL * std::abs(_acx.hi())
+          + _ACL * std::abs(_bcx.hi()) ) ;
+
+        _OK[1] = construct_d(_pc[1],
+            _num, _FN, _den * 2., _FD * 2., _pp[1]) ;
+        }
+    }
+
+    __normal_call void circum2w_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum2w construct, "float" version */
+        REAL_TYPE constexpr _ED =
+        +  5. * mp::_epsilon ;
+        REAL_TYPE constexpr _EN =
+        + 11. * mp::_epsilon ;
+
+        REAL_TYPE _acx, _acy, _acw, _acl ,
+                  _bcx, _bcy, _bcw, _bcl ;
+        REAL_TYPE _acs, _bcs;
+        REAL_TYPE _den, _num;
+
+        REAL_TYPE _ACL, _BCL ;
+        REAL_TYPE _FD , _FN  ;
+
+        _acx = _pa [0] - _pc [0] ;        // coord. diff.
+        _acy = _pa [1] - _pc [1] ;
+        _acw = _pa [2] - _pc [2] ;
+
+        _bcx = _pb [0] - _pc [0] ;
+        _bcy = _pb [1] - _pc [1] ;
+        _bcw = _pb [2] - _pc [2] ;
+
+        _acs = _acx * _acx + _acy * _acy; // lifted terms
+        _bcs = _bcx * _bcx + _bcy * _bcy;
+
+        _acl = _acs - _acw ;
+        _bcl = _bcs - _bcw ;
+
+        _ACL = _acs + std::abs(_acw) ;
+        _BCL = _bcs + std::abs(_bcw) ;
+
+        _den = _acx * _bcy - _acy * _bcx; // 2 x 2 denom.
+
+        _FD  = _ED * (
+            std::abs(_acx * _bcy)
+          + std::abs(_acy * _bcx) ) ;
+
+        _num = _acl * _bcy - _bcl * _acy;
+
+        _FN  = _EN * (
+            _ACL * std::abs(_bcy)
+          + _BCL * std::abs(_acy) ) ;
+
+        _OK[0] = construct_f(_pc[0],
+            _num, _FN, _den * 2., _FD * 2., _pp[0]) ;
+
+        _num = _bcl * _acx - _acl * _bcx;
+
+        _FN  = _EN * (
+            _BCL * std::abs(_acx)
+          + _ACL * std::abs(_bcx) ) ;
+
+        _OK[1] = construct_f(_pc[1],
+            _num, _FN, _den * 2., _FD * 2., _pp[1]) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Circumcentre in E^3, as X = D + N / (2 * V), with
+     *
+     *   N = ADL * (BD x CD) +
+     *       BDL * (CD x AD) +
+     *       CDL * (AD x BD) ,
+     *
+     *   V = dot(AD, BD x CD) ,
+     *
+     * with AD = A - D, ADL = dot(AD, AD), etc. Exactly, in
+     * the (un-translated) lifted form
+     *
+     *   X = | al  ay  az  1 | / 2 * | ax  ay  az  1 |
+     *       | bl  by  bz  1 |       | bx  by  bz  1 |
+     *       | cl  cy  cz  1 |       | cx  cy  cz  1 |
+     *       | dl  dy  dz  1 |       | dx  dy  dz  1 |
+     *
+     * and so on for Y, Z. Cycling the first three columns
+     * leaves the det. unchanged, so that each numerator is
+     * the det. [x_i, x_j, l, 1] for (i, j) = (1, 2),
+     * (2, 0) and (0, 1) respectively.
+     *
+    --------------------------------------------------------
+     */
+
+    __inline_call void circum3x_m (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        INDX_TYPE  _ii ,
+        INDX_TYPE  _jj ,
+        mp::expansion< 12> & _d3_abc ,
+        mp::expansion< 12> & _d3_abd ,
+        mp::expansion< 12> & _d3_acd ,
+        mp::expansion< 12> & _d3_bcd
+        )
+    {
+    /*--------------- 3 x 3 minors of [x_i, x_j, 1] */
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_ad_,
+                           _d2_bc_, _d2_bd_,
+                           _d2_cd_;
+
+        compute_det_2x2(_pa[_ii], _pa[_jj],
+                        _pb[_ii], _pb[_jj],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_pa[_ii], _pa[_jj],
+                        _pc[_ii], _pc[_jj],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_pa[_ii], _pa[_jj],
+                        _pd[_ii], _pd[_jj],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_pb[_ii], _pb[_jj],
+                        _pc[_ii], _pc[_jj],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_pb[_ii], _pb[_jj],
+                        _pd[_ii], _pd[_jj],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_pc[_ii], _pc[_jj],
+                        _pd[_ii], _pd[_jj],
+                        _d2_cd_ ) ;
+
+        unitary_det_3x3(_d2_cd_, _d2_bd_,
+                        _d2_bc_,
+                        _d3_bcd, +3) ;
+
+        unitary_det_3x3(_d2_cd_, _d2_ad_,
+                        _d2_ac_,
+                        _d3_acd, +3) ;
+
+        unitary_det_3x3(_d2_bd_, _d2_ad_,
+                        _d2_ab_,
+                        _d3_abd, +3) ;
+
+        unitary_det_3x3(_d2_bc_, _d2_ac_,
+                        _d2_ab_,
+                        _d3_abc, +3) ;
+    }
+
+    template <
+        size_t NL
+             >
+    __normal_call bool_type circum3x_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        mp::expansion<NL> const& _a_lift ,
+        mp::expansion<NL> const& _b_lift ,
+        mp::expansion<NL> const& _c_lift ,
+        mp::expansion<NL> const& _d_lift ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum3x construct, "exact" version */
+        mp::expansion< 12> _d3_abc, _d3_abd,
+                           _d3_acd, _d3_bcd;
+        mp::expansion< 96> _d4_den;
+        mp::expansion<mp::mul_alloc(NL, 48)>
+                           _d4_num;
+
+        mp::expansion< 1 > _pa_zz_(_pa[ 2]);
+        mp::expansion< 1 > _pb_zz_(_pb[ 2]);
+        mp::expansion< 1 > _pc_zz_(_pc[ 2]);
+        mp::expansion< 1 > _pd_zz_(_pd[ 2]);
+
+    /*-------------------------------------- 4 x 4 denom. */
+        circum3x_m(_pa, _pb, _pc, _pd, +0, +1,
+            _d3_abc, _d3_abd, _d3_acd, _d3_bcd) ;
+
+        compute_det_4x4(_d3_bcd, _pa_zz_,
+                        _d3_acd, _pb_zz_,
+                        _d3_abd, _pc_zz_,
+                        _d3_abc, _pd_zz_,
+                        _d4_den, +3) ;
+
+        if (mp::expansion_sgn(_d4_den) == +0)
+            return false ;
+
+    /*-------------------------------------- N / (2 * V) */
+        if (!_OK[2])
+        {
+        compute_det_4x4(_d3_bcd, _a_lift,
+                        _d3_acd, _b_lift,
+                        _d3_abd, _c_lift,
+                        _d3_abc, _d_lift,
+                        _d4_num, +3) ;
+
+        _OK[2] = construct_e(
+            _d4_num, _d4_den, +2., _pp[2]) ;
+        }
+
+        if (!_OK[0])
+        {
+        circum3x_m(_pa, _pb, _pc, _pd, +1, +2,
+            _d3_abc, _d3_abd, _d3_acd, _d3_bcd) ;
+
+        compute_det_4x4(_d3_bcd, _a_lift,
+                        _d3_acd, _b_lift,
+                        _d3_abd, _c_lift,
+                        _d3_abc, _d_lift,
+                        _d4_num, +3) ;
+
+        _OK[0] = construct_e(
+            _d4_num, _d4_den, +2., _pp[0]) ;
+        }
+
+        if (!_OK[1])
+        {
+        circum3x_m(_pa, _pb, _pc, _pd, +2, +0,
+            _d3_abc, _d3_abd, _d3_acd, _d3_bcd) ;
+
+        compute_det_4x4(_d3_bcd, _a_lift,
+                        _d3_acd, _b_lift,
+                        _d3_abd, _c_lift,
+                        _d3_abc, _d_lift,
+                        _d4_num, +3) ;
+
+        _OK[1] = construct_e(
+            _d4_num, _d4_den, +2., _pp[1]) ;
+        }
+
+        return _OK[0] && _OK[1] && _OK[2] ;
+    }
+
+    __normal_call bool_type circum3d_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum3d construct, "exact" version */
+        mp::expansion< 6 > _a_lift, _b_lift,
+                           _c_lift, _d_lift;
+        mp::expansion< 4 > _t_lift;
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pa[ 0]),
+            mp::expansion_from_sqr(_pa[ 1]),
+            _t_lift ) ;
+        mp::expansion_add(_t_lift,
+            mp::expansion_from_sqr(_pa[ 2]),
+            _a_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pb[ 0]),
+            mp::expansion_from_sqr(_pb[ 1]),
+            _t_lift ) ;
+        mp::expansion_add(_t_lift,
+            mp::expansion_from_sqr(_pb[ 2]),
+            _b_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pc[ 0]),
+            mp::expansion_from_sqr(_pc[ 1]),
+            _t_lift ) ;
+        mp::expansion_add(_t_lift,
+            mp::expansion_from_sqr(_pc[ 2]),
+            _c_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pd[ 0]),
+            mp::expansion_from_sqr(_pd[ 1]),
+            _t_lift ) ;
+        mp::expansion_add(_t_lift,
+            mp::expansion_from_sqr(_pd[ 2]),
+            _d_lift ) ;
+
+        return circum3x_e(_pa, _pb, _pc, _pd,
+            _a_lift, _b_lift, _c_lift, _d_lift,
+            _pp, _OK) ;
+    }
+
+    __normal_call void circum3d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum3d construct, "ddflt" version */
+        REAL_TYPE constexpr _ED =
+        +  6. * _dd_eps ;
+        REAL_TYPE constexpr _EN =
+        + 10. * _dd_eps ;
+
+        dd_flt    _ad[3], _bd[3], _cd[3] ;
+        dd_flt    _bc[3], _ca[3], _ab[3] ;
+        dd_flt    _adl, _bdl, _cdl ;
+        dd_flt    _den, _num ;
+
+        REAL_TYPE _BC[3], _CA[3], _AB[3] ;
+        REAL_TYPE _FD, _FN ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            _ad[_ii].from_sub(_pa[_ii], _pd[_ii]) ;
+            _bd[_ii].from_sub(_pb[_ii], _pd[_ii]) ;
+            _cd[_ii].from_sub(_pc[_ii], _pd[_ii]) ;
+        }
+
+        _adl = _ad[0] * _ad[0] +          // lifted terms
+               _ad[1] * _ad[1] +
+               _ad[2] * _ad[2] ;
+        _bdl = _bd[0] * _bd[0] +
+               _bd[1] * _bd[1] +
+               _bd[2] * _bd[2] ;
+        _cdl = _cd[0] * _cd[0] +
+               _cd[1] * _cd[1] +
+               _cd[2] * _cd[2] ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {                                 // cross-products
+            auto _jj = (_ii + 1) % 3 ;
+            auto _kk = (_ii + 2) % 3 ;
+
+            _bc[_ii] = _bd[_jj] * _cd[_kk]
+                     - _bd[_kk] * _cd[_jj] ;
+            _ca[_ii] = _cd[_jj] * _ad[_kk]
+                     - _cd[_kk] * _ad[_jj] ;
+            _ab[_ii] = _ad[_jj] * _bd[_kk]
+                     - _ad[_kk] * _bd[_jj] ;
+
+            _BC[_ii] =
+                std::abs(_bd[_jj].hi() * _cd[_kk].hi())
+              + std::abs(_bd[_kk].hi() * _cd[_jj].hi());
+            _CA[_ii] =
+                std::abs(_cd[_jj].hi() * _ad[_kk].hi())
+              + std::abs(_cd[_kk].hi() * _ad[_jj].hi());
+            _AB[_ii] =
+                std::abs(_ad[_jj].hi() * _bd[_kk].hi())
+              + std::abs(_ad[_kk].hi() * _bd[_jj].hi());
+        }
+
+        _den = _ad[0] * _bc[0] +          // 3 x 3 denom.
+               _ad[1] * _bc[1] +
+               _ad[2] * _bc[2] ;
+
+        _FD  = _ED * (
+            std::abs(_ad[0].hi()) * _BC[0]
+          + std::abs(_ad[1].hi()) * _BC[1]
+          + std::abs(_ad[2].hi()) * _BC[2] ) ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            if (_OK[_ii]) continue ;
+
+            _num = _adl * _bc[_ii]
+                 + _bdl * _ca[_ii]
+                 + _cdl * _ab[_ii] ;
+
+            _FN  = _EN * (
+                _adl.hi() * _BC[_ii]
+              + _bdl.hi() * _CA[_ii]
+              + _cdl.hi() * _AB[_ii] ) ;
+
+            _OK[_ii] = construct_d(_pd[_ii], _num,
+                _FN, _den * 2., _FD * 2., _pp[_ii]) ;
+        }
+    }
+
+    __normal_call void circum3d_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum3d construct, "float" version */
+        REAL_TYPE constexpr _ED =
+        +  8. * mp::_epsilon ;
+        REAL_TYPE constexpr _EN =
+        + 16. * mp::_epsilon ;
+
+        REAL_TYPE _ad[3], _bd[3], _cd[3] ;
+        REAL_TYPE _bc[3], _ca[3], _ab[3] ;
+        REAL_TYPE _adl, _bdl, _cdl ;
+        REAL_TYPE _den, _num ;
+
+        REAL_TYPE _BC[3], _CA[3], _AB[3] ;
+        REAL_TYPE _FD, _FN ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            _ad[_ii] = _pa[_ii] - _pd[_ii] ;
+            _bd[_ii] = _pb[_ii] - _pd[_ii] ;
+            _cd[_ii] = _pc[_ii] - _pd[_ii] ;
+        }
+
+        _adl = _ad[0] * _ad[0] +          // lifted terms
+               _ad[1] * _ad[1] +
+               _ad[2] * _ad[2] ;
+        _bdl = _bd[0] * _bd[0] +
+               _bd[1] * _bd[1] +
+               _bd[2] * _bd[2] ;
+        _cdl = _cd[0] * _cd[0] +
+               _cd[1] * _cd[1] +
+               _cd[2] * _cd[2] ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {                                 // cross-products
+            auto _jj = (_ii + 1) % 3 ;
+            auto _kk = (_ii + 2) % 3 ;
+
+            _bc[_ii] = _bd[_jj] * _cd[_kk]
+                     - _bd[_kk] * _cd[_jj] ;
+            _ca[_ii] = _cd[_jj] * _ad[_kk]
+                     - _cd[_kk] * _ad[_jj] ;
+            _ab[_ii] = _ad[_jj] * _bd[_kk]
+                     - _ad[_kk] * _bd[_jj] ;
+
+            _BC[_ii] =
+                std::abs(_bd[_jj] * _cd[_kk])
+              + std::abs(_bd[_kk] * _cd[_jj]) ;
+            _CA[_ii] =
+                std::abs(_cd[_jj] * _ad[_kk])
+              + std::abs(_cd[_kk] * _ad[_jj]) ;
+            _AB[_ii] =
+                std::abs(_ad[_jj] * _bd[_kk])
+              + std::abs(_ad[_kk] * _bd[_jj]) ;
+        }
+
+        _den = _ad[0] * _bc[0] +          // 3 x 3 denom.
+               _ad[1] * _bc[1] +
+               _ad[2] * _bc[2] ;
+
+        _FD  = _ED * (
+            std::abs(_ad[0]) * _BC[0]
+          + std::abs(_ad[1]) * _BC[1]
+          + std::abs(_ad[2]) * _BC[2] ) ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            _num = _adl * _bc[_ii]
+                 + _bdl * _ca[_ii]
+                 + _cdl * _ab[_ii] ;
+
+            _FN  = _EN * (
+                _adl * _BC[_ii]
+              + _bdl * _CA[_ii]
+              + _cdl * _AB[_ii] ) ;
+
+            _OK[_ii] = construct_f(_pd[_ii], _num,
+                _FN, _den * 2., _FD * 2., _pp[_ii]) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Orthocentre in E^3, as per circum3d, but with lifted
+     * terms ADL = dot(AD, AD) - (AW - DW), etc.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call bool_type circum3w_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum3w construct, "exact" version */
+        mp::expansion< 7 > _a_lift, _b_lift,
+                           _c_lift, _d_lift;
+        mp::expansion< 4 > _t_lift;
+        mp::expansion< 6 > _s_lift;
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pa[ 0]),
+            mp::expansion_from_sqr(_pa[ 1]),
+            _t_lift ) ;
+        mp::expansion_add(_t_lift,
+            mp::expansion_from_sqr(_pa[ 2]),
+            _s_lift ) ;
+        mp::expansion_sub(
+            _s_lift , _pa[ 3] , _a_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pb[ 0]),
+            mp::expansion_from_sqr(_pb[ 1]),
+            _t_lift ) ;
+        mp::expansion_add(_t_lift,
+            mp::expansion_from_sqr(_pb[ 2]),
+            _s_lift ) ;
+        mp::expansion_sub(
+            _s_lift , _pb[ 3] , _b_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pc[ 0]),
+            mp::expansion_from_sqr(_pc[ 1]),
+            _t_lift ) ;
+        mp::expansion_add(_t_lift,
+            mp::expansion_from_sqr(_pc[ 2]),
+            _s_lift ) ;
+        mp::expansion_sub(
+            _s_lift , _pc[ 3] , _c_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pd[ 0]),
+            mp::expansion_from_sqr(_pd[ 1]),
+            _t_lift ) ;
+        mp::expansion_add(_t_lift,
+            mp::expansion_from_sqr(_pd[ 2]),
+            _s_lift ) ;
+        mp::expansion_sub(
+            _s_lift , _pd[ 3] , _d_lift);
+
+        return circum3x_e(_pa, _pb, _pc, _pd,
+            _a_lift, _b_lift, _c_lift, _d_lift,
+            _pp, _OK) ;
+    }
+
+    __normal_call void circum3w_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum3w construct, "ddflt" version */
+        REAL_TYPE constexpr _ED =
+        +  6. * _dd_eps ;
+        REAL_TYPE constexpr _EN =
+        + 11. * _dd_eps ;
+
+        dd_flt    _ad[4], _bd[4], _cd[4] ;
+        dd_flt    _bc[3], _ca[3], _ab[3] ;
+        dd_flt    _ads, _bds, _cds ;
+        dd_flt    _adl, _bdl, _cdl ;
+        dd_flt    _den, _num ;
+
+        REAL_TYPE _BC[3], _CA[3], _AB[3] ;
+        REAL_TYPE _ADL, _BDL, _CDL ;
+        REAL_TYPE _FD , _FN ;
+
+        for (auto _ii = +0; _ii < +4; ++_ii)
+        {
+            _ad[_ii].from_sub(_pa[_ii], _pd[_ii]) ;
+            _bd[_ii].from_sub(_pb[_ii], _pd[_ii]) ;
+            _cd[_ii].from_sub(_pc[_ii], _pd[_ii]) ;
+        }
+
+        _ads = _ad[0] * _ad[0] +          // lifted terms
+               _ad[1] * _ad[1] +
+               _ad[2] * _ad[2] ;
+        _bds = _bd[0] * _bd[0] +
+               _bd[1] * _bd[1] +
+               _bd[2] * _bd[2] ;
+        _cds = _cd[0] * _cd[0] +
+               _cd[1] * _cd[1] +
+               _cd[2] * _cd[2] ;
+
+        _adl = _ads - _ad[3] ;
+        _bdl = _bds - _bd[3] ;
+        _cdl = _cds - _cd[3] ;
+
+        _ADL = _ads.hi() + std::abs(_ad[3].hi()) ;
+        _BDL = _bds.hi() + std::abs(_bd[3].hi()) ;
+        _CDL = _cds.hi() + std::abs(_cd[3].hi()) ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {                                 // cross-products
+            auto _jj = (_ii + 1) % 3 ;
+            auto _kk = (_ii + 2) % 3 ;
+
+            _bc[_ii] = _bd[_jj] * _cd[_kk]
+                     - _bd[_kk] * _cd[_jj] ;
+            _ca[_ii] = _cd[_jj] * _ad[_kk]
+                     - _cd[_kk] * _ad[_jj] ;
+            _ab[_ii] = _ad[_jj] * _bd[_kk]
+                     - _ad[_kk] * _bd[_jj] ;
+
+            _BC[_ii] =
+                std::abs(_bd[_jj].hi() * _cd[_kk].hi())
+              + std::abs(_bd[_kk].hi() * _cd[_jj].hi());
+            _CA[_ii] =
+                std::abs(_cd[_jj].hi() * _ad[_kk].hi())
+              + std::abs(_cd[_kk].hi() * _ad[_jj].hi());
+            _AB[_ii] =
+                std::abs(_ad[_jj].hi() * _bd[_kk].hi())
+              + std::abs(_ad[_kk].hi() * _bd[_jj].hi());
+        }
+
+        _den = _ad[0] * _bc[0] +          // 3 x 3 denom.
+               _ad[1] * _bc[1] +
+               _ad[2] * _bc[2] ;
+
+        _FD  = _ED * (
+            std::abs(_ad[0].hi()) * _BC[0]
+          + std::abs(_ad[1].hi()) * _BC[1]
+          + std::abs(_ad[2].hi()) * _BC[2] ) ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            if (_OK[_ii]) continue ;
+
+            _num = _adl * _bc[_ii]
+                 + _bdl * _ca[_ii]
+                 + _cdl * _ab[_ii] ;
+
+            _FN  = _EN * (
+                _ADL * _BC[_ii]
+              + _BDL * _CA[_ii]
+              + _CDL * _AB[_ii] ) ;
+
+            _OK[_ii] = construct_d(_pd[_ii], _num,
+                _FN, _den * 2., _FD * 2., _pp[_ii]) ;
+        }
+    }
+
+    __normal_call void circum3w_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- circum3w construct, "float" version */
+        REAL_TYPE constexpr _ED =
+        +  8. * mp::_epsilon ;
+        REAL_TYPE constexpr _EN =
+        + 17. * mp::_epsilon ;
+
+        REAL_TYPE _ad[4], _bd[4], _cd[4] ;
+        REAL_TYPE _bc[3], _ca[3], _ab[3] ;
+        REAL_TYPE _ads, _bds, _cds ;
+        REAL_TYPE _adl, _bdl, _cdl ;
+        REAL_TYPE _den, _num ;
+
+        REAL_TYPE _BC[3], _CA[3], _AB[3] ;
+        REAL_TYPE _ADL, _BDL, _CDL ;
+        REAL_TYPE _FD , _FN ;
+
+        for (auto _ii = +0; _ii < +4; ++_ii)
+        {
+            _ad[_ii] = _pa[_ii] - _pd[_ii] ;
+            _bd[_ii] = _pb[_ii] - _pd[_ii] ;
+            _cd[_ii] = _pc[_ii] - _pd[_ii] ;
+        }
+
+        _ads = _ad[0] * _ad[0] +          // lifted terms
+               _ad[1] * _ad[1] +
+               _ad[2] * _ad[2] ;
+        _bds = _bd[0] * _bd[0] +
+               _bd[1] * _bd[1] +
+               _bd[2] * _bd[2] ;
+        _cds = _cd[0] * _cd[0] +
+               _cd[1] * _cd[1] +
+               _cd[2] * _cd[2] ;
+
+        _adl = _ads - _ad[3] ;
+        _bdl = _bds - _bd[3] ;
+        _cdl = _cds - _cd[3] ;
+
+        _ADL = _ads + std::abs(_ad[3]) ;
+        _BDL = _bds + std::abs(_bd[3]) ;
+        _CDL = _cds + std::abs(_cd[3]) ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {                                 // cross-products
+            auto _jj = (_ii + 1) % 3 ;
+            auto _kk = (_ii + 2) % 3 ;
+
+            _bc[_ii] = _bd[_jj] * _cd[_kk]
+                     - _bd[_kk] * _cd[_jj] ;
+            _ca[_ii] = _cd[_jj] * _ad[_kk]
+                     - _cd[_kk] * _ad[_jj] ;
+            _ab[_ii] = _ad[_jj] * _bd[_kk]
+                     - _ad[_kk] * _bd[_jj] ;
+
+            _BC[_ii] =
+                std::abs(_bd[_jj] * _cd[_kk])
+              + std::abs(_bd[_kk] * _cd[_jj]) ;
+            _CA[_ii] =
+                std::abs(_cd[_jj] * _ad[_kk])
+              + std::abs(_cd[_kk] * _ad[_jj]) ;
+            _AB[_ii] =
+                std::abs(_ad[_jj] * _bd[_kk])
+              + std::abs(_ad[_kk] * _bd[_jj]) ;
+        }
+
+        _den = _ad[0] * _bc[0] +          // 3 x 3 denom.
+               _ad[1] * _bc[1] +
+               _ad[2] * _bc[2] ;
+
+        _FD  = _ED * (
+            std::abs(_ad[0]) * _BC[0]
+          + std::abs(_ad[1]) * _BC[1]
+          + std::abs(_ad[2]) * _BC[2] ) ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            _num = _adl * _bc[_ii]
+                 + _bdl * _ca[_ii]
+                 + _cdl * _ab[_ii] ;
+
+            _FN  = _EN * (
+                _ADL * _BC[_ii]
+              + _BDL * _CA[_ii]
+              + _CDL * _AB[_ii] ) ;
+
+            _OK[_ii] = construct_f(_pd[_ii], _num,
+                _FN, _den * 2., _FD * 2., _pp[_ii]) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Intersection of the line through A, B with the plane
+     * through C, D, E, as X = A + N / V, with
+     *
+     *   N = OA * (B - A) ,  V = OA - OB ,
+     *
+     * and OA = dot(A - E, (C - E) x (D - E)), etc. Exactly,
+     * as X = (OA * B - OB * A) / (OA - OB), with OA formed
+     * from the (un-translated) 3 x 3 minors of C, D, E.
+     *
+    --------------------------------------------------------
+     */
+
+    __inline_call void lineplane3x_m (
+      __const_ptr(REAL_TYPE) _pp ,
+        mp::expansion< 12> const(&_d3_cde) [3] ,
+        mp::expansion< 24> const& _d3_xyz ,
+        mp::expansion< 96> & _final
+        )
+    {
+    /*--------------- -(4 x 4 det.) via cofactors of row P */
+        mp::expansion< 24> _mx, _my, _mz ;
+        mp::expansion< 48> _s1, _s2 ;
+
+        mp::expansion_mul(_d3_cde[0], _pp[0], _mx);
+        mp::expansion_mul(_d3_cde[1], _pp[1], _my);
+        mp::expansion_mul(_d3_cde[2], _pp[2], _mz);
+
+        mp::expansion_sub(_mx, _my, _s1) ;
+        mp::expansion_sub(_mz, _d3_xyz, _s2) ;
+        mp::expansion_add(_s1, _s2, _final) ;
+
+        mp::expansion_compress(_final) ;
+    }
+
+    __normal_call bool_type lineplane3d_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- lineplane3d construct, "exact" vers.*/
+        mp::expansion< 4 > _d2_cd_, _d2_ce_,
+                           _d2_de_;
+        mp::expansion< 12> _d3_cde[3] ;
+        mp::expansion< 24> _d3_xyz;
+        mp::expansion< 96> _d4_oa_, _d4_ob_;
+        mp::expansion<192> _d4_den;
+        mp::expansion<384> _d4_num;
+
+        mp::expansion< 1 > _pc_zz_(_pc[ 2]);
+        mp::expansion< 1 > _pd_zz_(_pd[ 2]);
+        mp::expansion< 1 > _pe_zz_(_pe[ 2]);
+
+    /*-------------------------------------- plane minors */
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {   // [x_j, x_k, 1] for (j, k) = (1, 2), (0, 2),
+            // (0, 1), via column _ii deleted
+            auto _jj = _ii == +0 ? +1 : +0 ;
+            auto _kk = _ii == +2 ? +1 : +2 ;
+
+            compute_det_2x2(_pc[_jj], _pc[_kk],
+                            _pd[_jj], _pd[_kk],
+                            _d2_cd_ ) ;
+
+            compute_det_2x2(_pc[_jj], _pc[_kk],
+                            _pe[_jj], _pe[_kk],
+                            _d2_ce_ ) ;
+
+            compute_det_2x2(_pd[_jj], _pd[_kk],
+                            _pe[_jj], _pe[_kk],
+                            _d2_de_ ) ;
+
+            unitary_det_3x3(_d2_de_, _d2_ce_,
+                            _d2_cd_,
+                            _d3_cde[_ii], +3) ;
+        }
+
+        compute_det_3x3(_d2_de_, _pc_zz_ ,
+                        _d2_ce_, _pd_zz_ ,
+                        _d2_cd_, _pe_zz_ ,
+                        _d3_xyz, +3) ;
+
+    /*-------------------------------------- OA, OB, etc */
+        lineplane3x_m(_pa, _d3_cde, _d3_xyz, _d4_oa_) ;
+        lineplane3x_m(_pb, _d3_cde, _d3_xyz, _d4_ob_) ;
+
+        mp::expansion_sub(_d4_oa_, _d4_ob_, _d4_den) ;
+
+        if (mp::expansion_sgn(_d4_den) == +0)
+            return false ;
+
+    /*-------------------------------------- N / V */
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            if (_OK[_ii]) continue ;
+
+            mp::expansion<192> _mb, _ma ;
+            mp::expansion_mul(_d4_oa_, _pb[_ii], _mb);
+            mp::expansion_mul(_d4_ob_, _pa[_ii], _ma);
+            mp::expansion_sub(_mb, _ma, _d4_num) ;
+
+            _OK[_ii] = construct_e(
+                _d4_num, _d4_den, +1., _pp[_ii]) ;
+        }
+
+        return _OK[0] && _OK[1] && _OK[2] ;
+    }
+
+    __normal_call void lineplane3d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- lineplane3d construct, "ddflt" vers.*/
+        REAL_TYPE constexpr _EO =
+        +  8. * _dd_eps ;
+
+        dd_flt    _ae[3], _be[3], _ce[3], _de[3] ;
+        dd_flt    _nv[3], _ab ;
+        dd_flt    _oa , _ob , _den, _num ;
+
+        REAL_TYPE _NV[3] ;
+        REAL_TYPE _FA, _FB, _FD, _FN ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            _ae[_ii].from_sub(_pa[_ii], _pe[_ii]) ;
+            _be[_ii].from_sub(_pb[_ii], _pe[_ii]) ;
+            _ce[_ii].from_sub(_pc[_ii], _pe[_ii]) ;
+            _de[_ii].from_sub(_pd[_ii], _pe[_ii]) ;
+        }
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {                                 // plane normal
+            auto _jj = (_ii + 1) % 3 ;
+            auto _kk = (_ii + 2) % 3 ;
+
+            _nv[_ii] = _ce[_jj] * _de[_kk]
+                     - _ce[_kk] * _de[_jj] ;
+
+            _NV[_ii] =
+                std::abs(_ce[_jj].hi() * _de[_kk].hi())
+              + std::abs(_ce[_kk].hi() * _de[_jj].hi());
+        }
+
+        _oa = _ae[0] * _nv[0] +           // orient. wrt
+              _ae[1] * _nv[1] +           // plane
+              _ae[2] * _nv[2] ;
+        _ob = _be[0] * _nv[0] +
+              _be[1] * _nv[1] +
+              _be[2] * _nv[2] ;
+
+        _FA = _EO * (
+            std::abs(_ae[0].hi()) * _NV[0]
+          + std::abs(_ae[1].hi()) * _NV[1]
+          + std::abs(_ae[2].hi()) * _NV[2] ) ;
+        _FB = _EO * (
+            std::abs(_be[0].hi()) * _NV[0]
+          + std::abs(_be[1].hi()) * _NV[1]
+          + std::abs(_be[2].hi()) * _NV[2] ) ;
+
+        _den = _oa - _ob ;
+
+        _FD  = _FA + _FB +
+            _dd_eps * std::abs(_den.hi()) ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            if (_OK[_ii]) continue ;
+
+            _ab.from_sub(_pb[_ii], _pa[_ii]) ;
+
+            _num = _oa * _ab ;
+
+            _FN  = std::abs(_ab.hi()) * (
+            _FA + 2. * _dd_eps * std::abs(_oa.hi())) ;
+
+            _OK[_ii] = construct_d(_pa[_ii],
+                _num, _FN, _den, _FD, _pp[_ii]) ;
+        }
+    }
+
+    __normal_call void lineplane3d_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __write_ptr(REAL_TYPE) _pp ,
+      __write_ptr(bool_type) _OK
+        )
+    {
+    /*--------------- lineplane3d construct, "float" vers.*/
+        REAL_TYPE constexpr _EO =
+        +  8. * mp::_epsilon ;
+
+        REAL_TYPE _ae[3], _be[3], _ce[3], _de[3] ;
+        REAL_TYPE _nv[3], _ab ;
+        REAL_TYPE _oa , _ob , _den, _num ;
+
+        REAL_TYPE _NV[3] ;
+        REAL_TYPE _FA, _FB, _FD, _FN ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            _ae[_ii] = _pa[_ii] - _pe[_ii] ;
+            _be[_ii] = _pb[_ii] - _pe[_ii] ;
+            _ce[_ii] = _pc[_ii] - _pe[_ii] ;
+            _de[_ii] = _pd[_ii] - _pe[_ii] ;
+        }
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {                                 // plane normal
+            auto _jj = (_ii + 1) % 3 ;
+            auto _kk = (_ii + 2) % 3 ;
+
+            _nv[_ii] = _ce[_jj] * _de[_kk]
+                     - _ce[_kk] * _de[_jj] ;
+
+            _NV[_ii] =
+                std::abs(_ce[_jj] * _de[_kk])
+              + std::abs(_ce[_kk] * _de[_jj]) ;
+        }
+
+        _oa = _ae[0] * _nv[0] +           // orient. wrt
+              _ae[1] * _nv[1] +           // plane
+              _ae[2] * _nv[2] ;
+        _ob = _be[0] * _nv[0] +
+              _be[1] * _nv[1] +
+              _be[2] * _nv[2] ;
+
+        _FA = _EO * (
+            std::abs(_ae[0]) * _NV[0]
+          + std::abs(_ae[1]) * _NV[1]
+          + std::abs(_ae[2]) * _NV[2] ) ;
+        _FB = _EO * (
+            std::abs(_be[0]) * _NV[0]
+          + std::abs(_be[1]) * _NV[1]
+          + std::abs(_be[2]) * _NV[2] ) ;
+
+        _den = _oa - _ob ;
+
+        _FD  = _FA + _FB +
+            mp::_epsilon * std::abs(_den) ;
+
+        for (auto _ii = +0; _ii < +3; ++_ii)
+        {
+            _ab  = _pb[_ii] - _pa[_ii] ;
+
+            _num = _oa * _ab ;
+
+            _FN  = std::abs(_ab) * (
+            _FA + 3. * mp::_epsilon * std::abs(_oa)) ;
+
+            _OK[_ii] = construct_f(_pa[_ii],
+                _num, _FN, _den, _FD, _pp[_ii]) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * filtered constructions: float, ddflt, then exact
+    --------------------------------------------------------
+     */
+
+    __inline_call bool_type circum2d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _pp
+        )
+    {
+    /*------------ circum2d construct, "filtered" version */
+        bool_type _OK[2] = {false, false} ;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(CIRCUM2D_f);
+
+        circum2d_f(                     // "float" kernel
+            _pa, _pb, _pc, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1]) return true ;
+    #   endif
+
+        __kernel_tick(CIRCUM2D_d);
+
+        circum2d_d(                     // "ddflt" kernel
+            _pa, _pb, _pc, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1]) return true ;
+
+        __kernel_tick(CIRCUM2D_e);
+
+        return circum2d_e(              // "exact" kernel
+            _pa, _pb, _pc, _pp, _OK
+            ) ;
+    }
+
+    __inline_call bool_type circum2w (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _pp
+        )
+    {
+    /*------------ circum2w construct, "filtered" version */
+        bool_type _OK[2] = {false, false} ;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(CIRCUM2W_f);
+
+        circum2w_f(                     // "float" kernel
+            _pa, _pb, _pc, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1]) return true ;
+    #   endif
+
+        __kernel_tick(CIRCUM2W_d);
+
+        circum2w_d(                     // "ddflt" kernel
+            _pa, _pb, _pc, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1]) return true ;
+
+        __kernel_tick(CIRCUM2W_e);
+
+        return circum2w_e(              // "exact" kernel
+            _pa, _pb, _pc, _pp, _OK
+            ) ;
+    }
+
+    __inline_call bool_type circum3d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _pp
+        )
+    {
+    /*------------ circum3d construct, "filtered" version */
+        bool_type _OK[3] = {false, false, false} ;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(CIRCUM3D_f);
+
+        circum3d_f(                     // "float" kernel
+            _pa, _pb, _pc, _pd, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1] && _OK[2]) return true ;
+    #   endif
+
+        __kernel_tick(CIRCUM3D_d);
+
+        circum3d_d(                     // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1] && _OK[2]) return true ;
+
+        __kernel_tick(CIRCUM3D_e);
+
+        return circum3d_e(              // "exact" kernel
+            _pa, _pb, _pc, _pd, _pp, _OK
+            ) ;
+    }
+
+    __inline_call bool_type circum3w (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _pp
+        )
+    {
+    /*------------ circum3w construct, "filtered" version */
+        bool_type _OK[3] = {false, false, false} ;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(CIRCUM3W_f);
+
+        circum3w_f(                     // "float" kernel
+            _pa, _pb, _pc, _pd, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1] && _OK[2]) return true ;
+    #   endif
+
+        __kernel_tick(CIRCUM3W_d);
+
+        circum3w_d(                     // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1] && _OK[2]) return true ;
+
+        __kernel_tick(CIRCUM3W_e);
+
+        return circum3w_e(              // "exact" kernel
+            _pa, _pb, _pc, _pd, _pp, _OK
+            ) ;
+    }
+
+    __inline_call bool_type lineplane3d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __write_ptr(REAL_TYPE) _pp
+        )
+    {
+    /*------------ lineplane3d construct, "filtered" vers.*/
+        bool_type _OK[3] = {false, false, false} ;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(LINEPL3D_f);
+
+        lineplane3d_f(                  // "float" kernel
+            _pa, _pb, _pc, _pd, _pe, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1] && _OK[2]) return true ;
+    #   endif
+
+        __kernel_tick(LINEPL3D_d);
+
+        lineplane3d_d(                  // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _pe, _pp, _OK
+            ) ;
+
+        if (_OK[0] && _OK[1] && _OK[2]) return true ;
+
+        __kernel_tick(LINEPL3D_e);
+
+        return lineplane3d_e(           // "exact" kernel
+            _pa, _pb, _pc, _pd, _pe, _pp, _OK
+            ) ;
+    }
+
+
+
@@ -0,0 +1,674 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Compile-time expression trees for new predicates.
+     *
+     * A polynomial in the (floating-point) inputs is built
+     * once from EXPR_VAR leaves and the + - * operators:
+     *
+     *   auto _ex = expr_det_2x2(
+     *       expr_var(_pa[0]) - expr_var(_pc[0]) ,
+     *       expr_var(_pa[1]) - expr_var(_pc[1]) ,
+     *       expr_var(_pb[0]) - expr_var(_pc[0]) ,
+     *       expr_var(_pb[1]) - expr_var(_pc[1]) ) ;
+     *
+     *   REAL_TYPE _rr = expr_sign (_ex) ;
+     *
+     * and the "float", "bound" and "exact" kernels are all
+     * derived from the same tree:
+     *
+     * - Each node carries a bound _errk on its rounding
+     *   path, such that the float. value V is within
+     *   _errk * EPS * M of the exact result, where M is a
+     *   permanent accumulated alongside V. Inputs have
+     *   _errk = 0, a sum adds 1 to the larger _errk of its
+     *   args., and a product adds 1 to the sum of them.
+     *   For a sum of two inputs M is just |V|. The float
+     *   filter is then |V| > (_errk + 1) * EPS * M.
+     *
+     * - Each node carries a compile-time expansion length
+     *   _size, following add_alloc / mul_alloc, so that
+     *   exact values live on the stack (or thread arena).
+     *
+     * - The exact stage is evaluated lazily: the sign of
+     *   a product is the product of the signs of its args,
+     *   so no exact product is formed at a product node.
+     *   At a sum node, the arg. with the wider interval
+     *   bound is evaluated exactly first, and the other is
+     *   only expanded if its interval cannot decide the
+     *   sign. Minors are compressed before they are used
+     *   in a product.
+     *
+     * Nodes hold their args. by value, so a subexpression
+     * used twice is evaluated twice; expr_sqr(_ex) should
+     * be used to form _ex * _ex with only one evaluation.
+     *
+    --------------------------------------------------------
+     */
+
+    class expr_node { } ;           // tag for expr. types
+
+    template <
+    typename  EX
+             >
+    using expr_test = std::is_base_of<
+        expr_node, typename std::decay<EX>::type> ;
+
+    template <
+        size_t NN
+             >
+    __inline_call ia_flt expr_bound (
+        mp::expansion <NN> const& _ee
+        )
+    {   // enclose an expansion by summing its comp.'s
+        ia_flt _ia((REAL_TYPE)+0., (REAL_TYPE)+0.) ;
+
+        INDX_TYPE _ii;
+        for (_ii = +0; _ii < _ee._xlen; ++_ii)
+        {
+            _ia += _ee[_ii] ;
+        }
+
+        return  _ia ;
+    }
+
+    template <
+        size_t NN
+             >
+    __inline_call void expr_reduce (
+        mp::expansion <NN> &_ee
+        )
+    {   // compress a minor before it is multiplied
+        if constexpr (NN > +2) mp::expansion_compress(_ee) ;
+    }
+
+    __inline_call bool_type expr_certain (
+        ia_flt const& _ia ,
+        INDX_TYPE    &_ss
+        )
+    {   // sign of interval, if no zero-crossing
+        if (_ia.lo() > (REAL_TYPE)+0.)
+        {
+            _ss = +1 ; return  true ;
+        }
+        if (_ia.up() < (REAL_TYPE)+0.)
+        {
+            _ss = -1 ; return  true ;
+        }
+        if (_ia.lo() == (REAL_TYPE)+0. &&
+            _ia.up() == (REAL_TYPE)+0.)
+        {
+            _ss = +0 ; return  true ;
+        }
+
+        return  false ;
+    }
+
+    /*--------------------------- leaf: one exact input x */
+
+    class expr_var : public expr_node
+    {
+    public  :
+    INDX_TYPE static constexpr _errk = +0 ;
+    INDX_TYPE static constexpr _size = +1 ;
+
+    REAL_TYPE                  _xx ;
+
+    public  :
+    __inline_call expr_var (
+        REAL_TYPE  _aa
+        ) : _xx(_aa) {}
+
+    __inline_call void fl_eval (
+        REAL_TYPE &_vv, REAL_TYPE &_mm
+        ) const
+    {   _vv = this->_xx ; _mm = std::abs(_vv) ;
+    }
+
+    __inline_call ia_flt ia_eval (
+        ) const
+    {   return ia_flt(this->_xx, this->_xx) ;
+    }
+
+    __inline_call void mp_eval (
+        mp::expansion <_size> &_ee
+        ) const
+    {   _ee._xlen = +0 ; _ee.push(this->_xx) ;
+    }
+
+    __inline_call INDX_TYPE mp_sign (
+        ) const
+    {   return (this->_xx > +0.) - (this->_xx < +0.) ;
+    }
+    } ;
+
+    template <
+    typename  EX
+             >
+    using expr_leaf = std::is_same<
+        expr_var, typename std::decay<EX>::type> ;
+
+    /*--------------------------- sum: a + S * b, S = +-1 */
+
+    template <
+    typename  LL, typename  RR,
+    int       SS
+             >
+    class expr_sum : public expr_node
+    {
+    public  :
+    INDX_TYPE static constexpr _errk =
+        std::max(LL::_errk, RR::_errk) + 1 ;
+
+    INDX_TYPE static constexpr _size =
+        mp::add_alloc(LL::_size, RR::_size) ;
+
+    LL                         _ll ;
+    RR                         _rr ;
+
+    public  :
+    __inline_call expr_sum (
+        LL const& _aa, RR const& _bb
+        ) : _ll(_aa), _rr(_bb) {}
+
+    __inline_call void fl_eval (
+        REAL_TYPE &_vv, REAL_TYPE &_mm
+        ) const
+    {
+        REAL_TYPE _va, _ma, _vb, _mb ;
+        this->_ll.fl_eval(_va, _ma) ;
+        this->_rr.fl_eval(_vb, _mb) ;
+
+        _vv = SS > 0 ? _va + _vb : _va - _vb ;
+
+        if constexpr (
+            expr_leaf<LL>::value && expr_leaf<RR>::value)
+            _mm = std::abs(_vv) ;   // rel. err. of a +- b
+        else
+            _mm = _ma + _mb ;
+    }
+
+    __inline_call ia_flt ia_eval (
+        ) const
+    {
+        ia_flt _ia;
+        if constexpr (
+            expr_leaf<LL>::value && expr_leaf<RR>::value)
+        {
+            if (SS > 0)
+            _ia.from_add(this->_ll._xx, this->_rr._xx) ;
+            else
+            _ia.from_sub(this->_ll._xx, this->_rr._xx) ;
+        }
+        else
+        {
+            if (SS > 0)
+            _ia = this->_ll.ia_eval() + this->_rr.ia_eval() ;
+            else
+            _ia = this->_ll.ia_eval() - this->_rr.ia_eval() ;
+        }
+
+        return  _ia ;
+    }
+
+    __inline_call void mp_eval (
+        mp::expansion <_size> &_ee
+        ) const
+    {
+        if constexpr (
+            expr_leaf<LL>::value && expr_leaf<RR>::value)
+        {
+            if (SS > 0)
+            _ee.from_add(this->_ll._xx, this->_rr._xx) ;
+            else
+            _ee.from_sub(this->_ll._xx, this->_rr._xx) ;
+        }
+        else
+        {
+            mp::expansion<LL::_size> _ea ;
+            this->_ll.mp_eval(_ea) ;
+
+            mp::expansion<RR::_size> _eb ;
+            this->_rr.mp_eval(_eb) ;
+
+            if (SS > 0)
+            mp::expansion_add(_ea, _eb, _ee) ;
+            else
+            mp::expansion_sub(_ea, _eb, _ee) ;
+        }
+    }
+
+    __normal_call INDX_TYPE mp_sign (
+        ) const
+    {
+        INDX_TYPE _ss ;
+        ia_flt _ia = this->_ll.ia_eval() ;
+        ia_flt _ib = this->_rr.ia_eval() ;
+
+        if (SS < 0) _ib = -_ib ;
+
+        if (expr_certain(_ia + _ib, _ss)) return _ss ;
+
+        mp::expansion<LL::_size> _ea ;
+        mp::expansion<RR::_size> _eb ;
+
+        if (_ia.up() - _ia.lo() >=
+            _ib.up() - _ib.lo() )
+        {
+    /*------------------------ refine a, then test a + b */
+            this->_ll.mp_eval(_ea) ;
+            _ia = expr_bound(_ea) ;
+
+            if (expr_certain(_ia + _ib, _ss))
+                return _ss ;
+
+            this->_rr.mp_eval(_eb) ;
+        }
+        else
+        {
+    /*------------------------ refine b, then test a + b */
+            this->_rr.mp_eval(_eb) ;
+            _ib = expr_bound(_eb) ;
+
+            if (SS < 0) _ib = -_ib ;
+
+            if (expr_certain(_ia + _ib, _ss))
+                return _ss ;
+
+            this->_ll.mp_eval(_ea) ;
+        }
+
+        return mp::expansion_sum_sgn(
+            _ea, _eb, (REAL_TYPE) SS) ;
+    }
+    } ;
+
+    /*--------------------------- product: a * b */
+
+    template <
+    typename  LL, typename  RR
+             >
+    class expr_mul : public expr_node
+    {
+    public  :
+    INDX_TYPE static constexpr _errk =
+        LL::_errk + RR::_errk + 1 ;
+
+    INDX_TYPE static constexpr _size =
+        mp::mul_alloc(LL::_size, RR::_size) ;
+
+    LL                         _ll ;
+    RR                         _rr ;
+
+    public  :
+    __inline_call expr_mul (
+        LL const& _aa, RR const& _bb
+        ) : _ll(_aa), _rr(_bb) {}
+
+    __inline_call void fl_eval (
+        REAL_TYPE &_vv, REAL_TYPE &_mm
+        ) const
+    {
+        REAL_TYPE _va, _ma, _vb, _mb ;
+        this->_ll.fl_eval(_va, _ma) ;
+        this->_rr.fl_eval(_vb, _mb) ;
+
+        _vv = _va * _vb ;
+        _mm = _ma * _mb ;
+    }
+
+    __inline_call ia_flt ia_eval (
+        ) const
+    {
+        ia_flt _ia;
+        if constexpr (
+            expr_leaf<LL>::value && expr_leaf<RR>::value)
+        {
+            _ia.from_mul(this->_ll._xx, this->_rr._xx) ;
+        }
+        else
+        {
+            _ia = this->_ll.ia_eval() * this->_rr.ia_eval() ;
+        }
+
+        return  _ia ;
+    }
+
+    __inline_call void mp_eval (
+        mp::expansion <_size> &_ee
+        ) const
+    {
+        if constexpr (
+            expr_leaf<LL>::value && expr_leaf<RR>::value)
+        {
+            _ee.from_mul(this->_ll._xx, this->_rr._xx) ;
+        }
+        else
+        if constexpr (expr_leaf<RR>::value)
+        {
+            mp::expansion<LL::_size> _ea ;
+            this->_ll.mp_eval(_ea) ;
+            expr_reduce(_ea) ;
+
+            mp::expansion_mul(_ea, this->_rr._xx, _ee) ;
+        }
+        else
+        if constexpr (expr_leaf<LL>::value)
+        {
+            mp::expansion<RR::_size> _eb ;
+            this->_rr.mp_eval(_eb) ;
+            expr_reduce(_eb) ;
+
+            mp::expansion_mul(_eb, this->_ll._xx, _ee) ;
+        }
+        else
+        {
+            mp::expansion<LL::_size> _ea ;
+            this->_ll.mp_eval(_ea) ;
+            expr_reduce(_ea) ;
+
+            mp::expansion<RR::_size> _eb ;
+            this->_rr.mp_eval(_eb) ;
+            expr_reduce(_eb) ;
+
+            mp::expansion_mul(_ea, _eb, _ee) ;
+        }
+    }
+
+    __inline_call INDX_TYPE mp_sign (
+        ) const
+    {
+        INDX_TYPE _sa = this->_ll.mp_sign() ;
+        if (_sa == +0) return +0 ;
+
+        return _sa * this->_rr.mp_sign() ;
+    }
+    } ;
+
+    /*--------------------------- square: a * a, shared a */
+
+    template <
+    typename  EE
+             >
+    class expr_pow : public expr_node
+    {
+    public  :
+    INDX_TYPE static constexpr _errk =
+        EE::_errk + EE::_errk + 1 ;
+
+    INDX_TYPE static constexpr _size =
+        mp::mul_alloc(EE::_size, EE::_size) ;
+
+    EE                         _ee ;
+
+    public  :
+    __inline_call expr_pow (
+        EE const& _aa
+        ) : _ee(_aa) {}
+
+    __inline_call void fl_eval (
+        REAL_TYPE &_vv, REAL_TYPE &_mm
+        ) const
+    {
+        REAL_TYPE _va, _ma ;
+        this->_ee.fl_eval(_va, _ma) ;
+
+        _vv = _va * _va ;
+        _mm = _ma * _ma ;
+    }
+
+    __inline_call ia_flt ia_eval (
+        ) const
+    {   return sqr(this->_ee.ia_eval()) ;
+    }
+
+    __inline_call void mp_eval (
+        mp::expansion <_size> &_ex
+        ) const
+    {
+        if constexpr (expr_leaf<EE>::value)
+        {
+            _ex.from_sqr(this->_ee._xx) ;
+        }
+        else
+        {
+            mp::expansion<EE::_size> _ea ;
+            this->_ee.mp_eval(_ea) ;
+            expr_reduce(_ea) ;
+
+            mp::expansion_mul(_ea, _ea, _ex) ;
+        }
+    }
+
+    __inline_call INDX_TYPE mp_sign (
+        ) const
+    {   return this->_ee.mp_sign() != +0 ? +1 : +0 ;
+    }
+    } ;
+
+    /*--------------------------- operators on expr. nodes */
+
+    template <
+    typename  LL, typename  RR, typename =
+    typename  std::enable_if<
+        expr_test<LL>::value &&
+        expr_test<RR>::value>::type
+             >
+    __inline_call expr_sum<LL, RR, +1> operator + (
+        LL const& _aa, RR const& _bb
+        )
+    {   return expr_sum<LL, RR, +1>(_aa, _bb) ;
+    }
+
+    template <
+    typename  LL, typename  RR, typename =
+    typename  std::enable_if<
+        expr_test<LL>::value &&
+        expr_test<RR>::value>::type
+             >
+    __inline_call expr_sum<LL, RR, -1> operator - (
+        LL const& _aa, RR const& _bb
+        )
+    {   return expr_sum<LL, RR, -1>(_aa, _bb) ;
+    }
+
+    template <
+    typename  LL, typename  RR, typename =
+    typename  std::enable_if<
+        expr_test<LL>::value &&
+        expr_test<RR>::value>::type
+             >
+    __inline_call expr_mul<LL, RR> operator * (
+        LL const& _aa, RR const& _bb
+        )
+    {   return expr_mul<LL, RR>(_aa, _bb) ;
+    }
+
+    template <
+    typename  EE, typename =
+    typename  std::enable_if<
+        expr_test<EE>::value>::type
+             >
+    __inline_call expr_pow<EE> expr_sqr (
+        EE const& _aa
+        )
+    {   return expr_pow<EE>(_aa) ;
+    }
+
+    /*--------------------------- determinants, cofactors */
+
+    template <
+    typename  A1, typename  A2,
+    typename  B1, typename  B2
+             >
+    __inline_call auto expr_det_2x2 (
+        A1 const& _a1, A2 const& _a2 ,
+        B1 const& _b1, B2 const& _b2
+        )
+    {   // | a1  a2 |
+        // | b1  b2 |
+        return _a1 * _b2 - _a2 * _b1 ;
+    }
+
+    template <
+    typename  A1, typename  A2, typename  A3,
+    typename  B1, typename  B2, typename  B3,
+    typename  C1, typename  C2, typename  C3
+             >
+    __inline_call auto expr_det_3x3 (
+        A1 const& _a1, A2 const& _a2, A3 const& _a3 ,
+        B1 const& _b1, B2 const& _b2, B3 const& _b3 ,
+        C1 const& _c1, C2 const& _c2, C3 const& _c3
+        )
+    {   // expand about the last column, as compute_det_3x3
+        return
+          _a3 * expr_det_2x2(_b1, _b2, _c1, _c2)
+        - _b3 * expr_det_2x2(_a1, _a2, _c1, _c2)
+        + _c3 * expr_det_2x2(_a1, _a2, _b1, _b2) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * the "float", "bound" and "exact" kernels for exprs.
+    --------------------------------------------------------
+     */
+
+    template <
+    typename  EX
+             >
+    __inline_call REAL_TYPE expr_sign_f (
+        EX const& _ex ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- expr. predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+            (EX::_errk + 1) * mp::_epsilon ;
+
+        REAL_TYPE _sgn, _FT ;
+        _ex.fl_eval(_sgn, _FT) ;
+
+        _FT *= _ER ;
+
+        _OK  =
+          _sgn > +_FT || _sgn < -_FT ;
+
+        return ( _sgn ) ;
+    }
+
+    template <
+    typename  EX
+             >
+    __inline_call REAL_TYPE expr_sign_i (
+        EX const& _ex ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- expr. predicate, "bound" version */
+        INDX_TYPE _ss ;
+        ia_flt _sgn = _ex.ia_eval() ;
+
+        _OK = expr_certain(_sgn, _ss) ;
+
+        return ( _sgn.mid() ) ;
+    }
+
+    template <
+    typename  EX
+             >
+    __inline_call REAL_TYPE expr_sign_e (
+        EX const& _ex ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- expr. predicate, "exact" version */
+        _OK = true ;
+
+        return (REAL_TYPE) _ex.mp_sign() ;
+    }
+
+    template <
+    typename  EX
+             >
+    __inline_call REAL_TYPE expr_sign (
+        EX const& _ex
+        )
+    {
+    /*--------------- expr. predicate, "filtered" version */
+        static_assert( expr_test<EX>::value ,
+            "expr-sign: not an expression!") ;
+
+        REAL_TYPE _rr;
+        bool_type _OK;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(EXPRSIGN_f);
+
+        _rr = expr_sign_f(_ex, _OK) ;
+
+        if (_OK && std::isnormal(_rr))
+            return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(EXPRSIGN_i);
+
+        _rr = expr_sign_i(_ex, _OK) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(EXPRSIGN_e);
+
+        _rr = expr_sign_e(_ex, _OK) ;
+
+        return _rr ;
+    }
+
+
+
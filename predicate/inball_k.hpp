@@ -44,6 +44,74 @@
     // from predicate_k.hpp...
 
 
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, given translated coordinates
+     *
+     *   | adx  ady  dot(ad, ad) |
+     *   | bdx  bdy  dot(bd, bd) |
+     *   | cdx  cdy  dot(cd, cd) |
+     *
+     * with AD = A - D, etc. This is only valid when the
+     * coord. diff. are themselves exact.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball2d_t (
+      __const_ptr(REAL_TYPE) _ad ,
+      __const_ptr(REAL_TYPE) _bd ,
+      __const_ptr(REAL_TYPE) _cd
+        )
+    {
+    /*--------------- inball2d predicate, "shift" version */
+        mp::expansion< 4 > _a_lift, _b_lift,
+                           _c_lift;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_bc_;
+        mp::expansion< 96> _d3full;
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_ad[ 0]),
+            mp::expansion_from_sqr(_ad[ 1]),
+            _a_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_bd[ 0]),
+            mp::expansion_from_sqr(_bd[ 1]),
+            _b_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_cd[ 0]),
+            mp::expansion_from_sqr(_cd[ 1]),
+            _c_lift ) ;
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_ad[ 0], _ad[ 1],
+                        _bd[ 0], _bd[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_ad[ 0], _ad[ 1],
+                        _cd[ 0], _cd[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_bd[ 0], _bd[ 1],
+                        _cd[ 0], _cd[ 1],
+                        _d2_bc_ ) ;
+
+    /*-------------------------------------- 3 x 3 result */
+        compute_det_3x3(_d2_bc_, _a_lift,
+                        _d2_ac_, _b_lift,
+                        _d2_ab_, _c_lift,
+                        _d3full, +3) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d3full) ;
+    }
+
     /*
     --------------------------------------------------------
      *
@@ -77,10 +145,18 @@
                            _d2_cd_;
         mp::expansion< 12> _d3_abc, _d3_abd,
                            _d3_acd, _d3_bcd;
-        mp::expansion<384> _d4full;
 
         _OK = true;
 
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ad[2], _bd[2], _cd[2] ;
+        if (mp::translate_exact<2>(_pa, _pd, _ad) &&
+            mp::translate_exact<2>(_pb, _pd, _bd) &&
+            mp::translate_exact<2>(_pc, _pd, _cd) )
+        {
+            return inball2d_t(_ad, _bd, _cd) ;
+        }
+
     /*-------------------------------------- lifted terms */
         mp::expansion_add(
             mp::expansion_from_sqr(_pa[ 0]),
@@ -145,14 +221,85 @@
                         _d3_abc, +3) ;
 
     /*-------------------------------------- 4 x 4 result */
-        compute_det_4x4(_d3_bcd, _a_lift,
+        return (REAL_TYPE)
+        compute_sgn_4x4(_d3_bcd, _a_lift,
                         _d3_acd, _b_lift,
                         _d3_abd, _c_lift,
                         _d3_abc, _d_lift,
-                        _d4full, +3) ;
+                        +3) ;
+    }
 
-    /*-------------------------------------- leading det. */
-        return mp::expansion_est(_d4full) ;
+    __normal_call REAL_TYPE inball2d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball2d predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        + 11. * _dd_eps ;
+
+        dd_flt    _adx, _ady, _ali ,
+                  _bdx, _bdy, _bli ,
+                  _cdx, _cdy, _cli ;
+        dd_flt    _bdxcdy, _cdxbdy ,
+                  _cdxady, _adxcdy ,
+                  _adxbdy, _bdxady ;
+
+        REAL_TYPE _BDXCDY, _CDXBDY ,
+                  _CDXADY, _ADXCDY ,
+                  _ADXBDY, _BDXADY ;
+
+        dd_flt    _d33 ;
+        REAL_TYPE _FT ;
+
+        _adx.from_sub(_pa[0], _pd[0]) ;   // coord. diff.
+        _ady.from_sub(_pa[1], _pd[1]) ;
+
+        _bdx.from_sub(_pb[0], _pd[0]) ;
+        _bdy.from_sub(_pb[1], _pd[1]) ;
+
+        _cdx.from_sub(_pc[0], _pd[0]) ;
+        _cdy.from_sub(_pc[1], _pd[1]) ;
+
+        _ali = _adx * _adx + _ady * _ady; // lifted terms
+
+        _bli = _bdx * _bdx + _bdy * _bdy;
+
+        _cli = _cdx * _cdx + _cdy * _cdy;
+
+        _bdxcdy = _bdx * _cdy ;           // 2 x 2 minors
+        _cdxbdy = _cdx * _bdy ;
+        _cdxady = _cdx * _ady ;
+        _adxcdy = _adx * _cdy ;
+        _adxbdy = _adx * _bdy ;
+        _bdxady = _bdx * _ady ;
+
+        _BDXCDY = std::abs (_bdxcdy.hi()) ;
+        _CDXBDY = std::abs (_cdxbdy.hi()) ;
+        _CDXADY = std::abs (_cdxady.hi()) ;
+        _ADXCDY = std::abs (_adxcdy.hi()) ;
+        _ADXBDY = std::abs (_adxbdy.hi()) ;
+        _BDXADY = std::abs (_bdxady.hi()) ;
+
+        _FT  =                            // roundoff tol
+          _ali.hi() * (_BDXCDY + _CDXBDY)
+        + _bli.hi() * (_CDXADY + _ADXCDY)
+        + _cli.hi() * (_ADXBDY + _BDXADY) ;
+
+        _FT *= _ER ;
+
+        _d33 =                            // 3 x 3 result
+          _ali * (_bdxcdy - _cdxbdy)
+        + _bli * (_cdxady - _adxcdy)
+        + _cli * (_adxbdy - _bdxady) ;
+
+        _OK  =
+          _d33.hi() > +_FT || _d33.hi() < -_FT ;
+
+        return ( _d33.hi() ) ;
     }
 
     __normal_call REAL_TYPE inball2d_i (
@@ -174,8 +321,6 @@
 
         ia_flt    _d33;
 
-        ia_rnd    _rnd;                   // up rounding!
-
         _adx.from_sub(_pa[0], _pd[0]) ;   // coord. diff.
         _ady.from_sub(_pa[1], _pd[1]) ;
         _adw.from_sub(_pa[2], _pd[2]) ;
@@ -207,8 +352,10 @@
         + _cli * (_adxbdy - _bdxady) ;
 
         _OK =
-          _d33.lo() >= (REAL_TYPE)0.
-        ||_d33.up() <= (REAL_TYPE)0. ;
+          _d33.lo() >  (REAL_TYPE)0.
+        ||_d33.up() <  (REAL_TYPE)0.
+        ||(_d33.lo() == (REAL_TYPE)0. &&
+           _d33.up() == (REAL_TYPE)0.) ;
 
         return ( _d33.mid() ) ;
     }
@@ -222,8 +369,8 @@
         )
     {
     /*--------------- inball2d predicate, "float" version */
-        REAL_TYPE static const _ER =
-        + 11. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        + 11. * mp::_epsilon ;
 
         REAL_TYPE _adx, _ady, _ali ,
                   _bdx, _bdy, _bli ,
@@ -285,6 +432,81 @@
         return ( _d33 ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, given translated coordinates
+     *
+     *   | adx  ady  dot(ad, ad) - adw |
+     *   | bdx  bdy  dot(bd, bd) - bdw |
+     *   | cdx  cdy  dot(cd, cd) - cdw |
+     *
+     * with AD = A - D, etc. This is only valid when the
+     * coord. diff. are themselves exact.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball2w_t (
+      __const_ptr(REAL_TYPE) _ad ,
+      __const_ptr(REAL_TYPE) _bd ,
+      __const_ptr(REAL_TYPE) _cd
+        )
+    {
+    /*--------------- inball2w predicate, "shift" version */
+        mp::expansion< 5 > _a_lift, _b_lift,
+                           _c_lift;
+        mp::expansion< 4 > _t_lift;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_bc_;
+        mp::expansion<120> _d3full;
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_ad[ 0]),
+            mp::expansion_from_sqr(_ad[ 1]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _ad[ 2] , _a_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_bd[ 0]),
+            mp::expansion_from_sqr(_bd[ 1]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _bd[ 2] , _b_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_cd[ 0]),
+            mp::expansion_from_sqr(_cd[ 1]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _cd[ 2] , _c_lift);
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_ad[ 0], _ad[ 1],
+                        _bd[ 0], _bd[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_ad[ 0], _ad[ 1],
+                        _cd[ 0], _cd[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_bd[ 0], _bd[ 1],
+                        _cd[ 0], _cd[ 1],
+                        _d2_bc_ ) ;
+
+    /*-------------------------------------- 3 x 3 result */
+        compute_det_3x3(_d2_bc_, _a_lift,
+                        _d2_ac_, _b_lift,
+                        _d2_ab_, _c_lift,
+                        _d3full, +3) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d3full) ;
+    }
+
     /*
     --------------------------------------------------------
      *
@@ -319,10 +541,18 @@
                            _d2_cd_;
         mp::expansion< 12> _d3_abc, _d3_abd,
                            _d3_acd, _d3_bcd;
-        mp::expansion<480> _d4full;
 
         _OK = true;
 
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ad[3], _bd[3], _cd[3] ;
+        if (mp::translate_exact<3>(_pa, _pd, _ad) &&
+            mp::translate_exact<3>(_pb, _pd, _bd) &&
+            mp::translate_exact<3>(_pc, _pd, _cd) )
+        {
+            return inball2w_t(_ad, _bd, _cd) ;
+        }
+
     /*-------------------------------------- lifted terms */
         mp::expansion_add(
             mp::expansion_from_sqr(_pa[ 0]),
@@ -395,14 +625,99 @@
                         _d3_abc, +3) ;
 
     /*-------------------------------------- 4 x 4 result */
-        compute_det_4x4(_d3_bcd, _a_lift,
+        return (REAL_TYPE)
+        compute_sgn_4x4(_d3_bcd, _a_lift,
                         _d3_acd, _b_lift,
                         _d3_abd, _c_lift,
                         _d3_abc, _d_lift,
-                        _d4full, +3) ;
+                        +3) ;
+    }
 
-    /*-------------------------------------- leading det. */
-        return mp::expansion_est(_d4full) ;
+    __normal_call REAL_TYPE inball2w_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball2w predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        + 12. * _dd_eps ;
+
+        dd_flt    _adx, _ady, _adw ,
+                  _bdx, _bdy, _bdw ,
+                  _cdx, _cdy, _cdw ;
+        dd_flt    _ali, _bli, _cli ;
+        dd_flt    _bdxcdy, _cdxbdy ,
+                  _cdxady, _adxcdy ,
+                  _adxbdy, _bdxady ;
+
+        REAL_TYPE _ALI, _BLI, _CLI ;
+        REAL_TYPE _BDXCDY, _CDXBDY ,
+                  _CDXADY, _ADXCDY ,
+                  _ADXBDY, _BDXADY ;
+
+        dd_flt    _d33 ;
+        REAL_TYPE _FT ;
+
+        _adx.from_sub(_pa[0], _pd[0]) ;   // coord. diff.
+        _ady.from_sub(_pa[1], _pd[1]) ;
+        _adw.from_sub(_pa[2], _pd[2]) ;
+
+        _bdx.from_sub(_pb[0], _pd[0]) ;
+        _bdy.from_sub(_pb[1], _pd[1]) ;
+        _bdw.from_sub(_pb[2], _pd[2]) ;
+
+        _cdx.from_sub(_pc[0], _pd[0]) ;
+        _cdy.from_sub(_pc[1], _pd[1]) ;
+        _cdw.from_sub(_pc[2], _pd[2]) ;
+
+        _ali = _adx * _adx + _ady * _ady  // lifted terms
+             - _adw ;
+
+        _ALI = std::abs (_ali.hi()) ;
+
+        _bli = _bdx * _bdx + _bdy * _bdy
+             - _bdw ;
+
+        _BLI = std::abs (_bli.hi()) ;
+
+        _cli = _cdx * _cdx + _cdy * _cdy
+             - _cdw ;
+
+        _CLI = std::abs (_cli.hi()) ;
+
+        _bdxcdy = _bdx * _cdy ;           // 2 x 2 minors
+        _cdxbdy = _cdx * _bdy ;
+        _cdxady = _cdx * _ady ;
+        _adxcdy = _adx * _cdy ;
+        _adxbdy = _adx * _bdy ;
+        _bdxady = _bdx * _ady ;
+
+        _BDXCDY = std::abs (_bdxcdy.hi()) ;
+        _CDXBDY = std::abs (_cdxbdy.hi()) ;
+        _CDXADY = std::abs (_cdxady.hi()) ;
+        _ADXCDY = std::abs (_adxcdy.hi()) ;
+        _ADXBDY = std::abs (_adxbdy.hi()) ;
+        _BDXADY = std::abs (_bdxady.hi()) ;
+
+        _FT  =                            // roundoff tol
+          _ALI * (_BDXCDY + _CDXBDY)
+        + _BLI * (_CDXADY + _ADXCDY)
+        + _CLI * (_ADXBDY + _BDXADY) ;
+
+        _FT *= _ER ;
+
+        _d33 =                            // 3 x 3 result
+          _ali * (_bdxcdy - _cdxbdy)
+        + _bli * (_cdxady - _adxcdy)
+        + _cli * (_adxbdy - _bdxady) ;
+
+        _OK  =
+          _d33.hi() > +_FT || _d33.hi() < -_FT ;
+
+        return ( _d33.hi() ) ;
     }
 
     __normal_call REAL_TYPE inball2w_i (
@@ -424,8 +739,6 @@
 
         ia_flt    _d33;
 
-        ia_rnd    _rnd;                   // up rounding!
-
         _adx.from_sub(_pa[0], _pd[0]) ;   // coord. diff.
         _ady.from_sub(_pa[1], _pd[1]) ;
         _adw.from_sub(_pa[2], _pd[2]) ;
@@ -460,8 +773,10 @@
         + _cli * (_adxbdy - _bdxady) ;
 
         _OK =
-          _d33.lo() >= (REAL_TYPE)0.
-        ||_d33.up() <= (REAL_TYPE)0. ;
+          _d33.lo() >  (REAL_TYPE)0.
+        ||_d33.up() <  (REAL_TYPE)0.
+        ||(_d33.lo() == (REAL_TYPE)0. &&
+           _d33.up() == (REAL_TYPE)0.) ;
 
         return ( _d33.mid() ) ;
     }
@@ -475,8 +790,8 @@
         )
     {
     /*--------------- inball2w predicate, "float" version */
-        REAL_TYPE static const _ER =
-        + 12. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        + 12. * mp::_epsilon ;
 
         REAL_TYPE _adx, _ady, _adw ,
                   _bdx, _bdy, _bdw ,
@@ -556,79 +871,210 @@
     --------------------------------------------------------
      *
      * Compute an exact determinant using multi-precision
-     * expansions, a'la shewchuk
+     * expansions, given translated coordinates
      *
-     *   | ax  ay  az  dot(a, a)  +1. |
-     *   | bx  by  bz  dot(b, b)  +1. |
-     *   | cx  cy  cz  dot(c, c)  +1. |
-     *   | dx  dy  dz  dot(d, d)  +1. |
-     *   | ex  ey  ez  dot(e, e)  +1. |
+     *   | aex  aey  aez  dot(ae, ae) |
+     *   | bex  bey  bez  dot(be, be) |
+     *   | cex  cey  cez  dot(ce, ce) |
+     *   | dex  dey  dez  dot(de, de) |
      *
-     * This is the unweighted "in-ball" predicate in E^3.
+     * with AE = A - E, etc. This is only valid when the
+     * coord. diff. are themselves exact.
      *
     --------------------------------------------------------
      */
 
-    __normal_call REAL_TYPE inball3d_e (
-      __const_ptr(REAL_TYPE) _pa ,
-      __const_ptr(REAL_TYPE) _pb ,
-      __const_ptr(REAL_TYPE) _pc ,
-      __const_ptr(REAL_TYPE) _pd ,
-      __const_ptr(REAL_TYPE) _pe ,
-        bool_type &_OK
+    __normal_call REAL_TYPE inball3d_t (
+      __const_ptr(REAL_TYPE) _ae ,
+      __const_ptr(REAL_TYPE) _be ,
+      __const_ptr(REAL_TYPE) _ce ,
+      __const_ptr(REAL_TYPE) _de
         )
     {
-    /*--------------- inball3d predicate, "exact" version */
+    /*--------------- inball3d predicate, "shift" version */
         mp::expansion< 6 > _a_lift, _b_lift,
-                           _c_lift, _d_lift,
-                           _e_lift;
+                           _c_lift, _d_lift;
         mp::expansion< 4 > _d2_ab_, _d2_ac_,
-                           _d2_ad_, _d2_ae_,
+                           _d2_ad_,
                            _d2_bc_, _d2_bd_,
-                           _d2_be_,
-                           _d2_cd_, _d2_ce_,
-                           _d2_de_;
+                           _d2_cd_;
         mp::expansion< 24> _d3_abc, _d3_abd,
-                           _d3_abe,
-                           _d3_acd, _d3_ace,
-                           _d3_ade,
-                           _d3_bcd, _d3_bce,
-                           _d3_bde, _d3_cde;
-        mp::expansion< 96> _d4abcd, _d4abce,
-                           _d4abde, _d4acde,
-                           _d4bcde;
-        mp::expansion<5760>_d5full;
-
-        _OK = true;
+                           _d3_acd, _d3_bcd;
+        mp::expansion<1152>_d4full;
 
-        mp::expansion< 1 > _pa_zz_(_pa[ 2]);
-        mp::expansion< 1 > _pb_zz_(_pb[ 2]);
-        mp::expansion< 1 > _pc_zz_(_pc[ 2]);
-        mp::expansion< 1 > _pd_zz_(_pd[ 2]);
-        mp::expansion< 1 > _pe_zz_(_pe[ 2]);
+        mp::expansion< 1 > _ae_zz_(_ae[ 2]);
+        mp::expansion< 1 > _be_zz_(_be[ 2]);
+        mp::expansion< 1 > _ce_zz_(_ce[ 2]);
+        mp::expansion< 1 > _de_zz_(_de[ 2]);
 
     /*-------------------------------------- lifted terms */
         mp::expansion_add(
-            mp::expansion_from_sqr(_pa[ 0]),
-            mp::expansion_from_sqr(_pa[ 1]),
-            mp::expansion_from_sqr(_pa[ 2]),
+            mp::expansion_from_sqr(_ae[ 0]),
+            mp::expansion_from_sqr(_ae[ 1]),
+            mp::expansion_from_sqr(_ae[ 2]),
             _a_lift ) ;
 
         mp::expansion_add(
-            mp::expansion_from_sqr(_pb[ 0]),
-            mp::expansion_from_sqr(_pb[ 1]),
-            mp::expansion_from_sqr(_pb[ 2]),
+            mp::expansion_from_sqr(_be[ 0]),
+            mp::expansion_from_sqr(_be[ 1]),
+            mp::expansion_from_sqr(_be[ 2]),
             _b_lift ) ;
 
         mp::expansion_add(
-            mp::expansion_from_sqr(_pc[ 0]),
-            mp::expansion_from_sqr(_pc[ 1]),
-            mp::expansion_from_sqr(_pc[ 2]),
+            mp::expansion_from_sqr(_ce[ 0]),
+            mp::expansion_from_sqr(_ce[ 1]),
+            mp::expansion_from_sqr(_ce[ 2]),
             _c_lift ) ;
 
         mp::expansion_add(
-            mp::expansion_from_sqr(_pd[ 0]),
-            mp::expansion_from_sqr(_pd[ 1]),
+            mp::expansion_from_sqr(_de[ 0]),
+            mp::expansion_from_sqr(_de[ 1]),
+            mp::expansion_from_sqr(_de[ 2]),
+            _d_lift ) ;
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _be[ 0], _be[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _ce[ 0], _ce[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_be[ 0], _be[ 1],
+                        _ce[ 0], _ce[ 1],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_be[ 0], _be[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_ce[ 0], _ce[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_cd_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_bc_, _ae_zz_,
+                        _d2_ac_, _be_zz_,
+                        _d2_ab_, _ce_zz_,
+                        _d3_abc, +3) ;
+
+        compute_det_3x3(_d2_bd_, _ae_zz_,
+                        _d2_ad_, _be_zz_,
+                        _d2_ab_, _de_zz_,
+                        _d3_abd, +3) ;
+
+        compute_det_3x3(_d2_cd_, _ae_zz_,
+                        _d2_ad_, _ce_zz_,
+                        _d2_ac_, _de_zz_,
+                        _d3_acd, +3) ;
+
+        compute_det_3x3(_d2_cd_, _be_zz_,
+                        _d2_bd_, _ce_zz_,
+                        _d2_bc_, _de_zz_,
+                        _d3_bcd, +3) ;
+
+    /*-------------------------------------- 4 x 4 result */
+        compute_det_4x4(_d3_bcd, _a_lift,
+                        _d3_acd, _b_lift,
+                        _d3_abd, _c_lift,
+                        _d3_abc, _d_lift,
+                        _d4full, +4) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d4full) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, a'la shewchuk
+     *
+     *   | ax  ay  az  dot(a, a)  +1. |
+     *   | bx  by  bz  dot(b, b)  +1. |
+     *   | cx  cy  cz  dot(c, c)  +1. |
+     *   | dx  dy  dz  dot(d, d)  +1. |
+     *   | ex  ey  ez  dot(e, e)  +1. |
+     *
+     * This is the unweighted "in-ball" predicate in E^3.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball3d_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball3d predicate, "exact" version */
+        mp::expansion< 6 > _a_lift, _b_lift,
+                           _c_lift, _d_lift,
+                           _e_lift;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_ad_, _d2_ae_,
+                           _d2_bc_, _d2_bd_,
+                           _d2_be_,
+                           _d2_cd_, _d2_ce_,
+                           _d2_de_;
+        mp::expansion< 24> _d3_abc, _d3_abd,
+                           _d3_abe,
+                           _d3_acd, _d3_ace,
+                           _d3_ade,
+                           _d3_bcd, _d3_bce,
+                           _d3_bde, _d3_cde;
+        mp::expansion< 96> _d4abcd, _d4abce,
+                           _d4abde, _d4acde,
+                           _d4bcde;
+
+        _OK = true;
+
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ae[3], _be[3], _ce[3], _de[3] ;
+        if (mp::translate_exact<3>(_pa, _pe, _ae) &&
+            mp::translate_exact<3>(_pb, _pe, _be) &&
+            mp::translate_exact<3>(_pc, _pe, _ce) &&
+            mp::translate_exact<3>(_pd, _pe, _de) )
+        {
+            return inball3d_t(_ae, _be, _ce, _de) ;
+        }
+
+        mp::expansion< 1 > _pa_zz_(_pa[ 2]);
+        mp::expansion< 1 > _pb_zz_(_pb[ 2]);
+        mp::expansion< 1 > _pc_zz_(_pc[ 2]);
+        mp::expansion< 1 > _pd_zz_(_pd[ 2]);
+        mp::expansion< 1 > _pe_zz_(_pe[ 2]);
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pa[ 0]),
+            mp::expansion_from_sqr(_pa[ 1]),
+            mp::expansion_from_sqr(_pa[ 2]),
+            _a_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pb[ 0]),
+            mp::expansion_from_sqr(_pb[ 1]),
+            mp::expansion_from_sqr(_pb[ 2]),
+            _b_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pc[ 0]),
+            mp::expansion_from_sqr(_pc[ 1]),
+            mp::expansion_from_sqr(_pc[ 2]),
+            _c_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pd[ 0]),
+            mp::expansion_from_sqr(_pd[ 1]),
             mp::expansion_from_sqr(_pd[ 2]),
             _d_lift ) ;
 
@@ -752,18 +1198,157 @@
                         _d4abcd, +4) ;
 
     /*-------------------------------------- 5 x 5 result */
-        compute_det_5x5(_d4bcde, _a_lift,
+        return (REAL_TYPE)
+        compute_sgn_5x5(_d4bcde, _a_lift,
                         _d4acde, _b_lift,
                         _d4abde, _c_lift,
                         _d4abce, _d_lift,
                         _d4abcd, _e_lift,
-                        _d5full, +4) ;
+                        +4) ;
+    }
 
-    /*-------------------------------------- leading det. */
-        return mp::expansion_est(_d5full) ;
+    /*
+    --------------------------------------------------------
+     *
+     * Adaptive evaluation of the in-ball determinant
+     *
+     *   | aex  aey  aez  dot(ae, ae) |
+     *   | bex  bey  bez  dot(be, be) |
+     *   | cex  cey  cez  dot(ce, ce) |
+     *   | dex  dey  dez  dot(de, de) |
+     *
+     * via compensated ("float" + tail) arithmetic. Each
+     * value is carried as a head v = fl(op) plus a float
+     * tail e, the 1st-order sum of the exact round-off in
+     * the op. (found by error-free transformations) and the
+     * tails of its operands. The coord. diff. are split as
+     * AE = aex + aext exactly, so the input tails are exact.
+     *
+     * With P the permanent of the det., and u = eps, each
+     * value q satisfies |e_q| <= a_q * u * P_q and
+     * |Q - v_q - e_q| <= b_q * u^2 * P_q, with
+     *
+     *   q = x * y: a = a_x + a_y + 1, b = a_x * a_y
+     *              + b_x + b_y + 3 * (a_x + a_y + 1)
+     *   q = x + y: a = max(a) + 1,
+     *              b = max(b) + 2 * (max(a) + 1)
+     *
+     * from exact inputs (a = 1, b = 0). For the evaluation
+     * order below a <= 16, b <= 242, so that the result
+     * v + e is within 242 * u^2 * P + u * |v + e| of the
+     * exact det. This settles all but |det| ~ u^2 * P,
+     * with ~10x the flops of the "float" kernel and no
+     * expansions. The operands are range-checked, so that
+     * each error-free product is itself exact.
+     *
+     * Unlike shewchuk's insphereadapt, a single stage is
+     * used here: inputs that fail this bound are (almost
+     * always) exactly degenerate, for which no further
+     * float stage can help, and so go straight to the
+     * exact 5 x 5 kernel.
+     *
+    --------------------------------------------------------
+     */
+
+    /*--------------- compensated ops. on (head, tail) */
+
+    __inline_call void cmp_add (
+        REAL_TYPE  _av, REAL_TYPE  _ae ,
+        REAL_TYPE  _bv, REAL_TYPE  _be ,
+        REAL_TYPE &_cv, REAL_TYPE &_ce
+        )
+    {
+        REAL_TYPE _tt;
+        mp::one_one_add_full(_av, _bv, _cv, _tt) ;
+        _ce = (_ae + _be) + _tt ;
     }
 
-    __normal_call REAL_TYPE inball3d_i (
+    __inline_call void cmp_sub (
+        REAL_TYPE  _av, REAL_TYPE  _ae ,
+        REAL_TYPE  _bv, REAL_TYPE  _be ,
+        REAL_TYPE &_cv, REAL_TYPE &_ce
+        )
+    {
+        REAL_TYPE _tt;
+        mp::one_one_sub_full(_av, _bv, _cv, _tt) ;
+        _ce = (_ae - _be) + _tt ;
+    }
+
+    __inline_call void cmp_mul (
+        REAL_TYPE  _av, REAL_TYPE  _ae ,
+        REAL_TYPE  _bv, REAL_TYPE  _be ,
+        REAL_TYPE &_cv, REAL_TYPE &_ce
+        )
+    {
+        REAL_TYPE _tt;
+        mp::one_one_mul_full(_av, _bv, _cv, _tt) ;
+        _ce = (_av * _be + _bv * _ae) + _tt ;
+    }
+
+    __inline_call void cmp_sqr (
+        REAL_TYPE  _av, REAL_TYPE  _ae ,
+        REAL_TYPE &_cv, REAL_TYPE &_ce
+        )
+    {
+        REAL_TYPE _tt;
+        mp::one_one_sqr_full(_av, _cv, _tt) ;
+        _ce = (_av + _av) * _ae + _tt ;
+    }
+
+    __inline_call void cmp_lift (
+        REAL_TYPE  _xv, REAL_TYPE  _xe ,
+        REAL_TYPE  _yv, REAL_TYPE  _ye ,
+        REAL_TYPE  _zv, REAL_TYPE  _ze ,
+        REAL_TYPE &_lv, REAL_TYPE &_le
+        )
+    {
+        REAL_TYPE _xx, _XX, _yy, _YY, _zz, _ZZ ;
+        cmp_sqr(_xv, _xe, _xx, _XX) ;
+        cmp_sqr(_yv, _ye, _yy, _YY) ;
+        cmp_sqr(_zv, _ze, _zz, _ZZ) ;
+
+        cmp_add(_xx, _XX, _yy, _YY, _lv, _le) ;
+        cmp_add(_lv, _le, _zz, _ZZ, _lv, _le) ;
+    }
+
+    __inline_call void cmp_det2 (           // x1 * y2 - x2 * y1
+        REAL_TYPE  _x1, REAL_TYPE  _X1 ,
+        REAL_TYPE  _y1, REAL_TYPE  _Y1 ,
+        REAL_TYPE  _x2, REAL_TYPE  _X2 ,
+        REAL_TYPE  _y2, REAL_TYPE  _Y2 ,
+        REAL_TYPE &_dv, REAL_TYPE &_de
+        )
+    {
+        REAL_TYPE _pv, _pe, _qv, _qe ;
+        cmp_mul(_x1, _X1, _y2, _Y2, _pv, _pe) ;
+        cmp_mul(_x2, _X2, _y1, _Y1, _qv, _qe) ;
+
+        cmp_sub(_pv, _pe, _qv, _qe, _dv, _de) ;
+    }
+
+    __inline_call void cmp_det3 (           // s1*z1*m1 + ...
+        REAL_TYPE  _z1, REAL_TYPE  _Z1 ,
+        REAL_TYPE  _m1, REAL_TYPE  _M1 ,
+        REAL_TYPE  _z2, REAL_TYPE  _Z2 ,
+        REAL_TYPE  _m2, REAL_TYPE  _M2 ,
+        REAL_TYPE  _z3, REAL_TYPE  _Z3 ,
+        REAL_TYPE  _m3, REAL_TYPE  _M3 ,
+        REAL_TYPE  _s2, REAL_TYPE  _s3 ,
+        REAL_TYPE &_dv, REAL_TYPE &_de
+        )
+    {
+        REAL_TYPE _pv, _pe, _qv, _qe, _rv, _re ;
+        cmp_mul(_z1, _Z1, _m1, _M1, _pv, _pe) ;
+        cmp_mul(_z2, _Z2, _m2, _M2, _qv, _qe) ;
+        cmp_mul(_z3, _Z3, _m3, _M3, _rv, _re) ;
+
+        cmp_add(_pv, _pe,
+            _s2 * _qv, _s2 * _qe, _dv, _de) ;
+        cmp_add(_dv, _de,
+            _s3 * _rv, _s3 * _re, _dv, _de) ;
+    }
+
+    __normal_call REAL_TYPE inball3d_a (
       __const_ptr(REAL_TYPE) _pa ,
       __const_ptr(REAL_TYPE) _pb ,
       __const_ptr(REAL_TYPE) _pc ,
@@ -772,8 +1357,179 @@
         bool_type &_OK
         )
     {
-    /*--------------- inball3d predicate, "bound" version */
-        ia_flt    _aex, _aey, _aez ,
+    /*--------------- inball3d predicate, "adapt" version */
+        REAL_TYPE constexpr _EB =
+        +288. * mp::_epsilon * mp::_epsilon ;
+
+        REAL_TYPE constexpr _ER =
+        +  2. * mp::_epsilon ;
+
+        REAL_TYPE constexpr _LO =           // no underflow
+        + 0x1p-180 ;
+        REAL_TYPE constexpr _HI =           // no overflow
+        + 0x1p+180 ;
+
+        REAL_TYPE _ae[3], _AE[3], _be[3], _BE[3],
+                  _ce[3], _CE[3], _de[3], _DE[3];
+
+        REAL_TYPE _ab_, _AB_, _bc_, _BC_, _cd_, _CD_,
+                  _da_, _DA_, _ac_, _AC_, _bd_, _BD_;
+
+        REAL_TYPE _abc, _ABC, _bcd, _BCD, _cda, _CDA,
+                  _dab, _DAB;
+
+        REAL_TYPE _ali, _ALI, _bli, _BLI, _cli, _CLI,
+                  _dli, _DLI;
+
+        REAL_TYPE _d1v, _d1e, _d2v, _d2e, _d44, _PP, _FT;
+
+        _OK = false;
+
+        for (INDX_TYPE _ii = +0; _ii < +3; ++_ii)
+        {
+        mp::one_one_sub_full(             // coord. diff.
+            _pa[_ii], _pe[_ii], _ae[_ii], _AE[_ii]) ;
+        mp::one_one_sub_full(
+            _pb[_ii], _pe[_ii], _be[_ii], _BE[_ii]) ;
+        mp::one_one_sub_full(
+            _pc[_ii], _pe[_ii], _ce[_ii], _CE[_ii]) ;
+        mp::one_one_sub_full(
+            _pd[_ii], _pe[_ii], _de[_ii], _DE[_ii]) ;
+
+        for (REAL_TYPE _xx : {_ae[_ii], _be[_ii],
+                              _ce[_ii], _de[_ii]})
+        {
+            REAL_TYPE _XX = std::abs(_xx) ;
+            if (_XX != (REAL_TYPE)+0. &&
+              !(_XX >= _LO && _XX <= _HI))
+                return ( +0.0 ) ;
+        }
+        }
+
+    /*------------- permanent, as per inball3d_f */
+        _PP  =
+          (_ae[0] * _ae[0] + _ae[1] * _ae[1]
+         + _ae[2] * _ae[2]) * (
+          std::abs(_be[2]) * (std::abs(_ce[0] * _de[1])
+                            + std::abs(_de[0] * _ce[1]))
+        + std::abs(_ce[2]) * (std::abs(_be[0] * _de[1])
+                            + std::abs(_de[0] * _be[1]))
+        + std::abs(_de[2]) * (std::abs(_be[0] * _ce[1])
+                            + std::abs(_ce[0] * _be[1])))
+        + (_be[0] * _be[0] + _be[1] * _be[1]
+         + _be[2] * _be[2]) * (
+          std::abs(_ae[2]) * (std::abs(_ce[0] * _de[1])
+                            + std::abs(_de[0] * _ce[1]))
+        + std::abs(_ce[2]) * (std::abs(_ae[0] * _de[1])
+                            + std::abs(_de[0] * _ae[1]))
+        + std::abs(_de[2]) * (std::abs(_ae[0] * _ce[1])
+                            + std::abs(_ce[0] * _ae[1])))
+        + (_ce[0] * _ce[0] + _ce[1] * _ce[1]
+         + _ce[2] * _ce[2]) * (
+          std::abs(_ae[2]) * (std::abs(_be[0] * _de[1])
+                            + std::abs(_de[0] * _be[1]))
+        + std::abs(_be[2]) * (std::abs(_ae[0] * _de[1])
+                            + std::abs(_de[0] * _ae[1]))
+        + std::abs(_de[2]) * (std::abs(_ae[0] * _be[1])
+                            + std::abs(_be[0] * _ae[1])))
+        + (_de[0] * _de[0] + _de[1] * _de[1]
+         + _de[2] * _de[2]) * (
+          std::abs(_ae[2]) * (std::abs(_be[0] * _ce[1])
+                            + std::abs(_ce[0] * _be[1]))
+        + std::abs(_be[2]) * (std::abs(_ae[0] * _ce[1])
+                            + std::abs(_ce[0] * _ae[1]))
+        + std::abs(_ce[2]) * (std::abs(_ae[0] * _be[1])
+                            + std::abs(_be[0] * _ae[1]))) ;
+
+        if (!std::isfinite(_PP))
+            return ( +0.0 ) ;
+
+    /*------------- lifted terms, with 1st-order tails */
+        cmp_lift(_ae[0], _AE[0], _ae[1], _AE[1],
+                 _ae[2], _AE[2], _ali, _ALI) ;
+        cmp_lift(_be[0], _BE[0], _be[1], _BE[1],
+                 _be[2], _BE[2], _bli, _BLI) ;
+        cmp_lift(_ce[0], _CE[0], _ce[1], _CE[1],
+                 _ce[2], _CE[2], _cli, _CLI) ;
+        cmp_lift(_de[0], _DE[0], _de[1], _DE[1],
+                 _de[2], _DE[2], _dli, _DLI) ;
+
+    /*------------- 2 x 2 minors, with 1st-order tails */
+        cmp_det2(_ae[0], _AE[0], _ae[1], _AE[1],
+                 _be[0], _BE[0], _be[1], _BE[1],
+                 _ab_, _AB_) ;
+        cmp_det2(_be[0], _BE[0], _be[1], _BE[1],
+                 _ce[0], _CE[0], _ce[1], _CE[1],
+                 _bc_, _BC_) ;
+        cmp_det2(_ce[0], _CE[0], _ce[1], _CE[1],
+                 _de[0], _DE[0], _de[1], _DE[1],
+                 _cd_, _CD_) ;
+        cmp_det2(_de[0], _DE[0], _de[1], _DE[1],
+                 _ae[0], _AE[0], _ae[1], _AE[1],
+                 _da_, _DA_) ;
+        cmp_det2(_ae[0], _AE[0], _ae[1], _AE[1],
+                 _ce[0], _CE[0], _ce[1], _CE[1],
+                 _ac_, _AC_) ;
+        cmp_det2(_be[0], _BE[0], _be[1], _BE[1],
+                 _de[0], _DE[0], _de[1], _DE[1],
+                 _bd_, _BD_) ;
+
+    /*------------- 3 x 3 minors, with 1st-order tails */
+        cmp_det3(_ae[2], _AE[2], _bc_, _BC_,
+                 _be[2], _BE[2], _ac_, _AC_,
+                 _ce[2], _CE[2], _ab_, _AB_,
+                 -1., +1., _abc, _ABC) ;
+        cmp_det3(_be[2], _BE[2], _cd_, _CD_,
+                 _ce[2], _CE[2], _bd_, _BD_,
+                 _de[2], _DE[2], _bc_, _BC_,
+                 -1., +1., _bcd, _BCD) ;
+        cmp_det3(_ce[2], _CE[2], _da_, _DA_,
+                 _de[2], _DE[2], _ac_, _AC_,
+                 _ae[2], _AE[2], _cd_, _CD_,
+                 +1., +1., _cda, _CDA) ;
+        cmp_det3(_de[2], _DE[2], _ab_, _AB_,
+                 _ae[2], _AE[2], _bd_, _BD_,
+                 _be[2], _BE[2], _da_, _DA_,
+                 +1., +1., _dab, _DAB) ;
+
+    /*------------- 4 x 4 result, pairwise summation */
+        {
+        REAL_TYPE _pv, _pe, _qv, _qe ;
+        cmp_mul(_dli, _DLI, _abc, _ABC, _pv, _pe) ;
+        cmp_mul(_cli, _CLI, _dab, _DAB, _qv, _qe) ;
+        cmp_sub(_pv, _pe, _qv, _qe, _d1v, _d1e) ;
+
+        cmp_mul(_bli, _BLI, _cda, _CDA, _pv, _pe) ;
+        cmp_mul(_ali, _ALI, _bcd, _BCD, _qv, _qe) ;
+        cmp_sub(_pv, _pe, _qv, _qe, _d2v, _d2e) ;
+        }
+
+        cmp_add(_d1v, _d1e, _d2v, _d2e, _d1v, _d1e) ;
+
+        _d44 = _d1v + _d1e ;
+
+        _FT  = _PP * _EB + _ER * std::abs(_d44) ;
+
+        _OK  =
+          _d44 > _FT || _d44 < -_FT ;
+
+        return ( _d44 ) ;
+    }
+
+    __normal_call REAL_TYPE inball3d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball3d predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        + 17. * _dd_eps ;
+
+        dd_flt    _aex, _aey, _aez ,
                   _ali,
                   _bex, _bey, _bez ,
                   _bli,
@@ -781,99 +1537,159 @@
                   _cli,
                   _dex, _dey, _dez ,
                   _dli;
-        ia_flt    _aexbey, _bexaey ,
+        dd_flt    _aexbey, _bexaey ,
                   _aexcey, _cexaey ,
                   _bexcey, _cexbey ,
                   _cexdey, _dexcey ,
                   _dexaey, _aexdey ,
                   _bexdey, _dexbey ;
-        ia_flt    _ab_, _bc_, _cd_, _da_,
+        dd_flt    _ab_, _bc_, _cd_, _da_,
                   _ac_, _bd_;
-        ia_flt    _abc, _bcd, _cda, _dab;
-        ia_flt    _d44;
+        dd_flt    _abc, _bcd, _cda, _dab;
+
+        REAL_TYPE _AEZ, _BEZ, _CEZ, _DEZ;
+        REAL_TYPE _AEXBEY, _BEXAEY ,
+                  _AEXCEY, _CEXAEY ,
+                  _BEXCEY, _CEXBEY ,
+                  _CEXDEY, _DEXCEY ,
+                  _DEXAEY, _AEXDEY ,
+                  _BEXDEY, _DEXBEY ;
+        REAL_TYPE _AB_, _BC_, _CD_, _DA_,
+                  _AC_, _BD_;
+        REAL_TYPE _ABC, _BCD, _CDA, _DAB;
 
-        ia_rnd    _rnd;                   // up rounding!
+        dd_flt    _d44 ;
+        REAL_TYPE _FT ;
 
         _aex.from_sub(_pa[0], _pe[0]) ;   // coord. diff.
         _aey.from_sub(_pa[1], _pe[1]) ;
         _aez.from_sub(_pa[2], _pe[2]) ;
 
+        _AEZ = std::abs (_aez.hi()) ;
+
         _bex.from_sub(_pb[0], _pe[0]) ;
         _bey.from_sub(_pb[1], _pe[1]) ;
         _bez.from_sub(_pb[2], _pe[2]) ;
 
+        _BEZ = std::abs (_bez.hi()) ;
+
         _cex.from_sub(_pc[0], _pe[0]) ;
         _cey.from_sub(_pc[1], _pe[1]) ;
         _cez.from_sub(_pc[2], _pe[2]) ;
 
+        _CEZ = std::abs (_cez.hi()) ;
+
         _dex.from_sub(_pd[0], _pe[0]) ;
         _dey.from_sub(_pd[1], _pe[1]) ;
         _dez.from_sub(_pd[2], _pe[2]) ;
 
-        _ali = sqr (_aex) + sqr (_aey)    // lifted terms
-             + sqr (_aez) ;
+        _DEZ = std::abs (_dez.hi()) ;
 
-        _bli = sqr (_bex) + sqr (_bey)
-             + sqr (_bez) ;
+        _ali = _aex * _aex + _aey * _aey  // lifted terms
+             + _aez * _aez ;
 
-        _cli = sqr (_cex) + sqr (_cey)
-             + sqr (_cez) ;
+        _bli = _bex * _bex + _bey * _bey
+             + _bez * _bez ;
 
-        _dli = sqr (_dex) + sqr (_dey)
-             + sqr (_dez) ;
+        _cli = _cex * _cex + _cey * _cey
+             + _cez * _cez ;
+
+        _dli = _dex * _dex + _dey * _dey
+             + _dez * _dez ;
 
         _aexbey = _aex * _bey ;           // 2 x 2 minors
         _bexaey = _bex * _aey ;
         _ab_ = _aexbey - _bexaey ;
 
+        _AEXBEY = std::abs (_aexbey.hi()) ;
+        _BEXAEY = std::abs (_bexaey.hi()) ;
+        _AB_ = _AEXBEY + _BEXAEY ;
+
         _bexcey = _bex * _cey;
         _cexbey = _cex * _bey;
         _bc_ = _bexcey - _cexbey ;
 
+        _BEXCEY = std::abs (_bexcey.hi()) ;
+        _CEXBEY = std::abs (_cexbey.hi()) ;
+        _BC_ = _BEXCEY + _CEXBEY ;
+
         _cexdey = _cex * _dey;
         _dexcey = _dex * _cey;
         _cd_ = _cexdey - _dexcey ;
 
+        _CEXDEY = std::abs (_cexdey.hi()) ;
+        _DEXCEY = std::abs (_dexcey.hi()) ;
+        _CD_ = _CEXDEY + _DEXCEY ;
+
         _dexaey = _dex * _aey;
         _aexdey = _aex * _dey;
         _da_ = _dexaey - _aexdey ;
 
+        _DEXAEY = std::abs (_dexaey.hi()) ;
+        _AEXDEY = std::abs (_aexdey.hi()) ;
+        _DA_ = _DEXAEY + _AEXDEY ;
+
         _aexcey = _aex * _cey;
         _cexaey = _cex * _aey;
         _ac_ = _aexcey - _cexaey ;
 
+        _AEXCEY = std::abs (_aexcey.hi()) ;
+        _CEXAEY = std::abs (_cexaey.hi()) ;
+        _AC_ = _AEXCEY + _CEXAEY ;
+
         _bexdey = _bex * _dey;
         _dexbey = _dex * _bey;
         _bd_ = _bexdey - _dexbey ;
 
+        _BEXDEY = std::abs (_bexdey.hi()) ;
+        _DEXBEY = std::abs (_dexbey.hi()) ;
+        _BD_ = _BEXDEY + _DEXBEY ;
+
         _abc =                            // 3 x 3 minors
           _aez * _bc_ - _bez * _ac_
         + _cez * _ab_ ;
+        _ABC =
+          _AEZ * _BC_ + _BEZ * _AC_
+        + _CEZ * _AB_ ;
 
         _bcd =
           _bez * _cd_ - _cez * _bd_
         + _dez * _bc_ ;
+        _BCD =
+          _BEZ * _CD_ + _CEZ * _BD_
+        + _DEZ * _BC_ ;
 
         _cda =
           _cez * _da_ + _dez * _ac_
         + _aez * _cd_ ;
+        _CDA =
+          _CEZ * _DA_ + _DEZ * _AC_
+        + _AEZ * _CD_ ;
 
         _dab =
           _dez * _ab_ + _aez * _bd_
         + _bez * _da_ ;
+        _DAB =
+          _DEZ * _AB_ + _AEZ * _BD_
+        + _BEZ * _DA_ ;
+
+        _FT  =                            // roundoff tol
+          _dli.hi() * _ABC + _cli.hi() * _DAB
+        + _bli.hi() * _CDA + _ali.hi() * _BCD ;
+
+        _FT *= _ER ;
 
         _d44 =                            // 4 x 4 result
           _dli * _abc - _cli * _dab
         + _bli * _cda - _ali * _bcd ;
 
-        _OK =
-          _d44.lo() >= (REAL_TYPE)0.
-        ||_d44.up() <= (REAL_TYPE)0.;
+        _OK  =
+          _d44.hi() > _FT || _d44.hi() < -_FT ;
 
-        return ( _d44.mid() ) ;
+        return ( _d44.hi() ) ;
     }
 
-    __normal_call REAL_TYPE inball3d_f (
+    __normal_call REAL_TYPE inball3d_i (
       __const_ptr(REAL_TYPE) _pa ,
       __const_ptr(REAL_TYPE) _pb ,
       __const_ptr(REAL_TYPE) _pc ,
@@ -882,11 +1698,8 @@
         bool_type &_OK
         )
     {
-    /*--------------- inball3d predicate, "float" version */
-        REAL_TYPE static const _ER =
-        + 17. * std::pow(mp::_epsilon, 1) ;
-
-        REAL_TYPE _aex, _aey, _aez ,
+    /*--------------- inball3d predicate, "bound" version */
+        ia_flt    _aex, _aey, _aez ,
                   _ali,
                   _bex, _bey, _bez ,
                   _bli,
@@ -894,15 +1707,128 @@
                   _cli,
                   _dex, _dey, _dez ,
                   _dli;
-        REAL_TYPE _aexbey, _bexaey ,
+        ia_flt    _aexbey, _bexaey ,
                   _aexcey, _cexaey ,
                   _bexcey, _cexbey ,
                   _cexdey, _dexcey ,
                   _dexaey, _aexdey ,
                   _bexdey, _dexbey ;
-        REAL_TYPE _ab_, _bc_, _cd_, _da_,
+        ia_flt    _ab_, _bc_, _cd_, _da_,
                   _ac_, _bd_;
-        REAL_TYPE _abc, _bcd, _cda, _dab;
+        ia_flt    _abc, _bcd, _cda, _dab;
+        ia_flt    _d44;
+
+        _aex.from_sub(_pa[0], _pe[0]) ;   // coord. diff.
+        _aey.from_sub(_pa[1], _pe[1]) ;
+        _aez.from_sub(_pa[2], _pe[2]) ;
+
+        _bex.from_sub(_pb[0], _pe[0]) ;
+        _bey.from_sub(_pb[1], _pe[1]) ;
+        _bez.from_sub(_pb[2], _pe[2]) ;
+
+        _cex.from_sub(_pc[0], _pe[0]) ;
+        _cey.from_sub(_pc[1], _pe[1]) ;
+        _cez.from_sub(_pc[2], _pe[2]) ;
+
+        _dex.from_sub(_pd[0], _pe[0]) ;
+        _dey.from_sub(_pd[1], _pe[1]) ;
+        _dez.from_sub(_pd[2], _pe[2]) ;
+
+        _ali = sqr (_aex) + sqr (_aey)    // lifted terms
+             + sqr (_aez) ;
+
+        _bli = sqr (_bex) + sqr (_bey)
+             + sqr (_bez) ;
+
+        _cli = sqr (_cex) + sqr (_cey)
+             + sqr (_cez) ;
+
+        _dli = sqr (_dex) + sqr (_dey)
+             + sqr (_dez) ;
+
+        _aexbey = _aex * _bey ;           // 2 x 2 minors
+        _bexaey = _bex * _aey ;
+        _ab_ = _aexbey - _bexaey ;
+
+        _bexcey = _bex * _cey;
+        _cexbey = _cex * _bey;
+        _bc_ = _bexcey - _cexbey ;
+
+        _cexdey = _cex * _dey;
+        _dexcey = _dex * _cey;
+        _cd_ = _cexdey - _dexcey ;
+
+        _dexaey = _dex * _aey;
+        _aexdey = _aex * _dey;
+        _da_ = _dexaey - _aexdey ;
+
+        _aexcey = _aex * _cey;
+        _cexaey = _cex * _aey;
+        _ac_ = _aexcey - _cexaey ;
+
+        _bexdey = _bex * _dey;
+        _dexbey = _dex * _bey;
+        _bd_ = _bexdey - _dexbey ;
+
+        _abc =                            // 3 x 3 minors
+          _aez * _bc_ - _bez * _ac_
+        + _cez * _ab_ ;
+
+        _bcd =
+          _bez * _cd_ - _cez * _bd_
+        + _dez * _bc_ ;
+
+        _cda =
+          _cez * _da_ + _dez * _ac_
+        + _aez * _cd_ ;
+
+        _dab =
+          _dez * _ab_ + _aez * _bd_
+        + _bez * _da_ ;
+
+        _d44 =                            // 4 x 4 result
+          _dli * _abc - _cli * _dab
+        + _bli * _cda - _ali * _bcd ;
+
+        _OK =
+          _d44.lo() >  (REAL_TYPE)0.
+        ||_d44.up() <  (REAL_TYPE)0.
+        ||(_d44.lo() == (REAL_TYPE)0. &&
+           _d44.up() == (REAL_TYPE)0.);
+
+        return ( _d44.mid() ) ;
+    }
+
+    __normal_call REAL_TYPE inball3d_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball3d predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+        + 17. * mp::_epsilon ;
+
+        REAL_TYPE _aex, _aey, _aez ,
+                  _ali,
+                  _bex, _bey, _bez ,
+                  _bli,
+                  _cex, _cey, _cez ,
+                  _cli,
+                  _dex, _dey, _dez ,
+                  _dli;
+        REAL_TYPE _aexbey, _bexaey ,
+                  _aexcey, _cexaey ,
+                  _bexcey, _cexbey ,
+                  _cexdey, _dexcey ,
+                  _dexaey, _aexdey ,
+                  _bexdey, _dexbey ;
+        REAL_TYPE _ab_, _bc_, _cd_, _da_,
+                  _ac_, _bd_;
+        REAL_TYPE _abc, _bcd, _cda, _dab;
 
         REAL_TYPE _AEZ, _BEZ, _CEZ, _DEZ;
         REAL_TYPE _AEXBEY, _BEXAEY ,
@@ -1045,6 +1971,137 @@
         return ( _d44 ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, given translated coordinates
+     *
+     *   | aex  aey  aez  dot(ae, ae) - aew |
+     *   | bex  bey  bez  dot(be, be) - bew |
+     *   | cex  cey  cez  dot(ce, ce) - cew |
+     *   | dex  dey  dez  dot(de, de) - dew |
+     *
+     * with AE = A - E, etc. This is only valid when the
+     * coord. diff. are themselves exact.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball3w_t (
+      __const_ptr(REAL_TYPE) _ae ,
+      __const_ptr(REAL_TYPE) _be ,
+      __const_ptr(REAL_TYPE) _ce ,
+      __const_ptr(REAL_TYPE) _de
+        )
+    {
+    /*--------------- inball3w predicate, "shift" version */
+        mp::expansion< 7 > _a_lift, _b_lift,
+                           _c_lift, _d_lift;
+        mp::expansion< 6 > _t_lift;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_ad_,
+                           _d2_bc_, _d2_bd_,
+                           _d2_cd_;
+        mp::expansion< 24> _d3_abc, _d3_abd,
+                           _d3_acd, _d3_bcd;
+        mp::expansion<1344>_d4full;
+
+        mp::expansion< 1 > _ae_zz_(_ae[ 2]);
+        mp::expansion< 1 > _be_zz_(_be[ 2]);
+        mp::expansion< 1 > _ce_zz_(_ce[ 2]);
+        mp::expansion< 1 > _de_zz_(_de[ 2]);
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_ae[ 0]),
+            mp::expansion_from_sqr(_ae[ 1]),
+            mp::expansion_from_sqr(_ae[ 2]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _ae[ 3] , _a_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_be[ 0]),
+            mp::expansion_from_sqr(_be[ 1]),
+            mp::expansion_from_sqr(_be[ 2]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _be[ 3] , _b_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_ce[ 0]),
+            mp::expansion_from_sqr(_ce[ 1]),
+            mp::expansion_from_sqr(_ce[ 2]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _ce[ 3] , _c_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_de[ 0]),
+            mp::expansion_from_sqr(_de[ 1]),
+            mp::expansion_from_sqr(_de[ 2]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _de[ 3] , _d_lift);
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _be[ 0], _be[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _ce[ 0], _ce[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_be[ 0], _be[ 1],
+                        _ce[ 0], _ce[ 1],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_be[ 0], _be[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_ce[ 0], _ce[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_cd_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_bc_, _ae_zz_,
+                        _d2_ac_, _be_zz_,
+                        _d2_ab_, _ce_zz_,
+                        _d3_abc, +3) ;
+
+        compute_det_3x3(_d2_bd_, _ae_zz_,
+                        _d2_ad_, _be_zz_,
+                        _d2_ab_, _de_zz_,
+                        _d3_abd, +3) ;
+
+        compute_det_3x3(_d2_cd_, _ae_zz_,
+                        _d2_ad_, _ce_zz_,
+                        _d2_ac_, _de_zz_,
+                        _d3_acd, +3) ;
+
+        compute_det_3x3(_d2_cd_, _be_zz_,
+                        _d2_bd_, _ce_zz_,
+                        _d2_bc_, _de_zz_,
+                        _d3_bcd, +3) ;
+
+    /*-------------------------------------- 4 x 4 result */
+        compute_det_4x4(_d3_bcd, _a_lift,
+                        _d3_acd, _b_lift,
+                        _d3_abd, _c_lift,
+                        _d3_abc, _d_lift,
+                        _d4full, +4) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d4full) ;
+    }
+
     /*
     --------------------------------------------------------
      *
@@ -1091,10 +2148,19 @@
         mp::expansion< 96> _d4abcd, _d4abce,
                            _d4abde, _d4acde,
                            _d4bcde;
-        mp::expansion<6720>_d5full;
 
         _OK = true;
 
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ae[4], _be[4], _ce[4], _de[4] ;
+        if (mp::translate_exact<4>(_pa, _pe, _ae) &&
+            mp::translate_exact<4>(_pb, _pe, _be) &&
+            mp::translate_exact<4>(_pc, _pe, _ce) &&
+            mp::translate_exact<4>(_pd, _pe, _de) )
+        {
+            return inball3w_t(_ae, _be, _ce, _de) ;
+        }
+
         mp::expansion< 1 > _pa_zz_(_pa[ 2]);
         mp::expansion< 1 > _pb_zz_(_pb[ 2]);
         mp::expansion< 1 > _pc_zz_(_pc[ 2]);
@@ -1256,18 +2322,16 @@
                         _d4abcd, +4) ;
 
     /*-------------------------------------- 5 x 5 result */
-        compute_det_5x5(_d4bcde, _a_lift,
+        return (REAL_TYPE)
+        compute_sgn_5x5(_d4bcde, _a_lift,
                         _d4acde, _b_lift,
                         _d4abde, _c_lift,
                         _d4abce, _d_lift,
                         _d4abcd, _e_lift,
-                        _d5full, +4) ;
-
-    /*-------------------------------------- leading det. */
-        return mp::expansion_est(_d5full) ;
+                        +4) ;
     }
 
-    __normal_call REAL_TYPE inball3w_i (
+    __normal_call REAL_TYPE inball3w_d (
       __const_ptr(REAL_TYPE) _pa ,
       __const_ptr(REAL_TYPE) _pb ,
       __const_ptr(REAL_TYPE) _pc ,
@@ -1276,8 +2340,11 @@
         bool_type &_OK
         )
     {
-    /*--------------- inball3w predicate, "bound" version */
-        ia_flt    _aex, _aey, _aez ,
+    /*--------------- inball3w predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        + 18. * _dd_eps ;
+
+        dd_flt    _aex, _aey, _aez ,
                   _aew, _ali,
                   _bex, _bey, _bez ,
                   _bew, _bli,
@@ -1285,98 +2352,281 @@
                   _cew, _cli,
                   _dex, _dey, _dez ,
                   _dew, _dli;
-        ia_flt    _aexbey, _bexaey ,
+        dd_flt    _aexbey, _bexaey ,
                   _aexcey, _cexaey ,
                   _bexcey, _cexbey ,
                   _cexdey, _dexcey ,
                   _dexaey, _aexdey ,
                   _bexdey, _dexbey ;
-        ia_flt    _ab_, _bc_, _cd_, _da_,
+        dd_flt    _ab_, _bc_, _cd_, _da_,
                   _ac_, _bd_;
-        ia_flt    _abc, _bcd, _cda, _dab;
-        ia_flt    _d44;
+        dd_flt    _abc, _bcd, _cda, _dab;
+
+        REAL_TYPE _AEZ, _BEZ, _CEZ, _DEZ;
+        REAL_TYPE _ALI, _BLI, _CLI, _DLI;
+        REAL_TYPE _AEXBEY, _BEXAEY ,
+                  _CEXAEY, _AEXCEY ,
+                  _BEXCEY, _CEXBEY ,
+                  _CEXDEY, _DEXCEY ,
+                  _DEXAEY, _AEXDEY ,
+                  _BEXDEY, _DEXBEY ;
+        REAL_TYPE _AB_, _BC_, _CD_, _DA_,
+                  _AC_, _BD_;
+        REAL_TYPE _ABC, _BCD, _CDA, _DAB;
 
-        ia_rnd    _rnd;                   // up rounding!
+        dd_flt    _d44 ;
+        REAL_TYPE _FT ;
 
         _aex.from_sub(_pa[0], _pe[0]) ;   // coord. diff.
         _aey.from_sub(_pa[1], _pe[1]) ;
         _aez.from_sub(_pa[2], _pe[2]) ;
         _aew.from_sub(_pa[3], _pe[3]) ;
 
+        _AEZ = std::abs (_aez.hi()) ;
+
         _bex.from_sub(_pb[0], _pe[0]) ;
         _bey.from_sub(_pb[1], _pe[1]) ;
         _bez.from_sub(_pb[2], _pe[2]) ;
         _bew.from_sub(_pb[3], _pe[3]) ;
 
+        _BEZ = std::abs (_bez.hi()) ;
+
         _cex.from_sub(_pc[0], _pe[0]) ;
         _cey.from_sub(_pc[1], _pe[1]) ;
         _cez.from_sub(_pc[2], _pe[2]) ;
         _cew.from_sub(_pc[3], _pe[3]) ;
 
+        _CEZ = std::abs (_cez.hi()) ;
+
         _dex.from_sub(_pd[0], _pe[0]) ;
         _dey.from_sub(_pd[1], _pe[1]) ;
         _dez.from_sub(_pd[2], _pe[2]) ;
         _dew.from_sub(_pd[3], _pe[3]) ;
 
-        _ali =  sqr(_aex) +  sqr(_aey)    // lifted terms
-             +  sqr(_aez) - _aew ;
+        _DEZ = std::abs (_dez.hi()) ;
 
-        _bli =  sqr(_bex) +  sqr(_bey)
-             +  sqr(_bez) - _bew ;
+        _ali = _aex * _aex + _aey * _aey  // lifted terms
+             + _aez * _aez - _aew ;
 
-        _cli =  sqr(_cex) +  sqr(_cey)
-             +  sqr(_cez) - _cew ;
+        _ALI = std::abs (_ali.hi()) ;
 
-        _dli =  sqr(_dex) +  sqr(_dey)
-             +  sqr(_dez) - _dew ;
+        _bli = _bex * _bex + _bey * _bey
+             + _bez * _bez - _bew ;
+
+        _BLI = std::abs (_bli.hi()) ;
+
+        _cli = _cex * _cex + _cey * _cey
+             + _cez * _cez - _cew ;
+
+        _CLI = std::abs (_cli.hi()) ;
+
+        _dli = _dex * _dex + _dey * _dey
+             + _dez * _dez - _dew ;
+
+        _DLI = std::abs (_dli.hi()) ;
 
         _aexbey = _aex * _bey ;           // 2 x 2 minors
         _bexaey = _bex * _aey ;
         _ab_ = _aexbey - _bexaey ;
 
+        _AEXBEY = std::abs (_aexbey.hi()) ;
+        _BEXAEY = std::abs (_bexaey.hi()) ;
+        _AB_ = _AEXBEY + _BEXAEY ;
+
         _bexcey = _bex * _cey;
         _cexbey = _cex * _bey;
         _bc_ = _bexcey - _cexbey ;
 
+        _BEXCEY = std::abs (_bexcey.hi()) ;
+        _CEXBEY = std::abs (_cexbey.hi()) ;
+        _BC_ = _BEXCEY + _CEXBEY ;
+
         _cexdey = _cex * _dey;
         _dexcey = _dex * _cey;
         _cd_ = _cexdey - _dexcey ;
 
+        _CEXDEY = std::abs (_cexdey.hi()) ;
+        _DEXCEY = std::abs (_dexcey.hi()) ;
+        _CD_ = _CEXDEY + _DEXCEY ;
+
         _dexaey = _dex * _aey;
         _aexdey = _aex * _dey;
         _da_ = _dexaey - _aexdey ;
 
+        _DEXAEY = std::abs (_dexaey.hi()) ;
+        _AEXDEY = std::abs (_aexdey.hi()) ;
+        _DA_ = _DEXAEY + _AEXDEY ;
+
         _aexcey = _aex * _cey;
         _cexaey = _cex * _aey;
         _ac_ = _aexcey - _cexaey ;
 
+        _AEXCEY = std::abs (_aexcey.hi()) ;
+        _CEXAEY = std::abs (_cexaey.hi()) ;
+        _AC_ = _AEXCEY + _CEXAEY ;
+
         _bexdey = _bex * _dey;
         _dexbey = _dex * _bey;
         _bd_ = _bexdey - _dexbey ;
 
+        _BEXDEY = std::abs (_bexdey.hi()) ;
+        _DEXBEY = std::abs (_dexbey.hi()) ;
+        _BD_ = _BEXDEY + _DEXBEY ;
+
         _abc =                            // 3 x 3 minors
           _aez * _bc_ - _bez * _ac_
         + _cez * _ab_ ;
+        _ABC =
+          _AEZ * _BC_ + _BEZ * _AC_
+        + _CEZ * _AB_ ;
 
         _bcd =
           _bez * _cd_ - _cez * _bd_
         + _dez * _bc_ ;
+        _BCD =
+          _BEZ * _CD_ + _CEZ * _BD_
+        + _DEZ * _BC_ ;
 
         _cda =
           _cez * _da_ + _dez * _ac_
         + _aez * _cd_ ;
+        _CDA =
+          _CEZ * _DA_ + _DEZ * _AC_
+        + _AEZ * _CD_ ;
 
         _dab =
           _dez * _ab_ + _aez * _bd_
         + _bez * _da_ ;
+        _DAB =
+          _DEZ * _AB_ + _AEZ * _BD_
+        + _BEZ * _DA_ ;
 
-        _d44 =                            // 4 x 4 result
-          _dli * _abc - _cli * _dab
-        + _bli * _cda - _ali * _bcd ;
-
-        _OK =
-          _d44.lo() >= (REAL_TYPE)0.
-        ||_d44.up() <= (REAL_TYPE)0.;
+        _FT  =                            // roundoff tol
+          _DLI * _ABC + _CLI * _DAB
+        + _BLI * _CDA + _ALI * _BCD ;
+
+        _FT *= _ER ;
+
+        _d44 =                            // 4 x 4 result
+          _dli * _abc - _cli * _dab
+        + _bli * _cda - _ali * _bcd ;
+
+        _OK  =
+          _d44.hi() > _FT || _d44.hi() < -_FT ;
+
+        return ( _d44.hi() ) ;
+    }
+
+    __normal_call REAL_TYPE inball3w_i (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball3w predicate, "bound" version */
+        ia_flt    _aex, _aey, _aez ,
+                  _aew, _ali,
+                  _bex, _bey, _bez ,
+                  _bew, _bli,
+                  _cex, _cey, _cez ,
+                  _cew, _cli,
+                  _dex, _dey, _dez ,
+                  _dew, _dli;
+        ia_flt    _aexbey, _bexaey ,
+                  _aexcey, _cexaey ,
+                  _bexcey, _cexbey ,
+                  _cexdey, _dexcey ,
+                  _dexaey, _aexdey ,
+                  _bexdey, _dexbey ;
+        ia_flt    _ab_, _bc_, _cd_, _da_,
+                  _ac_, _bd_;
+        ia_flt    _abc, _bcd, _cda, _dab;
+        ia_flt    _d44;
+
+        _aex.from_sub(_pa[0], _pe[0]) ;   // coord. diff.
+        _aey.from_sub(_pa[1], _pe[1]) ;
+        _aez.from_sub(_pa[2], _pe[2]) ;
+        _aew.from_sub(_pa[3], _pe[3]) ;
+
+        _bex.from_sub(_pb[0], _pe[0]) ;
+        _bey.from_sub(_pb[1], _pe[1]) ;
+        _bez.from_sub(_pb[2], _pe[2]) ;
+        _bew.from_sub(_pb[3], _pe[3]) ;
+
+        _cex.from_sub(_pc[0], _pe[0]) ;
+        _cey.from_sub(_pc[1], _pe[1]) ;
+        _cez.from_sub(_pc[2], _pe[2]) ;
+        _cew.from_sub(_pc[3], _pe[3]) ;
+
+        _dex.from_sub(_pd[0], _pe[0]) ;
+        _dey.from_sub(_pd[1], _pe[1]) ;
+        _dez.from_sub(_pd[2], _pe[2]) ;
+        _dew.from_sub(_pd[3], _pe[3]) ;
+
+        _ali =  sqr(_aex) +  sqr(_aey)    // lifted terms
+             +  sqr(_aez) - _aew ;
+
+        _bli =  sqr(_bex) +  sqr(_bey)
+             +  sqr(_bez) - _bew ;
+
+        _cli =  sqr(_cex) +  sqr(_cey)
+             +  sqr(_cez) - _cew ;
+
+        _dli =  sqr(_dex) +  sqr(_dey)
+             +  sqr(_dez) - _dew ;
+
+        _aexbey = _aex * _bey ;           // 2 x 2 minors
+        _bexaey = _bex * _aey ;
+        _ab_ = _aexbey - _bexaey ;
+
+        _bexcey = _bex * _cey;
+        _cexbey = _cex * _bey;
+        _bc_ = _bexcey - _cexbey ;
+
+        _cexdey = _cex * _dey;
+        _dexcey = _dex * _cey;
+        _cd_ = _cexdey - _dexcey ;
+
+        _dexaey = _dex * _aey;
+        _aexdey = _aex * _dey;
+        _da_ = _dexaey - _aexdey ;
+
+        _aexcey = _aex * _cey;
+        _cexaey = _cex * _aey;
+        _ac_ = _aexcey - _cexaey ;
+
+        _bexdey = _bex * _dey;
+        _dexbey = _dex * _bey;
+        _bd_ = _bexdey - _dexbey ;
+
+        _abc =                            // 3 x 3 minors
+          _aez * _bc_ - _bez * _ac_
+        + _cez * _ab_ ;
+
+        _bcd =
+          _bez * _cd_ - _cez * _bd_
+        + _dez * _bc_ ;
+
+        _cda =
+          _cez * _da_ + _dez * _ac_
+        + _aez * _cd_ ;
+
+        _dab =
+          _dez * _ab_ + _aez * _bd_
+        + _bez * _da_ ;
+
+        _d44 =                            // 4 x 4 result
+          _dli * _abc - _cli * _dab
+        + _bli * _cda - _ali * _bcd ;
+
+        _OK =
+          _d44.lo() >  (REAL_TYPE)0.
+        ||_d44.up() <  (REAL_TYPE)0.
+        ||(_d44.lo() == (REAL_TYPE)0. &&
+           _d44.up() == (REAL_TYPE)0.);
 
         return ( _d44.mid() ) ;
     }
@@ -1391,8 +2641,8 @@
         )
     {
     /*--------------- inball3w predicate, "float" version */
-        REAL_TYPE static const _ER =
-        + 18. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        + 18. * mp::_epsilon ;
 
         REAL_TYPE _aex, _aey, _aez ,
                   _aew, _ali,
@@ -1566,5 +2816,3329 @@
         return ( _d44 ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, given translated coordinates
+     *
+     *   | afx  afy  afz  aft  dot(af, af) |
+     *   | bfx  bfy  bfz  bft  dot(bf, bf) |
+     *   | cfx  cfy  cfz  cft  dot(cf, cf) |
+     *   | dfx  dfy  dfz  dft  dot(df, df) |
+     *   | efx  efy  efz  eft  dot(ef, ef) |
+     *
+     * with AF = A - F, etc. This is only valid when the
+     * coord. diff. are themselves exact.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball4d_t (
+      __const_ptr(REAL_TYPE) _af ,
+      __const_ptr(REAL_TYPE) _bf ,
+      __const_ptr(REAL_TYPE) _cf ,
+      __const_ptr(REAL_TYPE) _df ,
+      __const_ptr(REAL_TYPE) _ef
+        )
+    {
+    /*--------------- inball4d predicate, "shift" version */
+        mp::expansion< 8 > _a_lift, _b_lift, _c_lift ,
+                           _d_lift, _e_lift ;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_, _d2_ad_ ,
+                           _d2_ae_, _d2_bc_, _d2_bd_ ,
+                           _d2_be_, _d2_cd_, _d2_ce_ ,
+                           _d2_de_ ;
+        mp::expansion< 24> _d3_abc, _d3_abd, _d3_abe ,
+                           _d3_acd, _d3_ace, _d3_ade ,
+                           _d3_bcd, _d3_bce, _d3_bde ,
+                           _d3_cde ;
+        mp::expansion<192> _d4abcd, _d4abce, _d4abde ,
+                           _d4acde, _d4bcde ;
+        mp::expansion<15360>_d5full;
+
+        mp::expansion< 1 > _af_zz_(_af[ 2]);
+        mp::expansion< 1 > _bf_zz_(_bf[ 2]);
+        mp::expansion< 1 > _cf_zz_(_cf[ 2]);
+        mp::expansion< 1 > _df_zz_(_df[ 2]);
+        mp::expansion< 1 > _ef_zz_(_ef[ 2]);
+        mp::expansion< 1 > _af_tt_(_af[ 3]);
+        mp::expansion< 1 > _bf_tt_(_bf[ 3]);
+        mp::expansion< 1 > _cf_tt_(_cf[ 3]);
+        mp::expansion< 1 > _df_tt_(_df[ 3]);
+        mp::expansion< 1 > _ef_tt_(_ef[ 3]);
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_af[ 0]),
+            mp::expansion_from_sqr(_af[ 1]),
+            mp::expansion_from_sqr(_af[ 2]),
+            mp::expansion_from_sqr(_af[ 3]),
+            _a_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_bf[ 0]),
+            mp::expansion_from_sqr(_bf[ 1]),
+            mp::expansion_from_sqr(_bf[ 2]),
+            mp::expansion_from_sqr(_bf[ 3]),
+            _b_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_cf[ 0]),
+            mp::expansion_from_sqr(_cf[ 1]),
+            mp::expansion_from_sqr(_cf[ 2]),
+            mp::expansion_from_sqr(_cf[ 3]),
+            _c_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_df[ 0]),
+            mp::expansion_from_sqr(_df[ 1]),
+            mp::expansion_from_sqr(_df[ 2]),
+            mp::expansion_from_sqr(_df[ 3]),
+            _d_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_ef[ 0]),
+            mp::expansion_from_sqr(_ef[ 1]),
+            mp::expansion_from_sqr(_ef[ 2]),
+            mp::expansion_from_sqr(_ef[ 3]),
+            _e_lift ) ;
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_af[ 0], _af[ 1],
+                        _bf[ 0], _bf[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_af[ 0], _af[ 1],
+                        _cf[ 0], _cf[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_af[ 0], _af[ 1],
+                        _df[ 0], _df[ 1],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_af[ 0], _af[ 1],
+                        _ef[ 0], _ef[ 1],
+                        _d2_ae_ ) ;
+
+        compute_det_2x2(_bf[ 0], _bf[ 1],
+                        _cf[ 0], _cf[ 1],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_bf[ 0], _bf[ 1],
+                        _df[ 0], _df[ 1],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_bf[ 0], _bf[ 1],
+                        _ef[ 0], _ef[ 1],
+                        _d2_be_ ) ;
+
+        compute_det_2x2(_cf[ 0], _cf[ 1],
+                        _df[ 0], _df[ 1],
+                        _d2_cd_ ) ;
+
+        compute_det_2x2(_cf[ 0], _cf[ 1],
+                        _ef[ 0], _ef[ 1],
+                        _d2_ce_ ) ;
+
+        compute_det_2x2(_df[ 0], _df[ 1],
+                        _ef[ 0], _ef[ 1],
+                        _d2_de_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_bc_, _af_zz_,
+                        _d2_ac_, _bf_zz_,
+                        _d2_ab_, _cf_zz_,
+                        _d3_abc, +3) ;
+
+        compute_det_3x3(_d2_bd_, _af_zz_,
+                        _d2_ad_, _bf_zz_,
+                        _d2_ab_, _df_zz_,
+                        _d3_abd, +3) ;
+
+        compute_det_3x3(_d2_be_, _af_zz_,
+                        _d2_ae_, _bf_zz_,
+                        _d2_ab_, _ef_zz_,
+                        _d3_abe, +3) ;
+
+        compute_det_3x3(_d2_cd_, _af_zz_,
+                        _d2_ad_, _cf_zz_,
+                        _d2_ac_, _df_zz_,
+                        _d3_acd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _af_zz_,
+                        _d2_ae_, _cf_zz_,
+                        _d2_ac_, _ef_zz_,
+                        _d3_ace, +3) ;
+
+        compute_det_3x3(_d2_de_, _af_zz_,
+                        _d2_ae_, _df_zz_,
+                        _d2_ad_, _ef_zz_,
+                        _d3_ade, +3) ;
+
+        compute_det_3x3(_d2_cd_, _bf_zz_,
+                        _d2_bd_, _cf_zz_,
+                        _d2_bc_, _df_zz_,
+                        _d3_bcd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _bf_zz_,
+                        _d2_be_, _cf_zz_,
+                        _d2_bc_, _ef_zz_,
+                        _d3_bce, +3) ;
+
+        compute_det_3x3(_d2_de_, _bf_zz_,
+                        _d2_be_, _df_zz_,
+                        _d2_bd_, _ef_zz_,
+                        _d3_bde, +3) ;
+
+        compute_det_3x3(_d2_de_, _cf_zz_,
+                        _d2_ce_, _df_zz_,
+                        _d2_cd_, _ef_zz_,
+                        _d3_cde, +3) ;
+
+    /*-------------------------------------- 4 x 4 minors */
+        compute_det_4x4(_d3_bcd, _af_tt_,
+                        _d3_acd, _bf_tt_,
+                        _d3_abd, _cf_tt_,
+                        _d3_abc, _df_tt_,
+                        _d4abcd, +4) ;
+
+        compute_det_4x4(_d3_bce, _af_tt_,
+                        _d3_ace, _bf_tt_,
+                        _d3_abe, _cf_tt_,
+                        _d3_abc, _ef_tt_,
+                        _d4abce, +4) ;
+
+        compute_det_4x4(_d3_bde, _af_tt_,
+                        _d3_ade, _bf_tt_,
+                        _d3_abe, _df_tt_,
+                        _d3_abd, _ef_tt_,
+                        _d4abde, +4) ;
+
+        compute_det_4x4(_d3_cde, _af_tt_,
+                        _d3_ade, _cf_tt_,
+                        _d3_ace, _df_tt_,
+                        _d3_acd, _ef_tt_,
+                        _d4acde, +4) ;
+
+        compute_det_4x4(_d3_cde, _bf_tt_,
+                        _d3_bde, _cf_tt_,
+                        _d3_bce, _df_tt_,
+                        _d3_bcd, _ef_tt_,
+                        _d4bcde, +4) ;
+
+    /*-------------------------------------- 5 x 5 result */
+        compute_det_5x5(_d4bcde, _a_lift,
+                        _d4acde, _b_lift,
+                        _d4abde, _c_lift,
+                        _d4abce, _d_lift,
+                        _d4abcd, _e_lift,
+                        _d5full, +5) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d5full) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, a'la shewchuk
+     *
+     *   | ax  ay  az  at  dot(a, a)  +1. |
+     *   | bx  by  bz  bt  dot(b, b)  +1. |
+     *   | cx  cy  cz  ct  dot(c, c)  +1. |
+     *   | dx  dy  dz  dt  dot(d, d)  +1. |
+     *   | ex  ey  ez  et  dot(e, e)  +1. |
+     *   | fx  fy  fz  ft  dot(f, f)  +1. |
+     *
+     * This is the unweighted "in-ball" predicate in E^4.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball4d_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4d predicate, "exact" version */
+        mp::expansion< 8 > _a_lift, _b_lift, _c_lift ,
+                           _d_lift, _e_lift, _f_lift ;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_, _d2_ad_ ,
+                           _d2_ae_, _d2_af_, _d2_bc_ ,
+                           _d2_bd_, _d2_be_, _d2_bf_ ,
+                           _d2_cd_, _d2_ce_, _d2_cf_ ,
+                           _d2_de_, _d2_df_, _d2_ef_ ;
+        mp::expansion< 24> _d3_abc, _d3_abd, _d3_abe ,
+                           _d3_abf, _d3_acd, _d3_ace ,
+                           _d3_acf, _d3_ade, _d3_adf ,
+                           _d3_aef, _d3_bcd, _d3_bce ,
+                           _d3_bcf, _d3_bde, _d3_bdf ,
+                           _d3_bef, _d3_cde, _d3_cdf ,
+                           _d3_cef, _d3_def ;
+        mp::expansion<192> _d4abcd, _d4abce, _d4abcf ,
+                           _d4abde, _d4abdf, _d4abef ,
+                           _d4acde, _d4acdf, _d4acef ,
+                           _d4adef, _d4bcde, _d4bcdf ,
+                           _d4bcef, _d4bdef, _d4cdef ;
+        mp::expansion<960> _d5abcde, _d5abcdf, _d5abcef ,
+                           _d5abdef, _d5acdef, _d5bcdef ;
+
+        _OK = true;
+
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _af[4], _bf[4], _cf[4], _df[4], _ef[4] ;
+        if (mp::translate_exact<4>(_pa, _pf, _af) &&
+            mp::translate_exact<4>(_pb, _pf, _bf) &&
+            mp::translate_exact<4>(_pc, _pf, _cf) &&
+            mp::translate_exact<4>(_pd, _pf, _df) &&
+            mp::translate_exact<4>(_pe, _pf, _ef) )
+        {
+            return inball4d_t(_af, _bf, _cf, _df, _ef) ;
+        }
+
+        mp::expansion< 1 > _pa_zz_(_pa[ 2]);
+        mp::expansion< 1 > _pb_zz_(_pb[ 2]);
+        mp::expansion< 1 > _pc_zz_(_pc[ 2]);
+        mp::expansion< 1 > _pd_zz_(_pd[ 2]);
+        mp::expansion< 1 > _pe_zz_(_pe[ 2]);
+        mp::expansion< 1 > _pf_zz_(_pf[ 2]);
+        mp::expansion< 1 > _pa_tt_(_pa[ 3]);
+        mp::expansion< 1 > _pb_tt_(_pb[ 3]);
+        mp::expansion< 1 > _pc_tt_(_pc[ 3]);
+        mp::expansion< 1 > _pd_tt_(_pd[ 3]);
+        mp::expansion< 1 > _pe_tt_(_pe[ 3]);
+        mp::expansion< 1 > _pf_tt_(_pf[ 3]);
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pa[ 0]),
+            mp::expansion_from_sqr(_pa[ 1]),
+            mp::expansion_from_sqr(_pa[ 2]),
+            mp::expansion_from_sqr(_pa[ 3]),
+            _a_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pb[ 0]),
+            mp::expansion_from_sqr(_pb[ 1]),
+            mp::expansion_from_sqr(_pb[ 2]),
+            mp::expansion_from_sqr(_pb[ 3]),
+            _b_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pc[ 0]),
+            mp::expansion_from_sqr(_pc[ 1]),
+            mp::expansion_from_sqr(_pc[ 2]),
+            mp::expansion_from_sqr(_pc[ 3]),
+            _c_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pd[ 0]),
+            mp::expansion_from_sqr(_pd[ 1]),
+            mp::expansion_from_sqr(_pd[ 2]),
+            mp::expansion_from_sqr(_pd[ 3]),
+            _d_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pe[ 0]),
+            mp::expansion_from_sqr(_pe[ 1]),
+            mp::expansion_from_sqr(_pe[ 2]),
+            mp::expansion_from_sqr(_pe[ 3]),
+            _e_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pf[ 0]),
+            mp::expansion_from_sqr(_pf[ 1]),
+            mp::expansion_from_sqr(_pf[ 2]),
+            mp::expansion_from_sqr(_pf[ 3]),
+            _f_lift ) ;
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pb[ 0], _pb[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_ae_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_af_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_be_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_bf_ ) ;
+
+        compute_det_2x2(_pc[ 0], _pc[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_cd_ ) ;
+
+        compute_det_2x2(_pc[ 0], _pc[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_ce_ ) ;
+
+        compute_det_2x2(_pc[ 0], _pc[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_cf_ ) ;
+
+        compute_det_2x2(_pd[ 0], _pd[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_de_ ) ;
+
+        compute_det_2x2(_pd[ 0], _pd[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_df_ ) ;
+
+        compute_det_2x2(_pe[ 0], _pe[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_ef_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_bc_, _pa_zz_,
+                        _d2_ac_, _pb_zz_,
+                        _d2_ab_, _pc_zz_,
+                        _d3_abc, +3) ;
+
+        compute_det_3x3(_d2_bd_, _pa_zz_,
+                        _d2_ad_, _pb_zz_,
+                        _d2_ab_, _pd_zz_,
+                        _d3_abd, +3) ;
+
+        compute_det_3x3(_d2_be_, _pa_zz_,
+                        _d2_ae_, _pb_zz_,
+                        _d2_ab_, _pe_zz_,
+                        _d3_abe, +3) ;
+
+        compute_det_3x3(_d2_bf_, _pa_zz_,
+                        _d2_af_, _pb_zz_,
+                        _d2_ab_, _pf_zz_,
+                        _d3_abf, +3) ;
+
+        compute_det_3x3(_d2_cd_, _pa_zz_,
+                        _d2_ad_, _pc_zz_,
+                        _d2_ac_, _pd_zz_,
+                        _d3_acd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _pa_zz_,
+                        _d2_ae_, _pc_zz_,
+                        _d2_ac_, _pe_zz_,
+                        _d3_ace, +3) ;
+
+        compute_det_3x3(_d2_cf_, _pa_zz_,
+                        _d2_af_, _pc_zz_,
+                        _d2_ac_, _pf_zz_,
+                        _d3_acf, +3) ;
+
+        compute_det_3x3(_d2_de_, _pa_zz_,
+                        _d2_ae_, _pd_zz_,
+                        _d2_ad_, _pe_zz_,
+                        _d3_ade, +3) ;
+
+        compute_det_3x3(_d2_df_, _pa_zz_,
+                        _d2_af_, _pd_zz_,
+                        _d2_ad_, _pf_zz_,
+                        _d3_adf, +3) ;
+
+        compute_det_3x3(_d2_ef_, _pa_zz_,
+                        _d2_af_, _pe_zz_,
+                        _d2_ae_, _pf_zz_,
+                        _d3_aef, +3) ;
+
+        compute_det_3x3(_d2_cd_, _pb_zz_,
+                        _d2_bd_, _pc_zz_,
+                        _d2_bc_, _pd_zz_,
+                        _d3_bcd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _pb_zz_,
+                        _d2_be_, _pc_zz_,
+                        _d2_bc_, _pe_zz_,
+                        _d3_bce, +3) ;
+
+        compute_det_3x3(_d2_cf_, _pb_zz_,
+                        _d2_bf_, _pc_zz_,
+                        _d2_bc_, _pf_zz_,
+                        _d3_bcf, +3) ;
+
+        compute_det_3x3(_d2_de_, _pb_zz_,
+                        _d2_be_, _pd_zz_,
+                        _d2_bd_, _pe_zz_,
+                        _d3_bde, +3) ;
+
+        compute_det_3x3(_d2_df_, _pb_zz_,
+                        _d2_bf_, _pd_zz_,
+                        _d2_bd_, _pf_zz_,
+                        _d3_bdf, +3) ;
+
+        compute_det_3x3(_d2_ef_, _pb_zz_,
+                        _d2_bf_, _pe_zz_,
+                        _d2_be_, _pf_zz_,
+                        _d3_bef, +3) ;
+
+        compute_det_3x3(_d2_de_, _pc_zz_,
+                        _d2_ce_, _pd_zz_,
+                        _d2_cd_, _pe_zz_,
+                        _d3_cde, +3) ;
+
+        compute_det_3x3(_d2_df_, _pc_zz_,
+                        _d2_cf_, _pd_zz_,
+                        _d2_cd_, _pf_zz_,
+                        _d3_cdf, +3) ;
+
+        compute_det_3x3(_d2_ef_, _pc_zz_,
+                        _d2_cf_, _pe_zz_,
+                        _d2_ce_, _pf_zz_,
+                        _d3_cef, +3) ;
+
+        compute_det_3x3(_d2_ef_, _pd_zz_,
+                        _d2_df_, _pe_zz_,
+                        _d2_de_, _pf_zz_,
+                        _d3_def, +3) ;
+
+    /*-------------------------------------- 4 x 4 minors */
+        compute_det_4x4(_d3_bcd, _pa_tt_,
+                        _d3_acd, _pb_tt_,
+                        _d3_abd, _pc_tt_,
+                        _d3_abc, _pd_tt_,
+                        _d4abcd, +4) ;
+
+        compute_det_4x4(_d3_bce, _pa_tt_,
+                        _d3_ace, _pb_tt_,
+                        _d3_abe, _pc_tt_,
+                        _d3_abc, _pe_tt_,
+                        _d4abce, +4) ;
+
+        compute_det_4x4(_d3_bcf, _pa_tt_,
+                        _d3_acf, _pb_tt_,
+                        _d3_abf, _pc_tt_,
+                        _d3_abc, _pf_tt_,
+                        _d4abcf, +4) ;
+
+        compute_det_4x4(_d3_bde, _pa_tt_,
+                        _d3_ade, _pb_tt_,
+                        _d3_abe, _pd_tt_,
+                        _d3_abd, _pe_tt_,
+                        _d4abde, +4) ;
+
+        compute_det_4x4(_d3_bdf, _pa_tt_,
+                        _d3_adf, _pb_tt_,
+                        _d3_abf, _pd_tt_,
+                        _d3_abd, _pf_tt_,
+                        _d4abdf, +4) ;
+
+        compute_det_4x4(_d3_bef, _pa_tt_,
+                        _d3_aef, _pb_tt_,
+                        _d3_abf, _pe_tt_,
+                        _d3_abe, _pf_tt_,
+                        _d4abef, +4) ;
+
+        compute_det_4x4(_d3_cde, _pa_tt_,
+                        _d3_ade, _pc_tt_,
+                        _d3_ace, _pd_tt_,
+                        _d3_acd, _pe_tt_,
+                        _d4acde, +4) ;
+
+        compute_det_4x4(_d3_cdf, _pa_tt_,
+                        _d3_adf, _pc_tt_,
+                        _d3_acf, _pd_tt_,
+                        _d3_acd, _pf_tt_,
+                        _d4acdf, +4) ;
+
+        compute_det_4x4(_d3_cef, _pa_tt_,
+                        _d3_aef, _pc_tt_,
+                        _d3_acf, _pe_tt_,
+                        _d3_ace, _pf_tt_,
+                        _d4acef, +4) ;
+
+        compute_det_4x4(_d3_def, _pa_tt_,
+                        _d3_aef, _pd_tt_,
+                        _d3_adf, _pe_tt_,
+                        _d3_ade, _pf_tt_,
+                        _d4adef, +4) ;
+
+        compute_det_4x4(_d3_cde, _pb_tt_,
+                        _d3_bde, _pc_tt_,
+                        _d3_bce, _pd_tt_,
+                        _d3_bcd, _pe_tt_,
+                        _d4bcde, +4) ;
+
+        compute_det_4x4(_d3_cdf, _pb_tt_,
+                        _d3_bdf, _pc_tt_,
+                        _d3_bcf, _pd_tt_,
+                        _d3_bcd, _pf_tt_,
+                        _d4bcdf, +4) ;
+
+        compute_det_4x4(_d3_cef, _pb_tt_,
+                        _d3_bef, _pc_tt_,
+                        _d3_bcf, _pe_tt_,
+                        _d3_bce, _pf_tt_,
+                        _d4bcef, +4) ;
+
+        compute_det_4x4(_d3_def, _pb_tt_,
+                        _d3_bef, _pd_tt_,
+                        _d3_bdf, _pe_tt_,
+                        _d3_bde, _pf_tt_,
+                        _d4bdef, +4) ;
+
+        compute_det_4x4(_d3_def, _pc_tt_,
+                        _d3_cef, _pd_tt_,
+                        _d3_cdf, _pe_tt_,
+                        _d3_cde, _pf_tt_,
+                        _d4cdef, +4) ;
+
+    /*-------------------------------------- 5 x 5 minors */
+        unitary_det_5x5(_d4bcde, _d4acde,
+                        _d4abde, _d4abce,
+                        _d4abcd,
+                        _d5abcde, +5) ;
+
+        unitary_det_5x5(_d4bcdf, _d4acdf,
+                        _d4abdf, _d4abcf,
+                        _d4abcd,
+                        _d5abcdf, +5) ;
+
+        unitary_det_5x5(_d4bcef, _d4acef,
+                        _d4abef, _d4abcf,
+                        _d4abce,
+                        _d5abcef, +5) ;
+
+        unitary_det_5x5(_d4bdef, _d4adef,
+                        _d4abef, _d4abdf,
+                        _d4abde,
+                        _d5abdef, +5) ;
+
+        unitary_det_5x5(_d4cdef, _d4adef,
+                        _d4acef, _d4acdf,
+                        _d4acde,
+                        _d5acdef, +5) ;
+
+        unitary_det_5x5(_d4cdef, _d4bdef,
+                        _d4bcef, _d4bcdf,
+                        _d4bcde,
+                        _d5bcdef, +5) ;
+
+    /*-------------------------------------- 6 x 6 result */
+        return (REAL_TYPE)
+        compute_sgn_6x6(_d5bcdef, _a_lift,
+                        _d5acdef, _b_lift,
+                        _d5abdef, _c_lift,
+                        _d5abcef, _d_lift,
+                        _d5abcdf, _e_lift,
+                        _d5abcde, _f_lift,
+                        +5) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Adaptive evaluation of the in-ball determinant
+     *
+     *   | afx  afy  afz  aft  dot(af, af) |
+     *   | bfx  bfy  bfz  bft  dot(bf, bf) |
+     *   | cfx  cfy  cfz  cft  dot(cf, cf) |
+     *   | dfx  dfy  dfz  dft  dot(df, df) |
+     *   | efx  efy  efz  eft  dot(ef, ef) |
+     *
+     * Stage B evaluates the translated det. exactly, given
+     * the rounded coord. diff. AF = A - F, etc. Each term
+     * is of degree 6 in the diff., so the error in stage B
+     * is bounded by (6 EPS + O(EPS^2)) times the permanent.
+     * When the diff. are all exact, stage B is also exact.
+     * Otherwise, the full 6 x 6 determinant is required.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball4d_a (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4d predicate, "adapt" version */
+        REAL_TYPE constexpr _EB =
+        +  6. * mp::_epsilon
+        +256. * mp::_epsilon * mp::_epsilon ;
+
+        REAL_TYPE _afx, _afy, _afz, _aft ,
+                  _bfx, _bfy, _bfz, _bft ,
+                  _cfx, _cfy, _cfz, _cft ,
+                  _dfx, _dfy, _dfz, _dft ,
+                  _efx, _efy, _efz, _eft ;
+        REAL_TYPE _afxt, _afyt, _afzt, _aftt ,
+                  _bfxt, _bfyt, _bfzt, _bftt ,
+                  _cfxt, _cfyt, _cfzt, _cftt ,
+                  _dfxt, _dfyt, _dfzt, _dftt ,
+                  _efxt, _efyt, _efzt, _eftt ;
+        REAL_TYPE _ALI, _BLI, _CLI, _DLI, _ELI ;
+        REAL_TYPE _AB_, _AC_, _AD_, _AE_ ,
+                  _BC_, _BD_, _BE_, _CD_ ,
+                  _CE_, _DE_ ;
+        REAL_TYPE _ABC, _ABD, _ABE, _ACD ,
+                  _ACE, _ADE, _BCD, _BCE ,
+                  _BDE, _CDE ;
+        REAL_TYPE _ABCD, _ABCE, _ABDE, _ACDE ,
+                  _BCDE ;
+
+        REAL_TYPE _d55, _PP, _FT ;
+
+        _OK = false;
+
+        mp::one_one_sub_full(             // coord. diff.
+            _pa[0], _pf[0], _afx, _afxt) ;
+        mp::one_one_sub_full(
+            _pa[1], _pf[1], _afy, _afyt) ;
+        mp::one_one_sub_full(
+            _pa[2], _pf[2], _afz, _afzt) ;
+        mp::one_one_sub_full(
+            _pa[3], _pf[3], _aft, _aftt) ;
+
+        mp::one_one_sub_full(
+            _pb[0], _pf[0], _bfx, _bfxt) ;
+        mp::one_one_sub_full(
+            _pb[1], _pf[1], _bfy, _bfyt) ;
+        mp::one_one_sub_full(
+            _pb[2], _pf[2], _bfz, _bfzt) ;
+        mp::one_one_sub_full(
+            _pb[3], _pf[3], _bft, _bftt) ;
+
+        mp::one_one_sub_full(
+            _pc[0], _pf[0], _cfx, _cfxt) ;
+        mp::one_one_sub_full(
+            _pc[1], _pf[1], _cfy, _cfyt) ;
+        mp::one_one_sub_full(
+            _pc[2], _pf[2], _cfz, _cfzt) ;
+        mp::one_one_sub_full(
+            _pc[3], _pf[3], _cft, _cftt) ;
+
+        mp::one_one_sub_full(
+            _pd[0], _pf[0], _dfx, _dfxt) ;
+        mp::one_one_sub_full(
+            _pd[1], _pf[1], _dfy, _dfyt) ;
+        mp::one_one_sub_full(
+            _pd[2], _pf[2], _dfz, _dfzt) ;
+        mp::one_one_sub_full(
+            _pd[3], _pf[3], _dft, _dftt) ;
+
+        mp::one_one_sub_full(
+            _pe[0], _pf[0], _efx, _efxt) ;
+        mp::one_one_sub_full(
+            _pe[1], _pf[1], _efy, _efyt) ;
+        mp::one_one_sub_full(
+            _pe[2], _pf[2], _efz, _efzt) ;
+        mp::one_one_sub_full(
+            _pe[3], _pf[3], _eft, _eftt) ;
+
+        _ALI = _afx * _afx + _afy * _afy  // lifted terms
+             + _afz * _afz + _aft * _aft ;
+
+        _BLI = _bfx * _bfx + _bfy * _bfy
+             + _bfz * _bfz + _bft * _bft ;
+
+        _CLI = _cfx * _cfx + _cfy * _cfy
+             + _cfz * _cfz + _cft * _cft ;
+
+        _DLI = _dfx * _dfx + _dfy * _dfy
+             + _dfz * _dfz + _dft * _dft ;
+
+        _ELI = _efx * _efx + _efy * _efy
+             + _efz * _efz + _eft * _eft ;
+
+        _AB_ = std::abs(_afx * _bfy)      // 2 x 2 minors
+             + std::abs(_bfx * _afy) ;
+        _AC_ = std::abs(_afx * _cfy)
+             + std::abs(_cfx * _afy) ;
+        _AD_ = std::abs(_afx * _dfy)
+             + std::abs(_dfx * _afy) ;
+        _AE_ = std::abs(_afx * _efy)
+             + std::abs(_efx * _afy) ;
+        _BC_ = std::abs(_bfx * _cfy)
+             + std::abs(_cfx * _bfy) ;
+        _BD_ = std::abs(_bfx * _dfy)
+             + std::abs(_dfx * _bfy) ;
+        _BE_ = std::abs(_bfx * _efy)
+             + std::abs(_efx * _bfy) ;
+        _CD_ = std::abs(_cfx * _dfy)
+             + std::abs(_dfx * _cfy) ;
+        _CE_ = std::abs(_cfx * _efy)
+             + std::abs(_efx * _cfy) ;
+        _DE_ = std::abs(_dfx * _efy)
+             + std::abs(_efx * _dfy) ;
+
+        _ABC =                            // 3 x 3 minors
+          std::abs(_afz) * _BC_ + std::abs(_bfz) * _AC_
+        + std::abs(_cfz) * _AB_ ;
+
+        _ABD =
+          std::abs(_afz) * _BD_ + std::abs(_bfz) * _AD_
+        + std::abs(_dfz) * _AB_ ;
+
+        _ABE =
+          std::abs(_afz) * _BE_ + std::abs(_bfz) * _AE_
+        + std::abs(_efz) * _AB_ ;
+
+        _ACD =
+          std::abs(_afz) * _CD_ + std::abs(_cfz) * _AD_
+        + std::abs(_dfz) * _AC_ ;
+
+        _ACE =
+          std::abs(_afz) * _CE_ + std::abs(_cfz) * _AE_
+        + std::abs(_efz) * _AC_ ;
+
+        _ADE =
+          std::abs(_afz) * _DE_ + std::abs(_dfz) * _AE_
+        + std::abs(_efz) * _AD_ ;
+
+        _BCD =
+          std::abs(_bfz) * _CD_ + std::abs(_cfz) * _BD_
+        + std::abs(_dfz) * _BC_ ;
+
+        _BCE =
+          std::abs(_bfz) * _CE_ + std::abs(_cfz) * _BE_
+        + std::abs(_efz) * _BC_ ;
+
+        _BDE =
+          std::abs(_bfz) * _DE_ + std::abs(_dfz) * _BE_
+        + std::abs(_efz) * _BD_ ;
+
+        _CDE =
+          std::abs(_cfz) * _DE_ + std::abs(_dfz) * _CE_
+        + std::abs(_efz) * _CD_ ;
+
+        _ABCD =                           // 4 x 4 minors
+          std::abs(_aft) * _BCD + std::abs(_bft) * _ACD
+        + std::abs(_cft) * _ABD + std::abs(_dft) * _ABC ;
+
+        _ABCE =
+          std::abs(_aft) * _BCE + std::abs(_bft) * _ACE
+        + std::abs(_cft) * _ABE + std::abs(_eft) * _ABC ;
+
+        _ABDE =
+          std::abs(_aft) * _BDE + std::abs(_bft) * _ADE
+        + std::abs(_dft) * _ABE + std::abs(_eft) * _ABD ;
+
+        _ACDE =
+          std::abs(_aft) * _CDE + std::abs(_cft) * _ADE
+        + std::abs(_dft) * _ACE + std::abs(_eft) * _ACD ;
+
+        _BCDE =
+          std::abs(_bft) * _CDE + std::abs(_cft) * _BDE
+        + std::abs(_dft) * _BCE + std::abs(_eft) * _BCD ;
+
+        _PP  =                            // permanent
+          _ALI * _BCDE + _BLI * _ACDE
+        + _CLI * _ABDE + _DLI * _ABCE
+        + _ELI * _ABCD ;
+
+        if (!std::isfinite(_PP))
+            return ( +0.0 ) ;
+
+    /*------------- stage B: exact det. of rounded diff. */
+        REAL_TYPE _af[4] = {_afx, _afy, _afz, _aft} ;
+        REAL_TYPE _bf[4] = {_bfx, _bfy, _bfz, _bft} ;
+        REAL_TYPE _cf[4] = {_cfx, _cfy, _cfz, _cft} ;
+        REAL_TYPE _df[4] = {_dfx, _dfy, _dfz, _dft} ;
+        REAL_TYPE _ef[4] = {_efx, _efy, _efz, _eft} ;
+
+        _d55 = inball4d_t(_af, _bf, _cf, _df, _ef) ;
+
+        _FT  = _PP * _EB ;
+
+        if (_d55 >= _FT || -_d55 >= _FT)
+        {
+            _OK = true; return _d55 ;
+        }
+
+        if (_afxt == 0. && _afyt == 0. && _afzt == 0. &&
+            _aftt == 0. && _bfxt == 0. && _bfyt == 0. &&
+            _bfzt == 0. && _bftt == 0. && _cfxt == 0. &&
+            _cfyt == 0. && _cfzt == 0. && _cftt == 0. &&
+            _dfxt == 0. && _dfyt == 0. && _dfzt == 0. &&
+            _dftt == 0. && _efxt == 0. && _efyt == 0. &&
+            _efzt == 0. && _eftt == 0. )
+        {                   // diff. exact, so det. exact
+            _OK = true; return _d55 ;
+        }
+
+        return ( _d55 ) ;
+    }
+
+    __normal_call REAL_TYPE inball4d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4d predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        + 25. * _dd_eps ;
+
+        dd_flt    _afx, _afy, _afz, _aft, _ali ,
+                  _bfx, _bfy, _bfz, _bft, _bli ,
+                  _cfx, _cfy, _cfz, _cft, _cli ,
+                  _dfx, _dfy, _dfz, _dft, _dli ,
+                  _efx, _efy, _efz, _eft, _eli ;
+        dd_flt    _afxbfy, _bfxafy ,
+                  _afxcfy, _cfxafy ,
+                  _afxdfy, _dfxafy ,
+                  _afxefy, _efxafy ,
+                  _bfxcfy, _cfxbfy ,
+                  _bfxdfy, _dfxbfy ,
+                  _bfxefy, _efxbfy ,
+                  _cfxdfy, _dfxcfy ,
+                  _cfxefy, _efxcfy ,
+                  _dfxefy, _efxdfy ;
+        dd_flt    _ab_, _ac_, _ad_, _ae_ ,
+                  _bc_, _bd_, _be_, _cd_ ,
+                  _ce_, _de_ ;
+        dd_flt    _abc, _abd, _abe, _acd ,
+                  _ace, _ade, _bcd, _bce ,
+                  _bde, _cde ;
+        dd_flt    _abcd, _abce, _abde, _acde ,
+                  _bcde ;
+
+        REAL_TYPE _AFZ, _AFT ,
+                  _BFZ, _BFT ,
+                  _CFZ, _CFT ,
+                  _DFZ, _DFT ,
+                  _EFZ, _EFT ;
+        REAL_TYPE _AB_, _AC_, _AD_, _AE_ ,
+                  _BC_, _BD_, _BE_, _CD_ ,
+                  _CE_, _DE_ ;
+        REAL_TYPE _ABC, _ABD, _ABE, _ACD ,
+                  _ACE, _ADE, _BCD, _BCE ,
+                  _BDE, _CDE ;
+        REAL_TYPE _ABCD, _ABCE, _ABDE, _ACDE ,
+                  _BCDE ;
+
+        dd_flt    _d55 ;
+        REAL_TYPE _FT ;
+
+        _afx.from_sub(_pa[0], _pf[0]) ;   // coord. diff.
+        _afy.from_sub(_pa[1], _pf[1]) ;
+        _afz.from_sub(_pa[2], _pf[2]) ;
+        _aft.from_sub(_pa[3], _pf[3]) ;
+
+        _AFZ = std::abs (_afz.hi()) ;
+        _AFT = std::abs (_aft.hi()) ;
+
+        _bfx.from_sub(_pb[0], _pf[0]) ;
+        _bfy.from_sub(_pb[1], _pf[1]) ;
+        _bfz.from_sub(_pb[2], _pf[2]) ;
+        _bft.from_sub(_pb[3], _pf[3]) ;
+
+        _BFZ = std::abs (_bfz.hi()) ;
+        _BFT = std::abs (_bft.hi()) ;
+
+        _cfx.from_sub(_pc[0], _pf[0]) ;
+        _cfy.from_sub(_pc[1], _pf[1]) ;
+        _cfz.from_sub(_pc[2], _pf[2]) ;
+        _cft.from_sub(_pc[3], _pf[3]) ;
+
+        _CFZ = std::abs (_cfz.hi()) ;
+        _CFT = std::abs (_cft.hi()) ;
+
+        _dfx.from_sub(_pd[0], _pf[0]) ;
+        _dfy.from_sub(_pd[1], _pf[1]) ;
+        _dfz.from_sub(_pd[2], _pf[2]) ;
+        _dft.from_sub(_pd[3], _pf[3]) ;
+
+        _DFZ = std::abs (_dfz.hi()) ;
+        _DFT = std::abs (_dft.hi()) ;
+
+        _efx.from_sub(_pe[0], _pf[0]) ;
+        _efy.from_sub(_pe[1], _pf[1]) ;
+        _efz.from_sub(_pe[2], _pf[2]) ;
+        _eft.from_sub(_pe[3], _pf[3]) ;
+
+        _EFZ = std::abs (_efz.hi()) ;
+        _EFT = std::abs (_eft.hi()) ;
+
+        _ali = _afx * _afx + _afy * _afy  // lifted terms
+             + _afz * _afz + _aft * _aft ;
+
+        _bli = _bfx * _bfx + _bfy * _bfy
+             + _bfz * _bfz + _bft * _bft ;
+
+        _cli = _cfx * _cfx + _cfy * _cfy
+             + _cfz * _cfz + _cft * _cft ;
+
+        _dli = _dfx * _dfx + _dfy * _dfy
+             + _dfz * _dfz + _dft * _dft ;
+
+        _eli = _efx * _efx + _efy * _efy
+             + _efz * _efz + _eft * _eft ;
+
+        _afxbfy = _afx * _bfy ;           // 2 x 2 minors
+        _bfxafy = _bfx * _afy ;
+        _ab_ = _afxbfy - _bfxafy ;
+        _AB_ = std::abs(_afxbfy.hi())
+             + std::abs(_bfxafy.hi()) ;
+
+        _afxcfy = _afx * _cfy ;
+        _cfxafy = _cfx * _afy ;
+        _ac_ = _afxcfy - _cfxafy ;
+        _AC_ = std::abs(_afxcfy.hi())
+             + std::abs(_cfxafy.hi()) ;
+
+        _afxdfy = _afx * _dfy ;
+        _dfxafy = _dfx * _afy ;
+        _ad_ = _afxdfy - _dfxafy ;
+        _AD_ = std::abs(_afxdfy.hi())
+             + std::abs(_dfxafy.hi()) ;
+
+        _afxefy = _afx * _efy ;
+        _efxafy = _efx * _afy ;
+        _ae_ = _afxefy - _efxafy ;
+        _AE_ = std::abs(_afxefy.hi())
+             + std::abs(_efxafy.hi()) ;
+
+        _bfxcfy = _bfx * _cfy ;
+        _cfxbfy = _cfx * _bfy ;
+        _bc_ = _bfxcfy - _cfxbfy ;
+        _BC_ = std::abs(_bfxcfy.hi())
+             + std::abs(_cfxbfy.hi()) ;
+
+        _bfxdfy = _bfx * _dfy ;
+        _dfxbfy = _dfx * _bfy ;
+        _bd_ = _bfxdfy - _dfxbfy ;
+        _BD_ = std::abs(_bfxdfy.hi())
+             + std::abs(_dfxbfy.hi()) ;
+
+        _bfxefy = _bfx * _efy ;
+        _efxbfy = _efx * _bfy ;
+        _be_ = _bfxefy - _efxbfy ;
+        _BE_ = std::abs(_bfxefy.hi())
+             + std::abs(_efxbfy.hi()) ;
+
+        _cfxdfy = _cfx * _dfy ;
+        _dfxcfy = _dfx * _cfy ;
+        _cd_ = _cfxdfy - _dfxcfy ;
+        _CD_ = std::abs(_cfxdfy.hi())
+             + std::abs(_dfxcfy.hi()) ;
+
+        _cfxefy = _cfx * _efy ;
+        _efxcfy = _efx * _cfy ;
+        _ce_ = _cfxefy - _efxcfy ;
+        _CE_ = std::abs(_cfxefy.hi())
+             + std::abs(_efxcfy.hi()) ;
+
+        _dfxefy = _dfx * _efy ;
+        _efxdfy = _efx * _dfy ;
+        _de_ = _dfxefy - _efxdfy ;
+        _DE_ = std::abs(_dfxefy.hi())
+             + std::abs(_efxdfy.hi()) ;
+
+        _abc =                            // 3 x 3 minors
+          _afz * _bc_ - _bfz * _ac_
+        + _cfz * _ab_ ;
+        _ABC =
+          _AFZ * _BC_ + _BFZ * _AC_
+        + _CFZ * _AB_ ;
+
+        _abd =
+          _afz * _bd_ - _bfz * _ad_
+        + _dfz * _ab_ ;
+        _ABD =
+          _AFZ * _BD_ + _BFZ * _AD_
+        + _DFZ * _AB_ ;
+
+        _abe =
+          _afz * _be_ - _bfz * _ae_
+        + _efz * _ab_ ;
+        _ABE =
+          _AFZ * _BE_ + _BFZ * _AE_
+        + _EFZ * _AB_ ;
+
+        _acd =
+          _afz * _cd_ - _cfz * _ad_
+        + _dfz * _ac_ ;
+        _ACD =
+          _AFZ * _CD_ + _CFZ * _AD_
+        + _DFZ * _AC_ ;
+
+        _ace =
+          _afz * _ce_ - _cfz * _ae_
+        + _efz * _ac_ ;
+        _ACE =
+          _AFZ * _CE_ + _CFZ * _AE_
+        + _EFZ * _AC_ ;
+
+        _ade =
+          _afz * _de_ - _dfz * _ae_
+        + _efz * _ad_ ;
+        _ADE =
+          _AFZ * _DE_ + _DFZ * _AE_
+        + _EFZ * _AD_ ;
+
+        _bcd =
+          _bfz * _cd_ - _cfz * _bd_
+        + _dfz * _bc_ ;
+        _BCD =
+          _BFZ * _CD_ + _CFZ * _BD_
+        + _DFZ * _BC_ ;
+
+        _bce =
+          _bfz * _ce_ - _cfz * _be_
+        + _efz * _bc_ ;
+        _BCE =
+          _BFZ * _CE_ + _CFZ * _BE_
+        + _EFZ * _BC_ ;
+
+        _bde =
+          _bfz * _de_ - _dfz * _be_
+        + _efz * _bd_ ;
+        _BDE =
+          _BFZ * _DE_ + _DFZ * _BE_
+        + _EFZ * _BD_ ;
+
+        _cde =
+          _cfz * _de_ - _dfz * _ce_
+        + _efz * _cd_ ;
+        _CDE =
+          _CFZ * _DE_ + _DFZ * _CE_
+        + _EFZ * _CD_ ;
+
+        _abcd =                           // 4 x 4 minors
+          _dft * _abc - _cft * _abd
+        + _bft * _acd - _aft * _bcd ;
+        _ABCD =
+          _AFT * _BCD + _BFT * _ACD
+        + _CFT * _ABD + _DFT * _ABC ;
+
+        _abce =
+          _eft * _abc - _cft * _abe
+        + _bft * _ace - _aft * _bce ;
+        _ABCE =
+          _AFT * _BCE + _BFT * _ACE
+        + _CFT * _ABE + _EFT * _ABC ;
+
+        _abde =
+          _eft * _abd - _dft * _abe
+        + _bft * _ade - _aft * _bde ;
+        _ABDE =
+          _AFT * _BDE + _BFT * _ADE
+        + _DFT * _ABE + _EFT * _ABD ;
+
+        _acde =
+          _eft * _acd - _dft * _ace
+        + _cft * _ade - _aft * _cde ;
+        _ACDE =
+          _AFT * _CDE + _CFT * _ADE
+        + _DFT * _ACE + _EFT * _ACD ;
+
+        _bcde =
+          _eft * _bcd - _dft * _bce
+        + _cft * _bde - _bft * _cde ;
+        _BCDE =
+          _BFT * _CDE + _CFT * _BDE
+        + _DFT * _BCE + _EFT * _BCD ;
+
+        _FT  =                            // roundoff tol
+          _ali.hi() * _BCDE + _bli.hi() * _ACDE
+        + _cli.hi() * _ABDE + _dli.hi() * _ABCE
+        + _eli.hi() * _ABCD ;
+
+        _FT *= _ER ;
+
+        _d55 =                            // 5 x 5 result
+          _ali * _bcde - _bli * _acde
+        + _cli * _abde - _dli * _abce
+        + _eli * _abcd ;
+
+        _OK  =
+          _d55.hi() > +_FT || _d55.hi() < -_FT ;
+
+        return ( _d55.hi() ) ;
+    }
+
+    __normal_call REAL_TYPE inball4d_i (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4d predicate, "bound" version */
+        ia_flt    _afx, _afy, _afz, _aft, _ali ,
+                  _bfx, _bfy, _bfz, _bft, _bli ,
+                  _cfx, _cfy, _cfz, _cft, _cli ,
+                  _dfx, _dfy, _dfz, _dft, _dli ,
+                  _efx, _efy, _efz, _eft, _eli ;
+        ia_flt    _ab_, _ac_, _ad_, _ae_ ,
+                  _bc_, _bd_, _be_, _cd_ ,
+                  _ce_, _de_ ;
+        ia_flt    _abc, _abd, _abe, _acd ,
+                  _ace, _ade, _bcd, _bce ,
+                  _bde, _cde ;
+        ia_flt    _abcd, _abce, _abde, _acde ,
+                  _bcde ;
+        ia_flt    _d55;
+
+        _afx.from_sub(_pa[0], _pf[0]) ;   // coord. diff.
+        _afy.from_sub(_pa[1], _pf[1]) ;
+        _afz.from_sub(_pa[2], _pf[2]) ;
+        _aft.from_sub(_pa[3], _pf[3]) ;
+
+        _bfx.from_sub(_pb[0], _pf[0]) ;
+        _bfy.from_sub(_pb[1], _pf[1]) ;
+        _bfz.from_sub(_pb[2], _pf[2]) ;
+        _bft.from_sub(_pb[3], _pf[3]) ;
+
+        _cfx.from_sub(_pc[0], _pf[0]) ;
+        _cfy.from_sub(_pc[1], _pf[1]) ;
+        _cfz.from_sub(_pc[2], _pf[2]) ;
+        _cft.from_sub(_pc[3], _pf[3]) ;
+
+        _dfx.from_sub(_pd[0], _pf[0]) ;
+        _dfy.from_sub(_pd[1], _pf[1]) ;
+        _dfz.from_sub(_pd[2], _pf[2]) ;
+        _dft.from_sub(_pd[3], _pf[3]) ;
+
+        _efx.from_sub(_pe[0], _pf[0]) ;
+        _efy.from_sub(_pe[1], _pf[1]) ;
+        _efz.from_sub(_pe[2], _pf[2]) ;
+        _eft.from_sub(_pe[3], _pf[3]) ;
+
+        _ali = sqr (_afx) + sqr (_afy)    // lifted terms
+             + sqr (_afz) + sqr (_aft) ;
+
+        _bli = sqr (_bfx) + sqr (_bfy)
+             + sqr (_bfz) + sqr (_bft) ;
+
+        _cli = sqr (_cfx) + sqr (_cfy)
+             + sqr (_cfz) + sqr (_cft) ;
+
+        _dli = sqr (_dfx) + sqr (_dfy)
+             + sqr (_dfz) + sqr (_dft) ;
+
+        _eli = sqr (_efx) + sqr (_efy)
+             + sqr (_efz) + sqr (_eft) ;
+
+        _ab_ = _afx * _bfy                // 2 x 2 minors
+             - _bfx * _afy ;
+        _ac_ = _afx * _cfy
+             - _cfx * _afy ;
+        _ad_ = _afx * _dfy
+             - _dfx * _afy ;
+        _ae_ = _afx * _efy
+             - _efx * _afy ;
+        _bc_ = _bfx * _cfy
+             - _cfx * _bfy ;
+        _bd_ = _bfx * _dfy
+             - _dfx * _bfy ;
+        _be_ = _bfx * _efy
+             - _efx * _bfy ;
+        _cd_ = _cfx * _dfy
+             - _dfx * _cfy ;
+        _ce_ = _cfx * _efy
+             - _efx * _cfy ;
+        _de_ = _dfx * _efy
+             - _efx * _dfy ;
+
+        _abc =                            // 3 x 3 minors
+          _afz * _bc_ - _bfz * _ac_
+        + _cfz * _ab_ ;
+
+        _abd =
+          _afz * _bd_ - _bfz * _ad_
+        + _dfz * _ab_ ;
+
+        _abe =
+          _afz * _be_ - _bfz * _ae_
+        + _efz * _ab_ ;
+
+        _acd =
+          _afz * _cd_ - _cfz * _ad_
+        + _dfz * _ac_ ;
+
+        _ace =
+          _afz * _ce_ - _cfz * _ae_
+        + _efz * _ac_ ;
+
+        _ade =
+          _afz * _de_ - _dfz * _ae_
+        + _efz * _ad_ ;
+
+        _bcd =
+          _bfz * _cd_ - _cfz * _bd_
+        + _dfz * _bc_ ;
+
+        _bce =
+          _bfz * _ce_ - _cfz * _be_
+        + _efz * _bc_ ;
+
+        _bde =
+          _bfz * _de_ - _dfz * _be_
+        + _efz * _bd_ ;
+
+        _cde =
+          _cfz * _de_ - _dfz * _ce_
+        + _efz * _cd_ ;
+
+        _abcd =                           // 4 x 4 minors
+          _dft * _abc - _cft * _abd
+        + _bft * _acd - _aft * _bcd ;
+
+        _abce =
+          _eft * _abc - _cft * _abe
+        + _bft * _ace - _aft * _bce ;
+
+        _abde =
+          _eft * _abd - _dft * _abe
+        + _bft * _ade - _aft * _bde ;
+
+        _acde =
+          _eft * _acd - _dft * _ace
+        + _cft * _ade - _aft * _cde ;
+
+        _bcde =
+          _eft * _bcd - _dft * _bce
+        + _cft * _bde - _bft * _cde ;
+
+        _d55 =                            // 5 x 5 result
+          _ali * _bcde - _bli * _acde
+        + _cli * _abde - _dli * _abce
+        + _eli * _abcd ;
+
+        _OK  =
+          _d55.lo() >  (REAL_TYPE)0.
+        ||_d55.up() <  (REAL_TYPE)0.
+        ||(_d55.lo() == (REAL_TYPE)0. &&
+           _d55.up() == (REAL_TYPE)0.);
+
+        return ( _d55.mid() ) ;
+    }
+
+    __normal_call REAL_TYPE inball4d_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4d predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+        + 25. * mp::_epsilon ;
+
+        REAL_TYPE _afx, _afy, _afz, _aft, _ali ,
+                  _bfx, _bfy, _bfz, _bft, _bli ,
+                  _cfx, _cfy, _cfz, _cft, _cli ,
+                  _dfx, _dfy, _dfz, _dft, _dli ,
+                  _efx, _efy, _efz, _eft, _eli ;
+        REAL_TYPE _afxbfy, _bfxafy ,
+                  _afxcfy, _cfxafy ,
+                  _afxdfy, _dfxafy ,
+                  _afxefy, _efxafy ,
+                  _bfxcfy, _cfxbfy ,
+                  _bfxdfy, _dfxbfy ,
+                  _bfxefy, _efxbfy ,
+                  _cfxdfy, _dfxcfy ,
+                  _cfxefy, _efxcfy ,
+                  _dfxefy, _efxdfy ;
+        REAL_TYPE _ab_, _ac_, _ad_, _ae_ ,
+                  _bc_, _bd_, _be_, _cd_ ,
+                  _ce_, _de_ ;
+        REAL_TYPE _abc, _abd, _abe, _acd ,
+                  _ace, _ade, _bcd, _bce ,
+                  _bde, _cde ;
+        REAL_TYPE _abcd, _abce, _abde, _acde ,
+                  _bcde ;
+
+        REAL_TYPE _AFZ, _AFT ,
+                  _BFZ, _BFT ,
+                  _CFZ, _CFT ,
+                  _DFZ, _DFT ,
+                  _EFZ, _EFT ;
+        REAL_TYPE _AB_, _AC_, _AD_, _AE_ ,
+                  _BC_, _BD_, _BE_, _CD_ ,
+                  _CE_, _DE_ ;
+        REAL_TYPE _ABC, _ABD, _ABE, _ACD ,
+                  _ACE, _ADE, _BCD, _BCE ,
+                  _BDE, _CDE ;
+        REAL_TYPE _ABCD, _ABCE, _ABDE, _ACDE ,
+                  _BCDE ;
+
+        REAL_TYPE _d55, _FT ;
+
+        _afx = _pa [0] - _pf [0] ;        // coord. diff.
+        _afy = _pa [1] - _pf [1] ;
+        _afz = _pa [2] - _pf [2] ;
+        _aft = _pa [3] - _pf [3] ;
+
+        _AFZ = std::abs (_afz) ;
+        _AFT = std::abs (_aft) ;
+
+        _bfx = _pb [0] - _pf [0] ;
+        _bfy = _pb [1] - _pf [1] ;
+        _bfz = _pb [2] - _pf [2] ;
+        _bft = _pb [3] - _pf [3] ;
+
+        _BFZ = std::abs (_bfz) ;
+        _BFT = std::abs (_bft) ;
+
+        _cfx = _pc [0] - _pf [0] ;
+        _cfy = _pc [1] - _pf [1] ;
+        _cfz = _pc [2] - _pf [2] ;
+        _cft = _pc [3] - _pf [3] ;
+
+        _CFZ = std::abs (_cfz) ;
+        _CFT = std::abs (_cft) ;
+
+        _dfx = _pd [0] - _pf [0] ;
+        _dfy = _pd [1] - _pf [1] ;
+        _dfz = _pd [2] - _pf [2] ;
+        _dft = _pd [3] - _pf [3] ;
+
+        _DFZ = std::abs (_dfz) ;
+        _DFT = std::abs (_dft) ;
+
+        _efx = _pe [0] - _pf [0] ;
+        _efy = _pe [1] - _pf [1] ;
+        _efz = _pe [2] - _pf [2] ;
+        _eft = _pe [3] - _pf [3] ;
+
+        _EFZ = std::abs (_efz) ;
+        _EFT = std::abs (_eft) ;
+
+        _ali = _afx * _afx + _afy * _afy  // lifted terms
+             + _afz * _afz + _aft * _aft ;
+
+        _bli = _bfx * _bfx + _bfy * _bfy
+             + _bfz * _bfz + _bft * _bft ;
+
+        _cli = _cfx * _cfx + _cfy * _cfy
+             + _cfz * _cfz + _cft * _cft ;
+
+        _dli = _dfx * _dfx + _dfy * _dfy
+             + _dfz * _dfz + _dft * _dft ;
+
+        _eli = _efx * _efx + _efy * _efy
+             + _efz * _efz + _eft * _eft ;
+
+        _afxbfy = _afx * _bfy ;           // 2 x 2 minors
+        _bfxafy = _bfx * _afy ;
+        _ab_ = _afxbfy - _bfxafy ;
+        _AB_ = std::abs(_afxbfy)
+             + std::abs(_bfxafy) ;
+
+        _afxcfy = _afx * _cfy ;
+        _cfxafy = _cfx * _afy ;
+        _ac_ = _afxcfy - _cfxafy ;
+        _AC_ = std::abs(_afxcfy)
+             + std::abs(_cfxafy) ;
+
+        _afxdfy = _afx * _dfy ;
+        _dfxafy = _dfx * _afy ;
+        _ad_ = _afxdfy - _dfxafy ;
+        _AD_ = std::abs(_afxdfy)
+             + std::abs(_dfxafy) ;
+
+        _afxefy = _afx * _efy ;
+        _efxafy = _efx * _afy ;
+        _ae_ = _afxefy - _efxafy ;
+        _AE_ = std::abs(_afxefy)
+             + std::abs(_efxafy) ;
+
+        _bfxcfy = _bfx * _cfy ;
+        _cfxbfy = _cfx * _bfy ;
+        _bc_ = _bfxcfy - _cfxbfy ;
+        _BC_ = std::abs(_bfxcfy)
+             + std::abs(_cfxbfy) ;
+
+        _bfxdfy = _bfx * _dfy ;
+        _dfxbfy = _dfx * _bfy ;
+        _bd_ = _bfxdfy - _dfxbfy ;
+        _BD_ = std::abs(_bfxdfy)
+             + std::abs(_dfxbfy) ;
+
+        _bfxefy = _bfx * _efy ;
+        _efxbfy = _efx * _bfy ;
+        _be_ = _bfxefy - _efxbfy ;
+        _BE_ = std::abs(_bfxefy)
+             + std::abs(_efxbfy) ;
+
+        _cfxdfy = _cfx * _dfy ;
+        _dfxcfy = _dfx * _cfy ;
+        _cd_ = _cfxdfy - _dfxcfy ;
+        _CD_ = std::abs(_cfxdfy)
+             + std::abs(_dfxcfy) ;
+
+        _cfxefy = _cfx * _efy ;
+        _efxcfy = _efx * _cfy ;
+        _ce_ = _cfxefy - _efxcfy ;
+        _CE_ = std::abs(_cfxefy)
+             + std::abs(_efxcfy) ;
+
+        _dfxefy = _dfx * _efy ;
+        _efxdfy = _efx * _dfy ;
+        _de_ = _dfxefy - _efxdfy ;
+        _DE_ = std::abs(_dfxefy)
+             + std::abs(_efxdfy) ;
+
+        _abc =                            // 3 x 3 minors
+          _afz * _bc_ - _bfz * _ac_
+        + _cfz * _ab_ ;
+        _ABC =
+          _AFZ * _BC_ + _BFZ * _AC_
+        + _CFZ * _AB_ ;
+
+        _abd =
+          _afz * _bd_ - _bfz * _ad_
+        + _dfz * _ab_ ;
+        _ABD =
+          _AFZ * _BD_ + _BFZ * _AD_
+        + _DFZ * _AB_ ;
+
+        _abe =
+          _afz * _be_ - _bfz * _ae_
+        + _efz * _ab_ ;
+        _ABE =
+          _AFZ * _BE_ + _BFZ * _AE_
+        + _EFZ * _AB_ ;
+
+        _acd =
+          _afz * _cd_ - _cfz * _ad_
+        + _dfz * _ac_ ;
+        _ACD =
+          _AFZ * _CD_ + _CFZ * _AD_
+        + _DFZ * _AC_ ;
+
+        _ace =
+          _afz * _ce_ - _cfz * _ae_
+        + _efz * _ac_ ;
+        _ACE =
+          _AFZ * _CE_ + _CFZ * _AE_
+        + _EFZ * _AC_ ;
+
+        _ade =
+          _afz * _de_ - _dfz * _ae_
+        + _efz * _ad_ ;
+        _ADE =
+          _AFZ * _DE_ + _DFZ * _AE_
+        + _EFZ * _AD_ ;
+
+        _bcd =
+          _bfz * _cd_ - _cfz * _bd_
+        + _dfz * _bc_ ;
+        _BCD =
+          _BFZ * _CD_ + _CFZ * _BD_
+        + _DFZ * _BC_ ;
+
+        _bce =
+          _bfz * _ce_ - _cfz * _be_
+        + _efz * _bc_ ;
+        _BCE =
+          _BFZ * _CE_ + _CFZ * _BE_
+        + _EFZ * _BC_ ;
+
+        _bde =
+          _bfz * _de_ - _dfz * _be_
+        + _efz * _bd_ ;
+        _BDE =
+          _BFZ * _DE_ + _DFZ * _BE_
+        + _EFZ * _BD_ ;
+
+        _cde =
+          _cfz * _de_ - _dfz * _ce_
+        + _efz * _cd_ ;
+        _CDE =
+          _CFZ * _DE_ + _DFZ * _CE_
+        + _EFZ * _CD_ ;
+
+        _abcd =                           // 4 x 4 minors
+          _dft * _abc - _cft * _abd
+        + _bft * _acd - _aft * _bcd ;
+        _ABCD =
+          _AFT * _BCD + _BFT * _ACD
+        + _CFT * _ABD + _DFT * _ABC ;
+
+        _abce =
+          _eft * _abc - _cft * _abe
+        + _bft * _ace - _aft * _bce ;
+        _ABCE =
+          _AFT * _BCE + _BFT * _ACE
+        + _CFT * _ABE + _EFT * _ABC ;
+
+        _abde =
+          _eft * _abd - _dft * _abe
+        + _bft * _ade - _aft * _bde ;
+        _ABDE =
+          _AFT * _BDE + _BFT * _ADE
+        + _DFT * _ABE + _EFT * _ABD ;
+
+        _acde =
+          _eft * _acd - _dft * _ace
+        + _cft * _ade - _aft * _cde ;
+        _ACDE =
+          _AFT * _CDE + _CFT * _ADE
+        + _DFT * _ACE + _EFT * _ACD ;
+
+        _bcde =
+          _eft * _bcd - _dft * _bce
+        + _cft * _bde - _bft * _cde ;
+        _BCDE =
+          _BFT * _CDE + _CFT * _BDE
+        + _DFT * _BCE + _EFT * _BCD ;
+
+        _FT  =                            // roundoff tol
+          _ali * _BCDE + _bli * _ACDE
+        + _cli * _ABDE + _dli * _ABCE
+        + _eli * _ABCD ;
+
+        _FT *= _ER ;
+
+        _d55 =                            // 5 x 5 result
+          _ali * _bcde - _bli * _acde
+        + _cli * _abde - _dli * _abce
+        + _eli * _abcd ;
+
+        _OK  =
+          _d55 > +_FT || _d55 < -_FT ;
+
+        return ( _d55 ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, given translated coordinates
+     *
+     *   | afx  afy  afz  aft  dot(af, af) - afw |
+     *   | bfx  bfy  bfz  bft  dot(bf, bf) - bfw |
+     *   | cfx  cfy  cfz  cft  dot(cf, cf) - cfw |
+     *   | dfx  dfy  dfz  dft  dot(df, df) - dfw |
+     *   | efx  efy  efz  eft  dot(ef, ef) - efw |
+     *
+     * with AF = A - F, etc. This is only valid when the
+     * coord. diff. are themselves exact.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball4w_t (
+      __const_ptr(REAL_TYPE) _af ,
+      __const_ptr(REAL_TYPE) _bf ,
+      __const_ptr(REAL_TYPE) _cf ,
+      __const_ptr(REAL_TYPE) _df ,
+      __const_ptr(REAL_TYPE) _ef
+        )
+    {
+    /*--------------- inball4w predicate, "shift" version */
+        mp::expansion< 9 > _a_lift, _b_lift, _c_lift ,
+                           _d_lift, _e_lift ;
+        mp::expansion< 8 > _t_lift;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_, _d2_ad_ ,
+                           _d2_ae_, _d2_bc_, _d2_bd_ ,
+                           _d2_be_, _d2_cd_, _d2_ce_ ,
+                           _d2_de_ ;
+        mp::expansion< 24> _d3_abc, _d3_abd, _d3_abe ,
+                           _d3_acd, _d3_ace, _d3_ade ,
+                           _d3_bcd, _d3_bce, _d3_bde ,
+                           _d3_cde ;
+        mp::expansion<192> _d4abcd, _d4abce, _d4abde ,
+                           _d4acde, _d4bcde ;
+        mp::expansion<17280>_d5full;
+
+        mp::expansion< 1 > _af_zz_(_af[ 2]);
+        mp::expansion< 1 > _bf_zz_(_bf[ 2]);
+        mp::expansion< 1 > _cf_zz_(_cf[ 2]);
+        mp::expansion< 1 > _df_zz_(_df[ 2]);
+        mp::expansion< 1 > _ef_zz_(_ef[ 2]);
+        mp::expansion< 1 > _af_tt_(_af[ 3]);
+        mp::expansion< 1 > _bf_tt_(_bf[ 3]);
+        mp::expansion< 1 > _cf_tt_(_cf[ 3]);
+        mp::expansion< 1 > _df_tt_(_df[ 3]);
+        mp::expansion< 1 > _ef_tt_(_ef[ 3]);
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_af[ 0]),
+            mp::expansion_from_sqr(_af[ 1]),
+            mp::expansion_from_sqr(_af[ 2]),
+            mp::expansion_from_sqr(_af[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _af[ 4] , _a_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_bf[ 0]),
+            mp::expansion_from_sqr(_bf[ 1]),
+            mp::expansion_from_sqr(_bf[ 2]),
+            mp::expansion_from_sqr(_bf[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _bf[ 4] , _b_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_cf[ 0]),
+            mp::expansion_from_sqr(_cf[ 1]),
+            mp::expansion_from_sqr(_cf[ 2]),
+            mp::expansion_from_sqr(_cf[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _cf[ 4] , _c_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_df[ 0]),
+            mp::expansion_from_sqr(_df[ 1]),
+            mp::expansion_from_sqr(_df[ 2]),
+            mp::expansion_from_sqr(_df[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _df[ 4] , _d_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_ef[ 0]),
+            mp::expansion_from_sqr(_ef[ 1]),
+            mp::expansion_from_sqr(_ef[ 2]),
+            mp::expansion_from_sqr(_ef[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _ef[ 4] , _e_lift);
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_af[ 0], _af[ 1],
+                        _bf[ 0], _bf[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_af[ 0], _af[ 1],
+                        _cf[ 0], _cf[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_af[ 0], _af[ 1],
+                        _df[ 0], _df[ 1],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_af[ 0], _af[ 1],
+                        _ef[ 0], _ef[ 1],
+                        _d2_ae_ ) ;
+
+        compute_det_2x2(_bf[ 0], _bf[ 1],
+                        _cf[ 0], _cf[ 1],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_bf[ 0], _bf[ 1],
+                        _df[ 0], _df[ 1],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_bf[ 0], _bf[ 1],
+                        _ef[ 0], _ef[ 1],
+                        _d2_be_ ) ;
+
+        compute_det_2x2(_cf[ 0], _cf[ 1],
+                        _df[ 0], _df[ 1],
+                        _d2_cd_ ) ;
+
+        compute_det_2x2(_cf[ 0], _cf[ 1],
+                        _ef[ 0], _ef[ 1],
+                        _d2_ce_ ) ;
+
+        compute_det_2x2(_df[ 0], _df[ 1],
+                        _ef[ 0], _ef[ 1],
+                        _d2_de_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_bc_, _af_zz_,
+                        _d2_ac_, _bf_zz_,
+                        _d2_ab_, _cf_zz_,
+                        _d3_abc, +3) ;
+
+        compute_det_3x3(_d2_bd_, _af_zz_,
+                        _d2_ad_, _bf_zz_,
+                        _d2_ab_, _df_zz_,
+                        _d3_abd, +3) ;
+
+        compute_det_3x3(_d2_be_, _af_zz_,
+                        _d2_ae_, _bf_zz_,
+                        _d2_ab_, _ef_zz_,
+                        _d3_abe, +3) ;
+
+        compute_det_3x3(_d2_cd_, _af_zz_,
+                        _d2_ad_, _cf_zz_,
+                        _d2_ac_, _df_zz_,
+                        _d3_acd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _af_zz_,
+                        _d2_ae_, _cf_zz_,
+                        _d2_ac_, _ef_zz_,
+                        _d3_ace, +3) ;
+
+        compute_det_3x3(_d2_de_, _af_zz_,
+                        _d2_ae_, _df_zz_,
+                        _d2_ad_, _ef_zz_,
+                        _d3_ade, +3) ;
+
+        compute_det_3x3(_d2_cd_, _bf_zz_,
+                        _d2_bd_, _cf_zz_,
+                        _d2_bc_, _df_zz_,
+                        _d3_bcd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _bf_zz_,
+                        _d2_be_, _cf_zz_,
+                        _d2_bc_, _ef_zz_,
+                        _d3_bce, +3) ;
+
+        compute_det_3x3(_d2_de_, _bf_zz_,
+                        _d2_be_, _df_zz_,
+                        _d2_bd_, _ef_zz_,
+                        _d3_bde, +3) ;
+
+        compute_det_3x3(_d2_de_, _cf_zz_,
+                        _d2_ce_, _df_zz_,
+                        _d2_cd_, _ef_zz_,
+                        _d3_cde, +3) ;
+
+    /*-------------------------------------- 4 x 4 minors */
+        compute_det_4x4(_d3_bcd, _af_tt_,
+                        _d3_acd, _bf_tt_,
+                        _d3_abd, _cf_tt_,
+                        _d3_abc, _df_tt_,
+                        _d4abcd, +4) ;
+
+        compute_det_4x4(_d3_bce, _af_tt_,
+                        _d3_ace, _bf_tt_,
+                        _d3_abe, _cf_tt_,
+                        _d3_abc, _ef_tt_,
+                        _d4abce, +4) ;
+
+        compute_det_4x4(_d3_bde, _af_tt_,
+                        _d3_ade, _bf_tt_,
+                        _d3_abe, _df_tt_,
+                        _d3_abd, _ef_tt_,
+                        _d4abde, +4) ;
+
+        compute_det_4x4(_d3_cde, _af_tt_,
+                        _d3_ade, _cf_tt_,
+                        _d3_ace, _df_tt_,
+                        _d3_acd, _ef_tt_,
+                        _d4acde, +4) ;
+
+        compute_det_4x4(_d3_cde, _bf_tt_,
+                        _d3_bde, _cf_tt_,
+                        _d3_bce, _df_tt_,
+                        _d3_bcd, _ef_tt_,
+                        _d4bcde, +4) ;
+
+    /*-------------------------------------- 5 x 5 result */
+        compute_det_5x5(_d4bcde, _a_lift,
+                        _d4acde, _b_lift,
+                        _d4abde, _c_lift,
+                        _d4abce, _d_lift,
+                        _d4abcd, _e_lift,
+                        _d5full, +5) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d5full) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, a'la shewchuk
+     *
+     *   | ax  ay  az  at  dot(a, a) - aw  +1. |
+     *   | bx  by  bz  bt  dot(b, b) - bw  +1. |
+     *   | cx  cy  cz  ct  dot(c, c) - cw  +1. |
+     *   | dx  dy  dz  dt  dot(d, d) - dw  +1. |
+     *   | ex  ey  ez  et  dot(e, e) - ew  +1. |
+     *   | fx  fy  fz  ft  dot(f, f) - fw  +1. |
+     *
+     * This is the weighted "in-ball" predicate in E^4.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball4w_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4w predicate, "exact" version */
+        mp::expansion< 9 > _a_lift, _b_lift, _c_lift ,
+                           _d_lift, _e_lift, _f_lift ;
+        mp::expansion< 8 > _t_lift;
+        mp::expansion< 4 > _d2_ab_, _d2_ac_, _d2_ad_ ,
+                           _d2_ae_, _d2_af_, _d2_bc_ ,
+                           _d2_bd_, _d2_be_, _d2_bf_ ,
+                           _d2_cd_, _d2_ce_, _d2_cf_ ,
+                           _d2_de_, _d2_df_, _d2_ef_ ;
+        mp::expansion< 24> _d3_abc, _d3_abd, _d3_abe ,
+                           _d3_abf, _d3_acd, _d3_ace ,
+                           _d3_acf, _d3_ade, _d3_adf ,
+                           _d3_aef, _d3_bcd, _d3_bce ,
+                           _d3_bcf, _d3_bde, _d3_bdf ,
+                           _d3_bef, _d3_cde, _d3_cdf ,
+                           _d3_cef, _d3_def ;
+        mp::expansion<192> _d4abcd, _d4abce, _d4abcf ,
+                           _d4abde, _d4abdf, _d4abef ,
+                           _d4acde, _d4acdf, _d4acef ,
+                           _d4adef, _d4bcde, _d4bcdf ,
+                           _d4bcef, _d4bdef, _d4cdef ;
+        mp::expansion<960> _d5abcde, _d5abcdf, _d5abcef ,
+                           _d5abdef, _d5acdef, _d5bcdef ;
+
+        _OK = true;
+
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _af[5], _bf[5], _cf[5], _df[5], _ef[5] ;
+        if (mp::translate_exact<5>(_pa, _pf, _af) &&
+            mp::translate_exact<5>(_pb, _pf, _bf) &&
+            mp::translate_exact<5>(_pc, _pf, _cf) &&
+            mp::translate_exact<5>(_pd, _pf, _df) &&
+            mp::translate_exact<5>(_pe, _pf, _ef) )
+        {
+            return inball4w_t(_af, _bf, _cf, _df, _ef) ;
+        }
+
+        mp::expansion< 1 > _pa_zz_(_pa[ 2]);
+        mp::expansion< 1 > _pb_zz_(_pb[ 2]);
+        mp::expansion< 1 > _pc_zz_(_pc[ 2]);
+        mp::expansion< 1 > _pd_zz_(_pd[ 2]);
+        mp::expansion< 1 > _pe_zz_(_pe[ 2]);
+        mp::expansion< 1 > _pf_zz_(_pf[ 2]);
+        mp::expansion< 1 > _pa_tt_(_pa[ 3]);
+        mp::expansion< 1 > _pb_tt_(_pb[ 3]);
+        mp::expansion< 1 > _pc_tt_(_pc[ 3]);
+        mp::expansion< 1 > _pd_tt_(_pd[ 3]);
+        mp::expansion< 1 > _pe_tt_(_pe[ 3]);
+        mp::expansion< 1 > _pf_tt_(_pf[ 3]);
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pa[ 0]),
+            mp::expansion_from_sqr(_pa[ 1]),
+            mp::expansion_from_sqr(_pa[ 2]),
+            mp::expansion_from_sqr(_pa[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pa[ 4] , _a_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pb[ 0]),
+            mp::expansion_from_sqr(_pb[ 1]),
+            mp::expansion_from_sqr(_pb[ 2]),
+            mp::expansion_from_sqr(_pb[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pb[ 4] , _b_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pc[ 0]),
+            mp::expansion_from_sqr(_pc[ 1]),
+            mp::expansion_from_sqr(_pc[ 2]),
+            mp::expansion_from_sqr(_pc[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pc[ 4] , _c_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pd[ 0]),
+            mp::expansion_from_sqr(_pd[ 1]),
+            mp::expansion_from_sqr(_pd[ 2]),
+            mp::expansion_from_sqr(_pd[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pd[ 4] , _d_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pe[ 0]),
+            mp::expansion_from_sqr(_pe[ 1]),
+            mp::expansion_from_sqr(_pe[ 2]),
+            mp::expansion_from_sqr(_pe[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pe[ 4] , _e_lift);
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pf[ 0]),
+            mp::expansion_from_sqr(_pf[ 1]),
+            mp::expansion_from_sqr(_pf[ 2]),
+            mp::expansion_from_sqr(_pf[ 3]),
+            _t_lift ) ;
+        mp::expansion_sub(
+            _t_lift , _pf[ 4] , _f_lift);
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pb[ 0], _pb[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_ae_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_af_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_be_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_bf_ ) ;
+
+        compute_det_2x2(_pc[ 0], _pc[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_cd_ ) ;
+
+        compute_det_2x2(_pc[ 0], _pc[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_ce_ ) ;
+
+        compute_det_2x2(_pc[ 0], _pc[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_cf_ ) ;
+
+        compute_det_2x2(_pd[ 0], _pd[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_de_ ) ;
+
+        compute_det_2x2(_pd[ 0], _pd[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_df_ ) ;
+
+        compute_det_2x2(_pe[ 0], _pe[ 1],
+                        _pf[ 0], _pf[ 1],
+                        _d2_ef_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_bc_, _pa_zz_,
+                        _d2_ac_, _pb_zz_,
+                        _d2_ab_, _pc_zz_,
+                        _d3_abc, +3) ;
+
+        compute_det_3x3(_d2_bd_, _pa_zz_,
+                        _d2_ad_, _pb_zz_,
+                        _d2_ab_, _pd_zz_,
+                        _d3_abd, +3) ;
+
+        compute_det_3x3(_d2_be_, _pa_zz_,
+                        _d2_ae_, _pb_zz_,
+                        _d2_ab_, _pe_zz_,
+                        _d3_abe, +3) ;
+
+        compute_det_3x3(_d2_bf_, _pa_zz_,
+                        _d2_af_, _pb_zz_,
+                        _d2_ab_, _pf_zz_,
+                        _d3_abf, +3) ;
+
+        compute_det_3x3(_d2_cd_, _pa_zz_,
+                        _d2_ad_, _pc_zz_,
+                        _d2_ac_, _pd_zz_,
+                        _d3_acd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _pa_zz_,
+                        _d2_ae_, _pc_zz_,
+                        _d2_ac_, _pe_zz_,
+                        _d3_ace, +3) ;
+
+        compute_det_3x3(_d2_cf_, _pa_zz_,
+                        _d2_af_, _pc_zz_,
+                        _d2_ac_, _pf_zz_,
+                        _d3_acf, +3) ;
+
+        compute_det_3x3(_d2_de_, _pa_zz_,
+                        _d2_ae_, _pd_zz_,
+                        _d2_ad_, _pe_zz_,
+                        _d3_ade, +3) ;
+
+        compute_det_3x3(_d2_df_, _pa_zz_,
+                        _d2_af_, _pd_zz_,
+                        _d2_ad_, _pf_zz_,
+                        _d3_adf, +3) ;
+
+        compute_det_3x3(_d2_ef_, _pa_zz_,
+                        _d2_af_, _pe_zz_,
+                        _d2_ae_, _pf_zz_,
+                        _d3_aef, +3) ;
+
+        compute_det_3x3(_d2_cd_, _pb_zz_,
+                        _d2_bd_, _pc_zz_,
+                        _d2_bc_, _pd_zz_,
+                        _d3_bcd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _pb_zz_,
+                        _d2_be_, _pc_zz_,
+                        _d2_bc_, _pe_zz_,
+                        _d3_bce, +3) ;
+
+        compute_det_3x3(_d2_cf_, _pb_zz_,
+                        _d2_bf_, _pc_zz_,
+                        _d2_bc_, _pf_zz_,
+                        _d3_bcf, +3) ;
+
+        compute_det_3x3(_d2_de_, _pb_zz_,
+                        _d2_be_, _pd_zz_,
+                        _d2_bd_, _pe_zz_,
+                        _d3_bde, +3) ;
+
+        compute_det_3x3(_d2_df_, _pb_zz_,
+                        _d2_bf_, _pd_zz_,
+                        _d2_bd_, _pf_zz_,
+                        _d3_bdf, +3) ;
+
+        compute_det_3x3(_d2_ef_, _pb_zz_,
+                        _d2_bf_, _pe_zz_,
+                        _d2_be_, _pf_zz_,
+                        _d3_bef, +3) ;
+
+        compute_det_3x3(_d2_de_, _pc_zz_,
+                        _d2_ce_, _pd_zz_,
+                        _d2_cd_, _pe_zz_,
+                        _d3_cde, +3) ;
+
+        compute_det_3x3(_d2_df_, _pc_zz_,
+                        _d2_cf_, _pd_zz_,
+                        _d2_cd_, _pf_zz_,
+                        _d3_cdf, +3) ;
+
+        compute_det_3x3(_d2_ef_, _pc_zz_,
+                        _d2_cf_, _pe_zz_,
+                        _d2_ce_, _pf_zz_,
+                        _d3_cef, +3) ;
+
+        compute_det_3x3(_d2_ef_, _pd_zz_,
+                        _d2_df_, _pe_zz_,
+                        _d2_de_, _pf_zz_,
+                        _d3_def, +3) ;
+
+    /*-------------------------------------- 4 x 4 minors */
+        compute_det_4x4(_d3_bcd, _pa_tt_,
+                        _d3_acd, _pb_tt_,
+                        _d3_abd, _pc_tt_,
+                        _d3_abc, _pd_tt_,
+                        _d4abcd, +4) ;
+
+        compute_det_4x4(_d3_bce, _pa_tt_,
+                        _d3_ace, _pb_tt_,
+                        _d3_abe, _pc_tt_,
+                        _d3_abc, _pe_tt_,
+                        _d4abce, +4) ;
+
+        compute_det_4x4(_d3_bcf, _pa_tt_,
+                        _d3_acf, _pb_tt_,
+                        _d3_abf, _pc_tt_,
+                        _d3_abc, _pf_tt_,
+                        _d4abcf, +4) ;
+
+        compute_det_4x4(_d3_bde, _pa_tt_,
+                        _d3_ade, _pb_tt_,
+                        _d3_abe, _pd_tt_,
+                        _d3_abd, _pe_tt_,
+                        _d4abde, +4) ;
+
+        compute_det_4x4(_d3_bdf, _pa_tt_,
+                        _d3_adf, _pb_tt_,
+                        _d3_abf, _pd_tt_,
+                        _d3_abd, _pf_tt_,
+                        _d4abdf, +4) ;
+
+        compute_det_4x4(_d3_bef, _pa_tt_,
+                        _d3_aef, _pb_tt_,
+                        _d3_abf, _pe_tt_,
+                        _d3_abe, _pf_tt_,
+                        _d4abef, +4) ;
+
+        compute_det_4x4(_d3_cde, _pa_tt_,
+                        _d3_ade, _pc_tt_,
+                        _d3_ace, _pd_tt_,
+                        _d3_acd, _pe_tt_,
+                        _d4acde, +4) ;
+
+        compute_det_4x4(_d3_cdf, _pa_tt_,
+                        _d3_adf, _pc_tt_,
+                        _d3_acf, _pd_tt_,
+                        _d3_acd, _pf_tt_,
+                        _d4acdf, +4) ;
+
+        compute_det_4x4(_d3_cef, _pa_tt_,
+                        _d3_aef, _pc_tt_,
+                        _d3_acf, _pe_tt_,
+                        _d3_ace, _pf_tt_,
+                        _d4acef, +4) ;
+
+        compute_det_4x4(_d3_def, _pa_tt_,
+                        _d3_aef, _pd_tt_,
+                        _d3_adf, _pe_tt_,
+                        _d3_ade, _pf_tt_,
+                        _d4adef, +4) ;
+
+        compute_det_4x4(_d3_cde, _pb_tt_,
+                        _d3_bde, _pc_tt_,
+                        _d3_bce, _pd_tt_,
+                        _d3_bcd, _pe_tt_,
+                        _d4bcde, +4) ;
+
+        compute_det_4x4(_d3_cdf, _pb_tt_,
+                        _d3_bdf, _pc_tt_,
+                        _d3_bcf, _pd_tt_,
+                        _d3_bcd, _pf_tt_,
+                        _d4bcdf, +4) ;
+
+        compute_det_4x4(_d3_cef, _pb_tt_,
+                        _d3_bef, _pc_tt_,
+                        _d3_bcf, _pe_tt_,
+                        _d3_bce, _pf_tt_,
+                        _d4bcef, +4) ;
+
+        compute_det_4x4(_d3_def, _pb_tt_,
+                        _d3_bef, _pd_tt_,
+                        _d3_bdf, _pe_tt_,
+                        _d3_bde, _pf_tt_,
+                        _d4bdef, +4) ;
+
+        compute_det_4x4(_d3_def, _pc_tt_,
+                        _d3_cef, _pd_tt_,
+                        _d3_cdf, _pe_tt_,
+                        _d3_cde, _pf_tt_,
+                        _d4cdef, +4) ;
+
+    /*-------------------------------------- 5 x 5 minors */
+        unitary_det_5x5(_d4bcde, _d4acde,
+                        _d4abde, _d4abce,
+                        _d4abcd,
+                        _d5abcde, +5) ;
+
+        unitary_det_5x5(_d4bcdf, _d4acdf,
+                        _d4abdf, _d4abcf,
+                        _d4abcd,
+                        _d5abcdf, +5) ;
+
+        unitary_det_5x5(_d4bcef, _d4acef,
+                        _d4abef, _d4abcf,
+                        _d4abce,
+                        _d5abcef, +5) ;
+
+        unitary_det_5x5(_d4bdef, _d4adef,
+                        _d4abef, _d4abdf,
+                        _d4abde,
+                        _d5abdef, +5) ;
+
+        unitary_det_5x5(_d4cdef, _d4adef,
+                        _d4acef, _d4acdf,
+                        _d4acde,
+                        _d5acdef, +5) ;
+
+        unitary_det_5x5(_d4cdef, _d4bdef,
+                        _d4bcef, _d4bcdf,
+                        _d4bcde,
+                        _d5bcdef, +5) ;
+
+    /*-------------------------------------- 6 x 6 result */
+        return (REAL_TYPE)
+        compute_sgn_6x6(_d5bcdef, _a_lift,
+                        _d5acdef, _b_lift,
+                        _d5abdef, _c_lift,
+                        _d5abcef, _d_lift,
+                        _d5abcdf, _e_lift,
+                        _d5abcde, _f_lift,
+                        +5) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Adaptive evaluation of the weighted in-ball det., as
+     * per inball4d_a. The lifted terms are bounded by the
+     * sum of squares plus |w|, and are still of degree at
+     * most 2 in the diff., so the same bound applies.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE inball4w_a (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4w predicate, "adapt" version */
+        REAL_TYPE constexpr _EB =
+        +  6. * mp::_epsilon
+        +256. * mp::_epsilon * mp::_epsilon ;
+
+        REAL_TYPE _afx, _afy, _afz, _aft, _afw ,
+                  _bfx, _bfy, _bfz, _bft, _bfw ,
+                  _cfx, _cfy, _cfz, _cft, _cfw ,
+                  _dfx, _dfy, _dfz, _dft, _dfw ,
+                  _efx, _efy, _efz, _eft, _efw ;
+        REAL_TYPE _afxt, _afyt, _afzt, _aftt, _afwt ,
+                  _bfxt, _bfyt, _bfzt, _bftt, _bfwt ,
+                  _cfxt, _cfyt, _cfzt, _cftt, _cfwt ,
+                  _dfxt, _dfyt, _dfzt, _dftt, _dfwt ,
+                  _efxt, _efyt, _efzt, _eftt, _efwt ;
+        REAL_TYPE _ALI, _BLI, _CLI, _DLI, _ELI ;
+        REAL_TYPE _AB_, _AC_, _AD_, _AE_ ,
+                  _BC_, _BD_, _BE_, _CD_ ,
+                  _CE_, _DE_ ;
+        REAL_TYPE _ABC, _ABD, _ABE, _ACD ,
+                  _ACE, _ADE, _BCD, _BCE ,
+                  _BDE, _CDE ;
+        REAL_TYPE _ABCD, _ABCE, _ABDE, _ACDE ,
+                  _BCDE ;
+
+        REAL_TYPE _d55, _PP, _FT ;
+
+        _OK = false;
+
+        mp::one_one_sub_full(             // coord. diff.
+            _pa[0], _pf[0], _afx, _afxt) ;
+        mp::one_one_sub_full(
+            _pa[1], _pf[1], _afy, _afyt) ;
+        mp::one_one_sub_full(
+            _pa[2], _pf[2], _afz, _afzt) ;
+        mp::one_one_sub_full(
+            _pa[3], _pf[3], _aft, _aftt) ;
+        mp::one_one_sub_full(
+            _pa[4], _pf[4], _afw, _afwt) ;
+
+        mp::one_one_sub_full(
+            _pb[0], _pf[0], _bfx, _bfxt) ;
+        mp::one_one_sub_full(
+            _pb[1], _pf[1], _bfy, _bfyt) ;
+        mp::one_one_sub_full(
+            _pb[2], _pf[2], _bfz, _bfzt) ;
+        mp::one_one_sub_full(
+            _pb[3], _pf[3], _bft, _bftt) ;
+        mp::one_one_sub_full(
+            _pb[4], _pf[4], _bfw, _bfwt) ;
+
+        mp::one_one_sub_full(
+            _pc[0], _pf[0], _cfx, _cfxt) ;
+        mp::one_one_sub_full(
+            _pc[1], _pf[1], _cfy, _cfyt) ;
+        mp::one_one_sub_full(
+            _pc[2], _pf[2], _cfz, _cfzt) ;
+        mp::one_one_sub_full(
+            _pc[3], _pf[3], _cft, _cftt) ;
+        mp::one_one_sub_full(
+            _pc[4], _pf[4], _cfw, _cfwt) ;
+
+        mp::one_one_sub_full(
+            _pd[0], _pf[0], _dfx, _dfxt) ;
+        mp::one_one_sub_full(
+            _pd[1], _pf[1], _dfy, _dfyt) ;
+        mp::one_one_sub_full(
+            _pd[2], _pf[2], _dfz, _dfzt) ;
+        mp::one_one_sub_full(
+            _pd[3], _pf[3], _dft, _dftt) ;
+        mp::one_one_sub_full(
+            _pd[4], _pf[4], _dfw, _dfwt) ;
+
+        mp::one_one_sub_full(
+            _pe[0], _pf[0], _efx, _efxt) ;
+        mp::one_one_sub_full(
+            _pe[1], _pf[1], _efy, _efyt) ;
+        mp::one_one_sub_full(
+            _pe[2], _pf[2], _efz, _efzt) ;
+        mp::one_one_sub_full(
+            _pe[3], _pf[3], _eft, _eftt) ;
+        mp::one_one_sub_full(
+            _pe[4], _pf[4], _efw, _efwt) ;
+
+        _ALI = _afx * _afx + _afy * _afy  // lifted terms
+             + _afz * _afz + _aft * _aft
+             + std::abs(_afw) ;
+
+        _BLI = _bfx * _bfx + _bfy * _bfy
+             + _bfz * _bfz + _bft * _bft
+             + std::abs(_bfw) ;
+
+        _CLI = _cfx * _cfx + _cfy * _cfy
+             + _cfz * _cfz + _cft * _cft
+             + std::abs(_cfw) ;
+
+        _DLI = _dfx * _dfx + _dfy * _dfy
+             + _dfz * _dfz + _dft * _dft
+             + std::abs(_dfw) ;
+
+        _ELI = _efx * _efx + _efy * _efy
+             + _efz * _efz + _eft * _eft
+             + std::abs(_efw) ;
+
+        _AB_ = std::abs(_afx * _bfy)      // 2 x 2 minors
+             + std::abs(_bfx * _afy) ;
+        _AC_ = std::abs(_afx * _cfy)
+             + std::abs(_cfx * _afy) ;
+        _AD_ = std::abs(_afx * _dfy)
+             + std::abs(_dfx * _afy) ;
+        _AE_ = std::abs(_afx * _efy)
+             + std::abs(_efx * _afy) ;
+        _BC_ = std::abs(_bfx * _cfy)
+             + std::abs(_cfx * _bfy) ;
+        _BD_ = std::abs(_bfx * _dfy)
+             + std::abs(_dfx * _bfy) ;
+        _BE_ = std::abs(_bfx * _efy)
+             + std::abs(_efx * _bfy) ;
+        _CD_ = std::abs(_cfx * _dfy)
+             + std::abs(_dfx * _cfy) ;
+        _CE_ = std::abs(_cfx * _efy)
+             + std::abs(_efx * _cfy) ;
+        _DE_ = std::abs(_dfx * _efy)
+             + std::abs(_efx * _dfy) ;
+
+        _ABC =                            // 3 x 3 minors
+          std::abs(_afz) * _BC_ + std::abs(_bfz) * _AC_
+        + std::abs(_cfz) * _AB_ ;
+
+        _ABD =
+          std::abs(_afz) * _BD_ + std::abs(_bfz) * _AD_
+        + std::abs(_dfz) * _AB_ ;
+
+        _ABE =
+          std::abs(_afz) * _BE_ + std::abs(_bfz) * _AE_
+        + std::abs(_efz) * _AB_ ;
+
+        _ACD =
+          std::abs(_afz) * _CD_ + std::abs(_cfz) * _AD_
+        + std::abs(_dfz) * _AC_ ;
+
+        _ACE =
+          std::abs(_afz) * _CE_ + std::abs(_cfz) * _AE_
+        + std::abs(_efz) * _AC_ ;
+
+        _ADE =
+          std::abs(_afz) * _DE_ + std::abs(_dfz) * _AE_
+        + std::abs(_efz) * _AD_ ;
+
+        _BCD =
+          std::abs(_bfz) * _CD_ + std::abs(_cfz) * _BD_
+        + std::abs(_dfz) * _BC_ ;
+
+        _BCE =
+          std::abs(_bfz) * _CE_ + std::abs(_cfz) * _BE_
+        + std::abs(_efz) * _BC_ ;
+
+        _BDE =
+          std::abs(_bfz) * _DE_ + std::abs(_dfz) * _BE_
+        + std::abs(_efz) * _BD_ ;
+
+        _CDE =
+          std::abs(_cfz) * _DE_ + std::abs(_dfz) * _CE_
+        + std::abs(_efz) * _CD_ ;
+
+        _ABCD =                           // 4 x 4 minors
+          std::abs(_aft) * _BCD + std::abs(_bft) * _ACD
+        + std::abs(_cft) * _ABD + std::abs(_dft) * _ABC ;
+
+        _ABCE =
+          std::abs(_aft) * _BCE + std::abs(_bft) * _ACE
+        + std::abs(_cft) * _ABE + std::abs(_eft) * _ABC ;
+
+        _ABDE =
+          std::abs(_aft) * _BDE + std::abs(_bft) * _ADE
+        + std::abs(_dft) * _ABE + std::abs(_eft) * _ABD ;
+
+        _ACDE =
+          std::abs(_aft) * _CDE + std::abs(_cft) * _ADE
+        + std::abs(_dft) * _ACE + std::abs(_eft) * _ACD ;
+
+        _BCDE =
+          std::abs(_bft) * _CDE + std::abs(_cft) * _BDE
+        + std::abs(_dft) * _BCE + std::abs(_eft) * _BCD ;
+
+        _PP  =                            // permanent
+          _ALI * _BCDE + _BLI * _ACDE
+        + _CLI * _ABDE + _DLI * _ABCE
+        + _ELI * _ABCD ;
+
+        if (!std::isfinite(_PP))
+            return ( +0.0 ) ;
+
+    /*------------- stage B: exact det. of rounded diff. */
+        REAL_TYPE _af[5] = {_afx, _afy, _afz, _aft, _afw} ;
+        REAL_TYPE _bf[5] = {_bfx, _bfy, _bfz, _bft, _bfw} ;
+        REAL_TYPE _cf[5] = {_cfx, _cfy, _cfz, _cft, _cfw} ;
+        REAL_TYPE _df[5] = {_dfx, _dfy, _dfz, _dft, _dfw} ;
+        REAL_TYPE _ef[5] = {_efx, _efy, _efz, _eft, _efw} ;
+
+        _d55 = inball4w_t(_af, _bf, _cf, _df, _ef) ;
+
+        _FT  = _PP * _EB ;
+
+        if (_d55 >= _FT || -_d55 >= _FT)
+        {
+            _OK = true; return _d55 ;
+        }
+
+        if (_afxt == 0. && _afyt == 0. && _afzt == 0. &&
+            _aftt == 0. && _afwt == 0. && _bfxt == 0. &&
+            _bfyt == 0. && _bfzt == 0. && _bftt == 0. &&
+            _bfwt == 0. && _cfxt == 0. && _cfyt == 0. &&
+            _cfzt == 0. && _cftt == 0. && _cfwt == 0. &&
+            _dfxt == 0. && _dfyt == 0. && _dfzt == 0. &&
+            _dftt == 0. && _dfwt == 0. && _efxt == 0. &&
+            _efyt == 0. && _efzt == 0. && _eftt == 0. &&
+            _efwt == 0. )
+        {                   // diff. exact, so det. exact
+            _OK = true; return _d55 ;
+        }
+
+        return ( _d55 ) ;
+    }
+
+    __normal_call REAL_TYPE inball4w_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4w predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        + 26. * _dd_eps ;
+
+        dd_flt    _afx, _afy, _afz, _aft, _afw, _ali ,
+                  _bfx, _bfy, _bfz, _bft, _bfw, _bli ,
+                  _cfx, _cfy, _cfz, _cft, _cfw, _cli ,
+                  _dfx, _dfy, _dfz, _dft, _dfw, _dli ,
+                  _efx, _efy, _efz, _eft, _efw, _eli ;
+        dd_flt    _afxbfy, _bfxafy ,
+                  _afxcfy, _cfxafy ,
+                  _afxdfy, _dfxafy ,
+                  _afxefy, _efxafy ,
+                  _bfxcfy, _cfxbfy ,
+                  _bfxdfy, _dfxbfy ,
+                  _bfxefy, _efxbfy ,
+                  _cfxdfy, _dfxcfy ,
+                  _cfxefy, _efxcfy ,
+                  _dfxefy, _efxdfy ;
+        dd_flt    _ab_, _ac_, _ad_, _ae_ ,
+                  _bc_, _bd_, _be_, _cd_ ,
+                  _ce_, _de_ ;
+        dd_flt    _abc, _abd, _abe, _acd ,
+                  _ace, _ade, _bcd, _bce ,
+                  _bde, _cde ;
+        dd_flt    _abcd, _abce, _abde, _acde ,
+                  _bcde ;
+
+        REAL_TYPE _AFZ, _AFT ,
+                  _BFZ, _BFT ,
+                  _CFZ, _CFT ,
+                  _DFZ, _DFT ,
+                  _EFZ, _EFT ;
+        REAL_TYPE _AB_, _AC_, _AD_, _AE_ ,
+                  _BC_, _BD_, _BE_, _CD_ ,
+                  _CE_, _DE_ ;
+        REAL_TYPE _ABC, _ABD, _ABE, _ACD ,
+                  _ACE, _ADE, _BCD, _BCE ,
+                  _BDE, _CDE ;
+        REAL_TYPE _ABCD, _ABCE, _ABDE, _ACDE ,
+                  _BCDE ;
+        REAL_TYPE _ALI, _BLI, _CLI, _DLI, _ELI ;
+
+        dd_flt    _d55 ;
+        REAL_TYPE _FT ;
+
+        _afx.from_sub(_pa[0], _pf[0]) ;   // coord. diff.
+        _afy.from_sub(_pa[1], _pf[1]) ;
+        _afz.from_sub(_pa[2], _pf[2]) ;
+        _aft.from_sub(_pa[3], _pf[3]) ;
+        _afw.from_sub(_pa[4], _pf[4]) ;
+
+        _AFZ = std::abs (_afz.hi()) ;
+        _AFT = std::abs (_aft.hi()) ;
+
+        _bfx.from_sub(_pb[0], _pf[0]) ;
+        _bfy.from_sub(_pb[1], _pf[1]) ;
+        _bfz.from_sub(_pb[2], _pf[2]) ;
+        _bft.from_sub(_pb[3], _pf[3]) ;
+        _bfw.from_sub(_pb[4], _pf[4]) ;
+
+        _BFZ = std::abs (_bfz.hi()) ;
+        _BFT = std::abs (_bft.hi()) ;
+
+        _cfx.from_sub(_pc[0], _pf[0]) ;
+        _cfy.from_sub(_pc[1], _pf[1]) ;
+        _cfz.from_sub(_pc[2], _pf[2]) ;
+        _cft.from_sub(_pc[3], _pf[3]) ;
+        _cfw.from_sub(_pc[4], _pf[4]) ;
+
+        _CFZ = std::abs (_cfz.hi()) ;
+        _CFT = std::abs (_cft.hi()) ;
+
+        _dfx.from_sub(_pd[0], _pf[0]) ;
+        _dfy.from_sub(_pd[1], _pf[1]) ;
+        _dfz.from_sub(_pd[2], _pf[2]) ;
+        _dft.from_sub(_pd[3], _pf[3]) ;
+        _dfw.from_sub(_pd[4], _pf[4]) ;
+
+        _DFZ = std::abs (_dfz.hi()) ;
+        _DFT = std::abs (_dft.hi()) ;
+
+        _efx.from_sub(_pe[0], _pf[0]) ;
+        _efy.from_sub(_pe[1], _pf[1]) ;
+        _efz.from_sub(_pe[2], _pf[2]) ;
+        _eft.from_sub(_pe[3], _pf[3]) ;
+        _efw.from_sub(_pe[4], _pf[4]) ;
+
+        _EFZ = std::abs (_efz.hi()) ;
+        _EFT = std::abs (_eft.hi()) ;
+
+        _ali = _afx * _afx + _afy * _afy  // lifted terms
+             + _afz * _afz + _aft * _aft - _afw ;
+        _ALI = _afx * _afx + _afy * _afy
+             + _afz * _afz + _aft * _aft
+             + std::abs (_afw.hi()) ;
+
+        _bli = _bfx * _bfx + _bfy * _bfy
+             + _bfz * _bfz + _bft * _bft - _bfw ;
+        _BLI = _bfx * _bfx + _bfy * _bfy
+             + _bfz * _bfz + _bft * _bft
+             + std::abs (_bfw.hi()) ;
+
+        _cli = _cfx * _cfx + _cfy * _cfy
+             + _cfz * _cfz + _cft * _cft - _cfw ;
+        _CLI = _cfx * _cfx + _cfy * _cfy
+             + _cfz * _cfz + _cft * _cft
+             + std::abs (_cfw.hi()) ;
+
+        _dli = _dfx * _dfx + _dfy * _dfy
+             + _dfz * _dfz + _dft * _dft - _dfw ;
+        _DLI = _dfx * _dfx + _dfy * _dfy
+             + _dfz * _dfz + _dft * _dft
+             + std::abs (_dfw.hi()) ;
+
+        _eli = _efx * _efx + _efy * _efy
+             + _efz * _efz + _eft * _eft - _efw ;
+        _ELI = _efx * _efx + _efy * _efy
+             + _efz * _efz + _eft * _eft
+             + std::abs (_efw.hi()) ;
+
+        _afxbfy = _afx * _bfy ;           // 2 x 2 minors
+        _bfxafy = _bfx * _afy ;
+        _ab_ = _afxbfy - _bfxafy ;
+        _AB_ = std::abs(_afxbfy.hi())
+             + std::abs(_bfxafy.hi()) ;
+
+        _afxcfy = _afx * _cfy ;
+        _cfxafy = _cfx * _afy ;
+        _ac_ = _afxcfy - _cfxafy ;
+        _AC_ = std::abs(_afxcfy.hi())
+             + std::abs(_cfxafy.hi()) ;
+
+        _afxdfy = _afx * _dfy ;
+        _dfxafy = _dfx * _afy ;
+        _ad_ = _afxdfy - _dfxafy ;
+        _AD_ = std::abs(_afxdfy.hi())
+             + std::abs(_dfxafy.hi()) ;
+
+        _afxefy = _afx * _efy ;
+        _efxafy = _efx * _afy ;
+        _ae_ = _afxefy - _efxafy ;
+        _AE_ = std::abs(_afxefy.hi())
+             + std::abs(_efxafy.hi()) ;
+
+        _bfxcfy = _bfx * _cfy ;
+        _cfxbfy = _cfx * _bfy ;
+        _bc_ = _bfxcfy - _cfxbfy ;
+        _BC_ = std::abs(_bfxcfy.hi())
+             + std::abs(_cfxbfy.hi()) ;
+
+        _bfxdfy = _bfx * _dfy ;
+        _dfxbfy = _dfx * _bfy ;
+        _bd_ = _bfxdfy - _dfxbfy ;
+        _BD_ = std::abs(_bfxdfy.hi())
+             + std::abs(_dfxbfy.hi()) ;
+
+        _bfxefy = _bfx * _efy ;
+        _efxbfy = _efx * _bfy ;
+        _be_ = _bfxefy - _efxbfy ;
+        _BE_ = std::abs(_bfxefy.hi())
+             + std::abs(_efxbfy.hi()) ;
+
+        _cfxdfy = _cfx * _dfy ;
+        _dfxcfy = _dfx * _cfy ;
+        _cd_ = _cfxdfy - _dfxcfy ;
+        _CD_ = std::abs(_cfxdfy.hi())
+             + std::abs(_dfxcfy.hi()) ;
+
+        _cfxefy = _cfx * _efy ;
+        _efxcfy = _efx * _cfy ;
+        _ce_ = _cfxefy - _efxcfy ;
+        _CE_ = std::abs(_cfxefy.hi())
+             + std::abs(_efxcfy.hi()) ;
+
+        _dfxefy = _dfx * _efy ;
+        _efxdfy = _efx * _dfy ;
+        _de_ = _dfxefy - _efxdfy ;
+        _DE_ = std::abs(_dfxefy.hi())
+             + std::abs(_efxdfy.hi()) ;
+
+        _abc =                            // 3 x 3 minors
+          _afz * _bc_ - _bfz * _ac_
+        + _cfz * _ab_ ;
+        _ABC =
+          _AFZ * _BC_ + _BFZ * _AC_
+        + _CFZ * _AB_ ;
+
+        _abd =
+          _afz * _bd_ - _bfz * _ad_
+        + _dfz * _ab_ ;
+        _ABD =
+          _AFZ * _BD_ + _BFZ * _AD_
+        + _DFZ * _AB_ ;
+
+        _abe =
+          _afz * _be_ - _bfz * _ae_
+        + _efz * _ab_ ;
+        _ABE =
+          _AFZ * _BE_ + _BFZ * _AE_
+        + _EFZ * _AB_ ;
+
+        _acd =
+          _afz * _cd_ - _cfz * _ad_
+        + _dfz * _ac_ ;
+        _ACD =
+          _AFZ * _CD_ + _CFZ * _AD_
+        + _DFZ * _AC_ ;
+
+        _ace =
+          _afz * _ce_ - _cfz * _ae_
+        + _efz * _ac_ ;
+        _ACE =
+          _AFZ * _CE_ + _CFZ * _AE_
+        + _EFZ * _AC_ ;
+
+        _ade =
+          _afz * _de_ - _dfz * _ae_
+        + _efz * _ad_ ;
+        _ADE =
+          _AFZ * _DE_ + _DFZ * _AE_
+        + _EFZ * _AD_ ;
+
+        _bcd =
+          _bfz * _cd_ - _cfz * _bd_
+        + _dfz * _bc_ ;
+        _BCD =
+          _BFZ * _CD_ + _CFZ * _BD_
+        + _DFZ * _BC_ ;
+
+        _bce =
+          _bfz * _ce_ - _cfz * _be_
+        + _efz * _bc_ ;
+        _BCE =
+          _BFZ * _CE_ + _CFZ * _BE_
+        + _EFZ * _BC_ ;
+
+        _bde =
+          _bfz * _de_ - _dfz * _be_
+        + _efz * _bd_ ;
+        _BDE =
+          _BFZ * _DE_ + _DFZ * _BE_
+        + _EFZ * _BD_ ;
+
+        _cde =
+          _cfz * _de_ - _dfz * _ce_
+        + _efz * _cd_ ;
+        _CDE =
+          _CFZ * _DE_ + _DFZ * _CE_
+        + _EFZ * _CD_ ;
+
+        _abcd =                           // 4 x 4 minors
+          _dft * _abc - _cft * _abd
+        + _bft * _acd - _aft * _bcd ;
+        _ABCD =
+          _AFT * _BCD + _BFT * _ACD
+        + _CFT * _ABD + _DFT * _ABC ;
+
+        _abce =
+          _eft * _abc - _cft * _abe
+        + _bft * _ace - _aft * _bce ;
+        _ABCE =
+          _AFT * _BCE + _BFT * _ACE
+        + _CFT * _ABE + _EFT * _ABC ;
+
+        _abde =
+          _eft * _abd - _dft * _abe
+        + _bft * _ade - _aft * _bde ;
+        _ABDE =
+          _AFT * _BDE + _BFT * _ADE
+        + _DFT * _ABE + _EFT * _ABD ;
+
+        _acde =
+          _eft * _acd - _dft * _ace
+        + _cft * _ade - _aft * _cde ;
+        _ACDE =
+          _AFT * _CDE + _CFT * _ADE
+        + _DFT * _ACE + _EFT * _ACD ;
+
+        _bcde =
+          _eft * _bcd - _dft * _bce
+        + _cft * _bde - _bft * _cde ;
+        _BCDE =
+          _BFT * _CDE + _CFT * _BDE
+        + _DFT * _BCE + _EFT * _BCD ;
+
+        _FT  =                            // roundoff tol
+          _ALI * _BCDE + _BLI * _ACDE
+        + _CLI * _ABDE + _DLI * _ABCE
+        + _ELI * _ABCD ;
+
+        _FT *= _ER ;
+
+        _d55 =                            // 5 x 5 result
+          _ali * _bcde - _bli * _acde
+        + _cli * _abde - _dli * _abce
+        + _eli * _abcd ;
+
+        _OK  =
+          _d55.hi() > +_FT || _d55.hi() < -_FT ;
+
+        return ( _d55.hi() ) ;
+    }
+
+    __normal_call REAL_TYPE inball4w_i (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4w predicate, "bound" version */
+        ia_flt    _afx, _afy, _afz, _aft, _afw, _ali ,
+                  _bfx, _bfy, _bfz, _bft, _bfw, _bli ,
+                  _cfx, _cfy, _cfz, _cft, _cfw, _cli ,
+                  _dfx, _dfy, _dfz, _dft, _dfw, _dli ,
+                  _efx, _efy, _efz, _eft, _efw, _eli ;
+        ia_flt    _ab_, _ac_, _ad_, _ae_ ,
+                  _bc_, _bd_, _be_, _cd_ ,
+                  _ce_, _de_ ;
+        ia_flt    _abc, _abd, _abe, _acd ,
+                  _ace, _ade, _bcd, _bce ,
+                  _bde, _cde ;
+        ia_flt    _abcd, _abce, _abde, _acde ,
+                  _bcde ;
+        ia_flt    _d55;
+
+        _afx.from_sub(_pa[0], _pf[0]) ;   // coord. diff.
+        _afy.from_sub(_pa[1], _pf[1]) ;
+        _afz.from_sub(_pa[2], _pf[2]) ;
+        _aft.from_sub(_pa[3], _pf[3]) ;
+        _afw.from_sub(_pa[4], _pf[4]) ;
+
+        _bfx.from_sub(_pb[0], _pf[0]) ;
+        _bfy.from_sub(_pb[1], _pf[1]) ;
+        _bfz.from_sub(_pb[2], _pf[2]) ;
+        _bft.from_sub(_pb[3], _pf[3]) ;
+        _bfw.from_sub(_pb[4], _pf[4]) ;
+
+        _cfx.from_sub(_pc[0], _pf[0]) ;
+        _cfy.from_sub(_pc[1], _pf[1]) ;
+        _cfz.from_sub(_pc[2], _pf[2]) ;
+        _cft.from_sub(_pc[3], _pf[3]) ;
+        _cfw.from_sub(_pc[4], _pf[4]) ;
+
+        _dfx.from_sub(_pd[0], _pf[0]) ;
+        _dfy.from_sub(_pd[1], _pf[1]) ;
+        _dfz.from_sub(_pd[2], _pf[2]) ;
+        _dft.from_sub(_pd[3], _pf[3]) ;
+        _dfw.from_sub(_pd[4], _pf[4]) ;
+
+        _efx.from_sub(_pe[0], _pf[0]) ;
+        _efy.from_sub(_pe[1], _pf[1]) ;
+        _efz.from_sub(_pe[2], _pf[2]) ;
+        _eft.from_sub(_pe[3], _pf[3]) ;
+        _efw.from_sub(_pe[4], _pf[4]) ;
+
+        _ali = sqr (_afx) + sqr (_afy)    // lifted terms
+             + sqr (_afz) + sqr (_aft) - _afw ;
+
+        _bli = sqr (_bfx) + sqr (_bfy)
+             + sqr (_bfz) + sqr (_bft) - _bfw ;
+
+        _cli = sqr (_cfx) + sqr (_cfy)
+             + sqr (_cfz) + sqr (_cft) - _cfw ;
+
+        _dli = sqr (_dfx) + sqr (_dfy)
+             + sqr (_dfz) + sqr (_dft) - _dfw ;
+
+        _eli = sqr (_efx) + sqr (_efy)
+             + sqr (_efz) + sqr (_eft) - _efw ;
+
+        _ab_ = _afx * _bfy                // 2 x 2 minors
+             - _bfx * _afy ;
+        _ac_ = _afx * _cfy
+             - _cfx * _afy ;
+        _ad_ = _afx * _dfy
+             - _dfx * _afy ;
+        _ae_ = _afx * _efy
+             - _efx * _afy ;
+        _bc_ = _bfx * _cfy
+             - _cfx * _bfy ;
+        _bd_ = _bfx * _dfy
+             - _dfx * _bfy ;
+        _be_ = _bfx * _efy
+             - _efx * _bfy ;
+        _cd_ = _cfx * _dfy
+             - _dfx * _cfy ;
+        _ce_ = _cfx * _efy
+             - _efx * _cfy ;
+        _de_ = _dfx * _efy
+             - _efx * _dfy ;
+
+        _abc =                            // 3 x 3 minors
+          _afz * _bc_ - _bfz * _ac_
+        + _cfz * _ab_ ;
+
+        _abd =
+          _afz * _bd_ - _bfz * _ad_
+        + _dfz * _ab_ ;
+
+        _abe =
+          _afz * _be_ - _bfz * _ae_
+        + _efz * _ab_ ;
+
+        _acd =
+          _afz * _cd_ - _cfz * _ad_
+        + _dfz * _ac_ ;
+
+        _ace =
+          _afz * _ce_ - _cfz * _ae_
+        + _efz * _ac_ ;
+
+        _ade =
+          _afz * _de_ - _dfz * _ae_
+        + _efz * _ad_ ;
+
+        _bcd =
+          _bfz * _cd_ - _cfz * _bd_
+        + _dfz * _bc_ ;
+
+        _bce =
+          _bfz * _ce_ - _cfz * _be_
+        + _efz * _bc_ ;
+
+        _bde =
+          _bfz * _de_ - _dfz * _be_
+        + _efz * _bd_ ;
+
+        _cde =
+          _cfz * _de_ - _dfz * _ce_
+        + _efz * _cd_ ;
+
+        _abcd =                           // 4 x 4 minors
+          _dft * _abc - _cft * _abd
+        + _bft * _acd - _aft * _bcd ;
+
+        _abce =
+          _eft * _abc - _cft * _abe
+        + _bft * _ace - _aft * _bce ;
+
+        _abde =
+          _eft * _abd - _dft * _abe
+        + _bft * _ade - _aft * _bde ;
+
+        _acde =
+          _eft * _acd - _dft * _ace
+        + _cft * _ade - _aft * _cde ;
+
+        _bcde =
+          _eft * _bcd - _dft * _bce
+        + _cft * _bde - _bft * _cde ;
+
+        _d55 =                            // 5 x 5 result
+          _ali * _bcde - _bli * _acde
+        + _cli * _abde - _dli * _abce
+        + _eli * _abcd ;
+
+        _OK  =
+          _d55.lo() >  (REAL_TYPE)0.
+        ||_d55.up() <  (REAL_TYPE)0.
+        ||(_d55.lo() == (REAL_TYPE)0. &&
+           _d55.up() == (REAL_TYPE)0.);
+
+        return ( _d55.mid() ) ;
+    }
+
+    __normal_call REAL_TYPE inball4w_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- inball4w predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+        + 26. * mp::_epsilon ;
+
+        REAL_TYPE _afx, _afy, _afz, _aft, _afw, _ali ,
+                  _bfx, _bfy, _bfz, _bft, _bfw, _bli ,
+                  _cfx, _cfy, _cfz, _cft, _cfw, _cli ,
+                  _dfx, _dfy, _dfz, _dft, _dfw, _dli ,
+                  _efx, _efy, _efz, _eft, _efw, _eli ;
+        REAL_TYPE _afxbfy, _bfxafy ,
+                  _afxcfy, _cfxafy ,
+                  _afxdfy, _dfxafy ,
+                  _afxefy, _efxafy ,
+                  _bfxcfy, _cfxbfy ,
+                  _bfxdfy, _dfxbfy ,
+                  _bfxefy, _efxbfy ,
+                  _cfxdfy, _dfxcfy ,
+                  _cfxefy, _efxcfy ,
+                  _dfxefy, _efxdfy ;
+        REAL_TYPE _ab_, _ac_, _ad_, _ae_ ,
+                  _bc_, _bd_, _be_, _cd_ ,
+                  _ce_, _de_ ;
+        REAL_TYPE _abc, _abd, _abe, _acd ,
+                  _ace, _ade, _bcd, _bce ,
+                  _bde, _cde ;
+        REAL_TYPE _abcd, _abce, _abde, _acde ,
+                  _bcde ;
+
+        REAL_TYPE _AFZ, _AFT ,
+                  _BFZ, _BFT ,
+                  _CFZ, _CFT ,
+                  _DFZ, _DFT ,
+                  _EFZ, _EFT ;
+        REAL_TYPE _AB_, _AC_, _AD_, _AE_ ,
+                  _BC_, _BD_, _BE_, _CD_ ,
+                  _CE_, _DE_ ;
+        REAL_TYPE _ABC, _ABD, _ABE, _ACD ,
+                  _ACE, _ADE, _BCD, _BCE ,
+                  _BDE, _CDE ;
+        REAL_TYPE _ABCD, _ABCE, _ABDE, _ACDE ,
+                  _BCDE ;
+        REAL_TYPE _ALI, _BLI, _CLI, _DLI, _ELI ;
+
+        REAL_TYPE _d55, _FT ;
+
+        _afx = _pa [0] - _pf [0] ;        // coord. diff.
+        _afy = _pa [1] - _pf [1] ;
+        _afz = _pa [2] - _pf [2] ;
+        _aft = _pa [3] - _pf [3] ;
+        _afw = _pa [4] - _pf [4] ;
+
+        _AFZ = std::abs (_afz) ;
+        _AFT = std::abs (_aft) ;
+
+        _bfx = _pb [0] - _pf [0] ;
+        _bfy = _pb [1] - _pf [1] ;
+        _bfz = _pb [2] - _pf [2] ;
+        _bft = _pb [3] - _pf [3] ;
+        _bfw = _pb [4] - _pf [4] ;
+
+        _BFZ = std::abs (_bfz) ;
+        _BFT = std::abs (_bft) ;
+
+        _cfx = _pc [0] - _pf [0] ;
+        _cfy = _pc [1] - _pf [1] ;
+        _cfz = _pc [2] - _pf [2] ;
+        _cft = _pc [3] - _pf [3] ;
+        _cfw = _pc [4] - _pf [4] ;
+
+        _CFZ = std::abs (_cfz) ;
+        _CFT = std::abs (_cft) ;
+
+        _dfx = _pd [0] - _pf [0] ;
+        _dfy = _pd [1] - _pf [1] ;
+        _dfz = _pd [2] - _pf [2] ;
+        _dft = _pd [3] - _pf [3] ;
+        _dfw = _pd [4] - _pf [4] ;
+
+        _DFZ = std::abs (_dfz) ;
+        _DFT = std::abs (_dft) ;
+
+        _efx = _pe [0] - _pf [0] ;
+        _efy = _pe [1] - _pf [1] ;
+        _efz = _pe [2] - _pf [2] ;
+        _eft = _pe [3] - _pf [3] ;
+        _efw = _pe [4] - _pf [4] ;
+
+        _EFZ = std::abs (_efz) ;
+        _EFT = std::abs (_eft) ;
+
+        _ali = _afx * _afx + _afy * _afy  // lifted terms
+             + _afz * _afz + _aft * _aft - _afw ;
+        _ALI = _afx * _afx + _afy * _afy
+             + _afz * _afz + _aft * _aft
+             + std::abs (_afw) ;
+
+        _bli = _bfx * _bfx + _bfy * _bfy
+             + _bfz * _bfz + _bft * _bft - _bfw ;
+        _BLI = _bfx * _bfx + _bfy * _bfy
+             + _bfz * _bfz + _bft * _bft
+             + std::abs (_bfw) ;
+
+        _cli = _cfx * _cfx + _cfy * _cfy
+             + _cfz * _cfz + _cft * _cft - _cfw ;
+        _CLI = _cfx * _cfx + _cfy * _cfy
+             + _cfz * _cfz + _cft * _cft
+             + std::abs (_cfw) ;
+
+        _dli = _dfx * _dfx + _dfy * _dfy
+             + _dfz * _dfz + _dft * _dft - _dfw ;
+        _DLI = _dfx * _dfx + _dfy * _dfy
+             + _dfz * _dfz + _dft * _dft
+             + std::abs (_dfw) ;
+
+        _eli = _efx * _efx + _efy * _efy
+             + _efz * _efz + _eft * _eft - _efw ;
+        _ELI = _efx * _efx + _efy * _efy
+             + _efz * _efz + _eft * _eft
+             + std::abs (_efw) ;
+
+        _afxbfy = _afx * _bfy ;           // 2 x 2 minors
+        _bfxafy = _bfx * _afy ;
+        _ab_ = _afxbfy - _bfxafy ;
+        _AB_ = std::abs(_afxbfy)
+             + std::abs(_bfxafy) ;
+
+        _afxcfy = _afx * _cfy ;
+        _cfxafy = _cfx * _afy ;
+        _ac_ = _afxcfy - _cfxafy ;
+        _AC_ = std::abs(_afxcfy)
+             + std::abs(_cfxafy) ;
+
+        _afxdfy = _afx * _dfy ;
+        _dfxafy = _dfx * _afy ;
+        _ad_ = _afxdfy - _dfxafy ;
+        _AD_ = std::abs(_afxdfy)
+             + std::abs(_dfxafy) ;
+
+        _afxefy = _afx * _efy ;
+        _efxafy = _efx * _afy ;
+        _ae_ = _afxefy - _efxafy ;
+        _AE_ = std::abs(_afxefy)
+             + std::abs(_efxafy) ;
+
+        _bfxcfy = _bfx * _cfy ;
+        _cfxbfy = _cfx * _bfy ;
+        _bc_ = _bfxcfy - _cfxbfy ;
+        _BC_ = std::abs(_bfxcfy)
+             + std::abs(_cfxbfy) ;
+
+        _bfxdfy = _bfx * _dfy ;
+        _dfxbfy = _dfx * _bfy ;
+        _bd_ = _bfxdfy - _dfxbfy ;
+        _BD_ = std::abs(_bfxdfy)
+             + std::abs(_dfxbfy) ;
+
+        _bfxefy = _bfx * _efy ;
+        _efxbfy = _efx * _bfy ;
+        _be_ = _bfxefy - _efxbfy ;
+        _BE_ = std::abs(_bfxefy)
+             + std::abs(_efxbfy) ;
+
+        _cfxdfy = _cfx * _dfy ;
+        _dfxcfy = _dfx * _cfy ;
+        _cd_ = _cfxdfy - _dfxcfy ;
+        _CD_ = std::abs(_cfxdfy)
+             + std::abs(_dfxcfy) ;
+
+        _cfxefy = _cfx * _efy ;
+        _efxcfy = _efx * _cfy ;
+        _ce_ = _cfxefy - _efxcfy ;
+        _CE_ = std::abs(_cfxefy)
+             + std::abs(_efxcfy) ;
+
+        _dfxefy = _dfx * _efy ;
+        _efxdfy = _efx * _dfy ;
+        _de_ = _dfxefy - _efxdfy ;
+        _DE_ = std::abs(_dfxefy)
+             + std::abs(_efxdfy) ;
+
+        _abc =                            // 3 x 3 minors
+          _afz * _bc_ - _bfz * _ac_
+        + _cfz * _ab_ ;
+        _ABC =
+          _AFZ * _BC_ + _BFZ * _AC_
+        + _CFZ * _AB_ ;
+
+        _abd =
+          _afz * _bd_ - _bfz * _ad_
+        + _dfz * _ab_ ;
+        _ABD =
+          _AFZ * _BD_ + _BFZ * _AD_
+        + _DFZ * _AB_ ;
+
+        _abe =
+          _afz * _be_ - _bfz * _ae_
+        + _efz * _ab_ ;
+        _ABE =
+          _AFZ * _BE_ + _BFZ * _AE_
+        + _EFZ * _AB_ ;
+
+        _acd =
+          _afz * _cd_ - _cfz * _ad_
+        + _dfz * _ac_ ;
+        _ACD =
+          _AFZ * _CD_ + _CFZ * _AD_
+        + _DFZ * _AC_ ;
+
+        _ace =
+          _afz * _ce_ - _cfz * _ae_
+        + _efz * _ac_ ;
+        _ACE =
+          _AFZ * _CE_ + _CFZ * _AE_
+        + _EFZ * _AC_ ;
+
+        _ade =
+          _afz * _de_ - _dfz * _ae_
+        + _efz * _ad_ ;
+        _ADE =
+          _AFZ * _DE_ + _DFZ * _AE_
+        + _EFZ * _AD_ ;
+
+        _bcd =
+          _bfz * _cd_ - _cfz * _bd_
+        + _dfz * _bc_ ;
+        _BCD =
+          _BFZ * _CD_ + _CFZ * _BD_
+        + _DFZ * _BC_ ;
+
+        _bce =
+          _bfz * _ce_ - _cfz * _be_
+        + _efz * _bc_ ;
+        _BCE =
+          _BFZ * _CE_ + _CFZ * _BE_
+        + _EFZ * _BC_ ;
+
+        _bde =
+          _bfz * _de_ - _dfz * _be_
+        + _efz * _bd_ ;
+        _BDE =
+          _BFZ * _DE_ + _DFZ * _BE_
+        + _EFZ * _BD_ ;
+
+        _cde =
+          _cfz * _de_ - _dfz * _ce_
+        + _efz * _cd_ ;
+        _CDE =
+          _CFZ * _DE_ + _DFZ * _CE_
+        + _EFZ * _CD_ ;
+
+        _abcd =                           // 4 x 4 minors
+          _dft * _abc - _cft * _abd
+        + _bft * _acd - _aft * _bcd ;
+        _ABCD =
+          _AFT * _BCD + _BFT * _ACD
+        + _CFT * _ABD + _DFT * _ABC ;
+
+        _abce =
+          _eft * _abc - _cft * _abe
+        + _bft * _ace - _aft * _bce ;
+        _ABCE =
+          _AFT * _BCE + _BFT * _ACE
+        + _CFT * _ABE + _EFT * _ABC ;
+
+        _abde =
+          _eft * _abd - _dft * _abe
+        + _bft * _ade - _aft * _bde ;
+        _ABDE =
+          _AFT * _BDE + _BFT * _ADE
+        + _DFT * _ABE + _EFT * _ABD ;
+
+        _acde =
+          _eft * _acd - _dft * _ace
+        + _cft * _ade - _aft * _cde ;
+        _ACDE =
+          _AFT * _CDE + _CFT * _ADE
+        + _DFT * _ACE + _EFT * _ACD ;
+
+        _bcde =
+          _eft * _bcd - _dft * _bce
+        + _cft * _bde - _bft * _cde ;
+        _BCDE =
+          _BFT * _CDE + _CFT * _BDE
+        + _DFT * _BCE + _EFT * _BCD ;
+
+        _FT  =                            // roundoff tol
+          _ALI * _BCDE + _BLI * _ACDE
+        + _CLI * _ABDE + _DLI * _ABCE
+        + _ELI * _ABCD ;
+
+        _FT *= _ER ;
+
+        _d55 =                            // 5 x 5 result
+          _ali * _bcde - _bli * _acde
+        + _cli * _abde - _dli * _abce
+        + _eli * _abcd ;
+
+        _OK  =
+          _d55 > +_FT || _d55 < -_FT ;
+
+        return ( _d55 ) ;
+    }
+
 
 
@@ -0,0 +1,337 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Integer kernels, for inputs on a quantised grid.
+     *
+     * For coordinates that are integers with |x| <= 2^26,
+     * orient2d, orient3d and inball2d are evaluated
+     * exactly with 64/128-bit integer arithmetic: coord.
+     * diff. are at most 2^27, so that
+     *
+     *   orient2d:  2 x 2 minors < 2^55           (int64)
+     *   orient3d:  2^27 * 2 x 2 minors < 2^84   (int128)
+     *   inball2d:  lifted terms < 2^55 (int64), and
+     *              2^55 * 2 x 2 minors < 2^112  (int128)
+     *
+     * No filters or expansions are needed. The kernels
+     * are available for integer-typed coordinates, as
+     *
+     *   orient2d(int const *_pa, ...) etc.
+     *
+     * for any signed integer type of at most 32 bits, and,
+     * when USE_KERNEL_INTEGRAL is defined, as a
+     * first "grid" stage in the (double) predicates, taken
+     * whenever all coordinates are integral and in range.
+     *
+     * Integer coord. outside the grid range are converted
+     * to double and passed to the usual filtered kernels.
+     * This is exact up to 32 bits; wider types (int64,
+     * etc) would be rounded above 2^53, so are rejected
+     * at compile-time.
+     *
+     * The int128 kernels need compiler support; where it
+     * is missing the "grid" stage is skipped for orient3d
+     * and inball2d.
+     *
+    --------------------------------------------------------
+     */
+
+    typedef std::int64_t  int64_type ;
+
+#   ifdef  __SIZEOF_INT128__
+    __extension__ typedef __int128 int128_type ;
+#   define  HAS_KERNEL_INT128
+#   endif
+
+    int64_type constexpr _grid_int =
+        (int64_type) +1 << 26 ;         // max. |coord.|
+
+    REAL_TYPE  constexpr _grid_max =
+        (REAL_TYPE) _grid_int ;
+
+    /*--------------- TRUE if IT is exact as REAL_TYPE */
+
+    template <
+    typename  IT
+             >
+    struct is_grid_type
+    {
+        bool_type static constexpr value =
+            std::is_integral<IT>::value &&
+            std::is_signed  <IT>::value &&
+            std::numeric_limits<IT>::digits <=
+            std::numeric_limits<REAL_TYPE>::digits ;
+    } ;
+
+    /*--------------- TRUE if (int.) coordinates in range */
+
+    template <
+    typename  IT
+             >
+    __inline_call bool_type grid_range (
+        INDX_TYPE _nd ,
+      __const_ptr(IT)        _pp
+        )
+    {
+        for (INDX_TYPE _ii = +0; _ii < _nd; ++_ii)
+        {
+            int64_type _zz = (int64_type) _pp[_ii] ;
+
+            if (_zz > +_grid_int || _zz < -_grid_int)
+                return false ;
+        }
+
+        return  true ;
+    }
+
+    /*--------------- TRUE if (real) coordinates on grid */
+
+    __inline_call bool_type grid_index (
+        INDX_TYPE _nd ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __write_ptr(int64_type) _pz
+        )
+    {
+        for (INDX_TYPE _ii = +0; _ii < _nd; ++_ii)
+        {
+            if (!(std::abs(_pp[_ii]) <= _grid_max))
+                return false ;  // also rejects NaN
+
+            _pz[_ii] = (int64_type) _pp[_ii] ;
+
+            if ((REAL_TYPE) _pz[_ii] != _pp[_ii])
+                return false ;
+        }
+
+        return  true ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * the "grid" kernels, for integer coordinates
+    --------------------------------------------------------
+     */
+
+    template <
+    typename  IT
+             >
+    __normal_call REAL_TYPE orient2d_z (
+      __const_ptr(IT)        _pa ,
+      __const_ptr(IT)        _pb ,
+      __const_ptr(IT)        _pc
+        )
+    {
+    /*--------------- orient2d predicate, "grid" version */
+        int64_type _acx, _acy ;
+        int64_type _bcx, _bcy ;
+
+        _acx = (int64_type)_pa [0] - _pc [0] ;
+        _acy = (int64_type)_pa [1] - _pc [1] ;
+
+        _bcx = (int64_type)_pb [0] - _pc [0] ;
+        _bcy = (int64_type)_pb [1] - _pc [1] ;
+
+        return (REAL_TYPE) (                // 2 x 2 result
+            _acx * _bcy - _acy * _bcx ) ;
+    }
+
+#   ifdef  HAS_KERNEL_INT128
+
+    template <
+    typename  IT
+             >
+    __normal_call REAL_TYPE orient3d_z (
+      __const_ptr(IT)        _pa ,
+      __const_ptr(IT)        _pb ,
+      __const_ptr(IT)        _pc ,
+      __const_ptr(IT)        _pd
+        )
+    {
+    /*--------------- orient3d predicate, "grid" version */
+        int64_type _adx, _ady, _adz ,
+                   _bdx, _bdy, _bdz ,
+                   _cdx, _cdy, _cdz ;
+
+        _adx = (int64_type)_pa [0] - _pd [0] ;
+        _ady = (int64_type)_pa [1] - _pd [1] ;
+        _adz = (int64_type)_pa [2] - _pd [2] ;
+
+        _bdx = (int64_type)_pb [0] - _pd [0] ;
+        _bdy = (int64_type)_pb [1] - _pd [1] ;
+        _bdz = (int64_type)_pb [2] - _pd [2] ;
+
+        _cdx = (int64_type)_pc [0] - _pd [0] ;
+        _cdy = (int64_type)_pc [1] - _pd [1] ;
+        _cdz = (int64_type)_pc [2] - _pd [2] ;
+
+        return (REAL_TYPE) (                // 3 x 3 result
+          (int128_type) _adz * (_bdx * _cdy - _cdx * _bdy)
+        + (int128_type) _bdz * (_cdx * _ady - _adx * _cdy)
+        + (int128_type) _cdz * (_adx * _bdy - _bdx * _ady)
+            ) ;
+    }
+
+    template <
+    typename  IT
+             >
+    __normal_call REAL_TYPE inball2d_z (
+      __const_ptr(IT)        _pa ,
+      __const_ptr(IT)        _pb ,
+      __const_ptr(IT)        _pc ,
+      __const_ptr(IT)        _pd
+        )
+    {
+    /*--------------- inball2d predicate, "grid" version */
+        int64_type _adx, _ady, _ali ,
+                   _bdx, _bdy, _bli ,
+                   _cdx, _cdy, _cli ;
+
+        _adx = (int64_type)_pa [0] - _pd [0] ;
+        _ady = (int64_type)_pa [1] - _pd [1] ;
+
+        _bdx = (int64_type)_pb [0] - _pd [0] ;
+        _bdy = (int64_type)_pb [1] - _pd [1] ;
+
+        _cdx = (int64_type)_pc [0] - _pd [0] ;
+        _cdy = (int64_type)_pc [1] - _pd [1] ;
+
+        _ali = _adx * _adx + _ady * _ady; // lifted terms
+        _bli = _bdx * _bdx + _bdy * _bdy;
+        _cli = _cdx * _cdx + _cdy * _cdy;
+
+        return (REAL_TYPE) (                // 3 x 3 result
+          (int128_type) _ali * (_bdx * _cdy - _cdx * _bdy)
+        + (int128_type) _bli * (_cdx * _ady - _adx * _cdy)
+        + (int128_type) _cli * (_adx * _bdy - _bdx * _ady)
+            ) ;
+    }
+
+#   endif//HAS_KERNEL_INT128
+
+    /*
+    --------------------------------------------------------
+     * the "grid" stage, for (real) coordinates on a grid
+    --------------------------------------------------------
+     */
+
+    __inline_call REAL_TYPE orient2d_z (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        bool_type &_OK
+        )
+    {
+        int64_type _za[2], _zb[2], _zc[2] ;
+
+        _OK = grid_index(2, _pa, _za) &&
+              grid_index(2, _pb, _zb) &&
+              grid_index(2, _pc, _zc) ;
+
+        if (!_OK) return (REAL_TYPE) +0. ;
+
+        return orient2d_z<int64_type>(_za, _zb, _zc) ;
+    }
+
+    __inline_call REAL_TYPE orient3d_z (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        bool_type &_OK
+        )
+    {
+    #   ifdef  HAS_KERNEL_INT128
+        int64_type _za[3], _zb[3], _zc[3], _zd[3] ;
+
+        _OK = grid_index(3, _pa, _za) &&
+              grid_index(3, _pb, _zb) &&
+              grid_index(3, _pc, _zc) &&
+              grid_index(3, _pd, _zd) ;
+
+        if (!_OK) return (REAL_TYPE) +0. ;
+
+        return orient3d_z<int64_type>(
+            _za, _zb, _zc, _zd) ;
+    #   else
+        __unreferenced(_pa); __unreferenced(_pb);
+        __unreferenced(_pc); __unreferenced(_pd);
+
+        _OK = false; return (REAL_TYPE) +0. ;
+    #   endif
+    }
+
+    __inline_call REAL_TYPE inball2d_z (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        bool_type &_OK
+        )
+    {
+    #   ifdef  HAS_KERNEL_INT128
+        int64_type _za[2], _zb[2], _zc[2], _zd[2] ;
+
+        _OK = grid_index(2, _pa, _za) &&
+              grid_index(2, _pb, _zb) &&
+              grid_index(2, _pc, _zc) &&
+              grid_index(2, _pd, _zd) ;
+
+        if (!_OK) return (REAL_TYPE) +0. ;
+
+        return inball2d_z<int64_type>(
+            _za, _zb, _zc, _zd) ;
+    #   else
+        __unreferenced(_pa); __unreferenced(_pb);
+        __unreferenced(_pc); __unreferenced(_pd);
+
+        _OK = false; return (REAL_TYPE) +0. ;
+    #   endif
+    }
+
+
+
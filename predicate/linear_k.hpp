@@ -0,0 +1,1030 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Intersection classifiers for linear primitives, built
+     * on the orient-kd kernels:
+     *
+     *   segseg2d(pa,pb,pc,pd)      segment [a,b] vs. [c,d]
+     *   segtri3d(pa,pb,ta,tb,tc)   segment [a,b] vs. tria.
+     *   raytri3d(po,pq,ta,tb,tc)   ray o->q vs. tria.
+     *
+     * each returning one of the LINEAR_xxxx codes below,
+     * and point-location classifiers for walking searches:
+     *
+     *   locate2d(pq,pa,pb,pc,ss)   point q vs. tria. edges
+     *   locate3d(pq,pa,pb,pc,pd,ss)
+     *                              point q vs. tetra faces
+     *
+     * returning one of the LOCATE_xxxx codes.
+     *
+     * Each classifier evaluates its orient signs lazily, in
+     * "float", "bound" then "exact" stages, and only those
+     * signs not yet certain are re-evaluated at each stage.
+     * Signs are requested in order such that disjoint
+     * configurations are rejected as soon as one pair of
+     * certain signs allows it -- typically after the first
+     * pair of "float" tests.
+     *
+     * Triangles are assumed to be non-degenerate: this is
+     * NOT checked.
+     *
+    --------------------------------------------------------
+     */
+
+    enum _linear {
+    LINEAR_DISJOINT = +0,   // no intersection
+    LINEAR_TOUCHING ,       // single pt. on a boundary
+    LINEAR_CROSSING ,       // single pt. in interiors
+    LINEAR_OVERLAPS ,       // collinear/coplanar contact
+    LINEAR_COPLANAR } ;     // ray lies in plane of tria.
+
+    enum _locate {
+    LOCATE_OUTSIDE  = +0,   // beyond at least one face
+    LOCATE_BOUNDARY ,       // on a face, edge or vertex
+    LOCATE_INTERIOR } ;     // strictly inside the cell
+
+    /*--------------- strictly same/opposite signs of a,b */
+
+    __inline_call bool_type linear_same (
+        REAL_TYPE  _aa ,
+        REAL_TYPE  _bb
+        )
+    {   return (_aa > +0. && _bb > +0.) ||
+               (_aa < +0. && _bb < +0.) ;
+    }
+
+    __inline_call bool_type linear_diff (
+        REAL_TYPE  _aa ,
+        REAL_TYPE  _bb
+        )
+    {   return (_aa > +0. && _bb < +0.) ||
+               (_aa < +0. && _bb > +0.) ;
+    }
+
+    /*--------------- orient signs, one stage at a time */
+
+    __inline_call void stage2d_f (
+        REAL_TYPE &_ss, bool_type &_OK ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc
+        )
+    {
+        _ss = orient2d_f(_pa, _pb, _pc, _OK) ;
+
+        _OK = _OK && std::isnormal(_ss) ;
+    }
+
+    __inline_call void stage2d_i (
+        REAL_TYPE &_ss, bool_type &_OK ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc
+        )
+    {
+        if (_OK) return ;
+
+        _ss = orient2d_i(_pa, _pb, _pc, _OK) ;
+    }
+
+    __inline_call void stage2d_d (
+        REAL_TYPE &_ss, bool_type &_OK ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc
+        )
+    {
+        if (_OK) return ;
+
+        _ss = orient2d_d(_pa, _pb, _pc, _OK) ;
+    }
+
+    __inline_call void stage2d_e (
+        REAL_TYPE &_ss, bool_type &_OK ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc
+        )
+    {
+        if (_OK) return ;
+
+        _ss = orient2d_e(_pa, _pb, _pc, _OK) ;
+    }
+
+    __inline_call void stage3d_f (
+        REAL_TYPE &_ss, bool_type &_OK ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+        _ss = orient3d_f(_pa, _pb, _pc, _pd, _OK) ;
+
+        _OK = _OK && std::isnormal(_ss) ;
+    }
+
+    __inline_call void stage3d_i (
+        REAL_TYPE &_ss, bool_type &_OK ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+        if (_OK) return ;
+
+        _ss = orient3d_i(_pa, _pb, _pc, _pd, _OK) ;
+    }
+
+    __inline_call void stage3d_d (
+        REAL_TYPE &_ss, bool_type &_OK ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+        if (_OK) return ;
+
+        _ss = orient3d_d(_pa, _pb, _pc, _pd, _OK) ;
+    }
+
+    __inline_call void stage3d_e (
+        REAL_TYPE &_ss, bool_type &_OK ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+        if (_OK) return ;
+
+        _ss = orient3d_e(_pa, _pb, _pc, _pd, _OK) ;
+    }
+
+    /*--------------- staged orient2d, without counters */
+
+    __inline_call REAL_TYPE linear_orient2d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc
+        )
+    {
+        REAL_TYPE _rr; bool_type _OK ;
+
+        stage2d_f(_rr, _OK, _pa, _pb, _pc) ;
+    #   ifdef USE_KERNEL_INTERVAL
+        stage2d_i(_rr, _OK, _pa, _pb, _pc) ;
+    #   endif
+    #   ifdef USE_KERNEL_DDFLOAT
+        stage2d_d(_rr, _OK, _pa, _pb, _pc) ;
+    #   endif
+        stage2d_e(_rr, _OK, _pa, _pb, _pc) ;
+
+        return _rr ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * SEGSEG-2D: segment-segment classifier in E^2.
+    --------------------------------------------------------
+     */
+
+    /*--------------- classify [a,b] vs. [c,d] from signs */
+
+    __normal_call INDX_TYPE segseg2d_c (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        REAL_TYPE const(&_ss) [4]
+        )
+    {
+        if (linear_same(_ss[0], _ss[1]) ||
+            linear_same(_ss[2], _ss[3]) )
+            return LINEAR_DISJOINT ;
+
+        if (_ss[0] != +0. || _ss[1] != +0. ||
+            _ss[2] != +0. || _ss[3] != +0. )
+        {
+    /*--------------- one pt. of contact: cross or touch */
+            return
+            _ss[0] != +0. && _ss[1] != +0. &&
+            _ss[2] != +0. && _ss[3] != +0. ?
+                LINEAR_CROSSING : LINEAR_TOUCHING ;
+        }
+
+    /*--------------- collinear: compare along x or y */
+    // pick the axis of max. extent over all four pts., so
+    // that they are ordered injectively along the line
+        REAL_TYPE _dx =
+            std::max({_pa[0], _pb[0], _pc[0], _pd[0]})
+          - std::min({_pa[0], _pb[0], _pc[0], _pd[0]}) ;
+        REAL_TYPE _dy =
+            std::max({_pa[1], _pb[1], _pc[1], _pd[1]})
+          - std::min({_pa[1], _pb[1], _pc[1], _pd[1]}) ;
+
+        INDX_TYPE _ix = _dx >= _dy ? 0 : 1 ;
+
+        REAL_TYPE _a0 = std::min(_pa[_ix], _pb[_ix]) ;
+        REAL_TYPE _a1 = std::max(_pa[_ix], _pb[_ix]) ;
+        REAL_TYPE _c0 = std::min(_pc[_ix], _pd[_ix]) ;
+        REAL_TYPE _c1 = std::max(_pc[_ix], _pd[_ix]) ;
+
+        REAL_TYPE _lo = std::max(_a0, _c0) ;
+        REAL_TYPE _hi = std::min(_a1, _c1) ;
+
+        if (_lo >  _hi) return LINEAR_DISJOINT ;
+        if (_lo == _hi) return LINEAR_TOUCHING ;
+
+        return LINEAR_OVERLAPS ;
+    }
+
+    __normal_call INDX_TYPE segseg2d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+    /*--------------- segseg2d predicate, "staged" version */
+        REAL_TYPE _ss[4] ; bool_type _ok[4] ;
+
+        __kernel_tick(SEGSEG2D_f) ;
+
+        stage2d_f(_ss[0], _ok[0], _pa, _pb, _pc) ;
+        stage2d_f(_ss[1], _ok[1], _pa, _pb, _pd) ;
+
+        if (_ok[0] && _ok[1] &&
+            linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        stage2d_f(_ss[2], _ok[2], _pc, _pd, _pa) ;
+        stage2d_f(_ss[3], _ok[3], _pc, _pd, _pb) ;
+
+        if (_ok[2] && _ok[3] &&
+            linear_same(_ss[2], _ss[3]))
+            return LINEAR_DISJOINT ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return segseg2d_c(
+                _pa, _pb, _pc, _pd, _ss) ;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(SEGSEG2D_i) ;
+
+        stage2d_i(_ss[0], _ok[0], _pa, _pb, _pc) ;
+        stage2d_i(_ss[1], _ok[1], _pa, _pb, _pd) ;
+
+        if (_ok[0] && _ok[1] &&
+            linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        stage2d_i(_ss[2], _ok[2], _pc, _pd, _pa) ;
+        stage2d_i(_ss[3], _ok[3], _pc, _pd, _pb) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return segseg2d_c(
+                _pa, _pb, _pc, _pd, _ss) ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(SEGSEG2D_d) ;
+
+        stage2d_d(_ss[0], _ok[0], _pa, _pb, _pc) ;
+        stage2d_d(_ss[1], _ok[1], _pa, _pb, _pd) ;
+
+        if (_ok[0] && _ok[1] &&
+            linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        stage2d_d(_ss[2], _ok[2], _pc, _pd, _pa) ;
+        stage2d_d(_ss[3], _ok[3], _pc, _pd, _pb) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return segseg2d_c(
+                _pa, _pb, _pc, _pd, _ss) ;
+    #   endif
+
+        __kernel_tick(SEGSEG2D_e) ;
+
+        stage2d_e(_ss[0], _ok[0], _pa, _pb, _pc) ;
+        stage2d_e(_ss[1], _ok[1], _pa, _pb, _pd) ;
+
+        if (linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        stage2d_e(_ss[2], _ok[2], _pc, _pd, _pa) ;
+        stage2d_e(_ss[3], _ok[3], _pc, _pd, _pb) ;
+
+        return segseg2d_c(_pa, _pb, _pc, _pd, _ss) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * SEGTRI-3D: segment-triangle classifier in E^3.
+    --------------------------------------------------------
+     */
+
+    /*--------------- coplanar [a,b] vs. tria., projected */
+
+    __normal_call INDX_TYPE segtri3d_2 (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _ta ,
+      __const_ptr(REAL_TYPE) _tb ,
+      __const_ptr(REAL_TYPE) _tc
+        )
+    {
+    /*--------------- drop an axis the tria. is "fat" on */
+        REAL_TYPE _qq[5][2], _sg = +0. ;
+
+        for (INDX_TYPE _ix = +2; _ix >= +0; --_ix)
+        {
+            INDX_TYPE _jj = (_ix + 1) % 3 ;
+            INDX_TYPE _kk = (_ix + 2) % 3 ;
+
+            __const_ptr(REAL_TYPE) _pp[5] = {
+                _pa, _pb, _ta, _tb, _tc } ;
+
+            for (INDX_TYPE _ii = 0; _ii < 5; ++_ii)
+            {
+                _qq[_ii][0] = _pp[_ii][_jj] ;
+                _qq[_ii][1] = _pp[_ii][_kk] ;
+            }
+
+            _sg = linear_orient2d(
+                _qq[2], _qq[3], _qq[4]) ;
+
+            if (_sg != +0.) break ;
+        }
+
+        if (_sg == +0.) return LINEAR_DISJOINT ;
+
+    /*--------------- contact if any pt. of [a,b] in tria. */
+        for (INDX_TYPE _ii = 0; _ii < 2; ++_ii)
+        {
+            REAL_TYPE _s1 = linear_orient2d(
+                _qq[2], _qq[3], _qq[_ii]) ;
+            REAL_TYPE _s2 = linear_orient2d(
+                _qq[3], _qq[4], _qq[_ii]) ;
+            REAL_TYPE _s3 = linear_orient2d(
+                _qq[4], _qq[2], _qq[_ii]) ;
+
+            if (!linear_diff(_s1, _sg) &&
+                !linear_diff(_s2, _sg) &&
+                !linear_diff(_s3, _sg) )
+                return LINEAR_OVERLAPS ;
+        }
+
+    /*--------------- ...or [a,b] cuts any edge of tria. */
+        for (INDX_TYPE _ii = 0; _ii < 3; ++_ii)
+        {
+            INDX_TYPE _i1 = 2 + (_ii + 0) % 3 ;
+            INDX_TYPE _i2 = 2 + (_ii + 1) % 3 ;
+
+            if (segseg2d(_qq[0], _qq[1],
+                    _qq[_i1], _qq[_i2]) != LINEAR_DISJOINT)
+                return LINEAR_OVERLAPS ;
+        }
+
+        return LINEAR_DISJOINT ;
+    }
+
+    /*--------------- classify [a,b] vs. tria. from signs */
+
+    __normal_call INDX_TYPE segtri3d_c (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _ta ,
+      __const_ptr(REAL_TYPE) _tb ,
+      __const_ptr(REAL_TYPE) _tc ,
+        REAL_TYPE const(&_ss) [5]
+        )
+    {
+        if (linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        if (_ss[0] == +0. && _ss[1] == +0.)
+            return segtri3d_2(
+                _pa, _pb, _ta, _tb, _tc) ;
+
+        if (linear_diff(_ss[2], _ss[3]) ||
+            linear_diff(_ss[3], _ss[4]) ||
+            linear_diff(_ss[4], _ss[2]) )
+            return LINEAR_DISJOINT ;
+
+        return
+        _ss[0] != +0. && _ss[1] != +0. &&
+        _ss[2] != +0. && _ss[3] != +0. && _ss[4] != +0. ?
+            LINEAR_CROSSING : LINEAR_TOUCHING ;
+    }
+
+    __normal_call INDX_TYPE segtri3d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _ta ,
+      __const_ptr(REAL_TYPE) _tb ,
+      __const_ptr(REAL_TYPE) _tc
+        )
+    {
+    /*--------------- segtri3d predicate, "staged" version */
+        REAL_TYPE _ss[5] ; bool_type _ok[5] ;
+
+        __kernel_tick(SEGTRI3D_f) ;
+
+        stage3d_f(_ss[0], _ok[0], _ta, _tb, _tc, _pa) ;
+        stage3d_f(_ss[1], _ok[1], _ta, _tb, _tc, _pb) ;
+
+        if (_ok[0] && _ok[1] &&
+            linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_f(_ss[2], _ok[2], _pa, _pb, _ta, _tb) ;
+        stage3d_f(_ss[3], _ok[3], _pa, _pb, _tb, _tc) ;
+
+        if (_ok[2] && _ok[3] &&
+            linear_diff(_ss[2], _ss[3]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_f(_ss[4], _ok[4], _pa, _pb, _tc, _ta) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] &&
+            _ok[3] && _ok[4] )
+            return segtri3d_c(
+                _pa, _pb, _ta, _tb, _tc, _ss) ;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(SEGTRI3D_i) ;
+
+        stage3d_i(_ss[0], _ok[0], _ta, _tb, _tc, _pa) ;
+        stage3d_i(_ss[1], _ok[1], _ta, _tb, _tc, _pb) ;
+
+        if (_ok[0] && _ok[1] &&
+            linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_i(_ss[2], _ok[2], _pa, _pb, _ta, _tb) ;
+        stage3d_i(_ss[3], _ok[3], _pa, _pb, _tb, _tc) ;
+
+        if (_ok[2] && _ok[3] &&
+            linear_diff(_ss[2], _ss[3]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_i(_ss[4], _ok[4], _pa, _pb, _tc, _ta) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] &&
+            _ok[3] && _ok[4] )
+            return segtri3d_c(
+                _pa, _pb, _ta, _tb, _tc, _ss) ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(SEGTRI3D_d) ;
+
+        stage3d_d(_ss[0], _ok[0], _ta, _tb, _tc, _pa) ;
+        stage3d_d(_ss[1], _ok[1], _ta, _tb, _tc, _pb) ;
+
+        if (_ok[0] && _ok[1] &&
+            linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_d(_ss[2], _ok[2], _pa, _pb, _ta, _tb) ;
+        stage3d_d(_ss[3], _ok[3], _pa, _pb, _tb, _tc) ;
+
+        if (_ok[2] && _ok[3] &&
+            linear_diff(_ss[2], _ss[3]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_d(_ss[4], _ok[4], _pa, _pb, _tc, _ta) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] &&
+            _ok[3] && _ok[4] )
+            return segtri3d_c(
+                _pa, _pb, _ta, _tb, _tc, _ss) ;
+    #   endif
+
+        __kernel_tick(SEGTRI3D_e) ;
+
+        stage3d_e(_ss[0], _ok[0], _ta, _tb, _tc, _pa) ;
+        stage3d_e(_ss[1], _ok[1], _ta, _tb, _tc, _pb) ;
+
+        if (linear_same(_ss[0], _ss[1]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_e(_ss[2], _ok[2], _pa, _pb, _ta, _tb) ;
+        stage3d_e(_ss[3], _ok[3], _pa, _pb, _tb, _tc) ;
+        stage3d_e(_ss[4], _ok[4], _pa, _pb, _tc, _ta) ;
+
+        return segtri3d_c(
+            _pa, _pb, _ta, _tb, _tc, _ss) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * RAYTRI-3D: ray-triangle classifier in E^3.
+    --------------------------------------------------------
+     *
+     * The ray starts at o and passes through q. The signs
+     * of orient3d(o,q,t_i,t_j) determine whether the line
+     * through o,q meets the tria., and the direction it
+     * passes through it; the side of the tria. that o lies
+     * on then determines whether the hit is ahead of o.
+     * Rays lying in the plane of the tria. are returned as
+     * LINEAR_COPLANAR, and are not classified further.
+     *
+    --------------------------------------------------------
+     */
+
+    /*--------------- classify o->q vs. tria. from signs */
+
+    __inline_call INDX_TYPE raytri3d_c (
+        REAL_TYPE const(&_ss) [4]
+        )
+    {
+        if (linear_diff(_ss[0], _ss[1]) ||
+            linear_diff(_ss[1], _ss[2]) ||
+            linear_diff(_ss[2], _ss[0]) )
+            return LINEAR_DISJOINT ;
+
+        REAL_TYPE _se =
+            _ss[0] != +0. ? _ss[0] :
+            _ss[1] != +0. ? _ss[1] : _ss[2] ;
+
+        if (_se == +0.) return LINEAR_COPLANAR ;
+
+        if (_ss[3] == +0.) return LINEAR_TOUCHING ;
+
+        if (!linear_diff(_ss[3], _se))
+            return LINEAR_DISJOINT ;
+
+        return
+        _ss[0] != +0. && _ss[1] != +0. && _ss[2] != +0. ?
+            LINEAR_CROSSING : LINEAR_TOUCHING ;
+    }
+
+    __normal_call INDX_TYPE raytri3d (
+      __const_ptr(REAL_TYPE) _po ,
+      __const_ptr(REAL_TYPE) _pq ,
+      __const_ptr(REAL_TYPE) _ta ,
+      __const_ptr(REAL_TYPE) _tb ,
+      __const_ptr(REAL_TYPE) _tc
+        )
+    {
+    /*--------------- raytri3d predicate, "staged" version */
+        REAL_TYPE _ss[4] ; bool_type _ok[4] ;
+
+        __kernel_tick(RAYTRI3D_f) ;
+
+        stage3d_f(_ss[0], _ok[0], _po, _pq, _ta, _tb) ;
+        stage3d_f(_ss[3], _ok[3], _ta, _tb, _tc, _po) ;
+
+        if (_ok[0] && _ok[3] &&
+            linear_same(_ss[0], _ss[3]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_f(_ss[1], _ok[1], _po, _pq, _tb, _tc) ;
+        stage3d_f(_ss[2], _ok[2], _po, _pq, _tc, _ta) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return raytri3d_c(_ss) ;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(RAYTRI3D_i) ;
+
+        stage3d_i(_ss[0], _ok[0], _po, _pq, _ta, _tb) ;
+        stage3d_i(_ss[3], _ok[3], _ta, _tb, _tc, _po) ;
+
+        if (_ok[0] && _ok[3] &&
+            linear_same(_ss[0], _ss[3]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_i(_ss[1], _ok[1], _po, _pq, _tb, _tc) ;
+        stage3d_i(_ss[2], _ok[2], _po, _pq, _tc, _ta) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return raytri3d_c(_ss) ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(RAYTRI3D_d) ;
+
+        stage3d_d(_ss[0], _ok[0], _po, _pq, _ta, _tb) ;
+        stage3d_d(_ss[3], _ok[3], _ta, _tb, _tc, _po) ;
+
+        if (_ok[0] && _ok[3] &&
+            linear_same(_ss[0], _ss[3]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_d(_ss[1], _ok[1], _po, _pq, _tb, _tc) ;
+        stage3d_d(_ss[2], _ok[2], _po, _pq, _tc, _ta) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return raytri3d_c(_ss) ;
+    #   endif
+
+        __kernel_tick(RAYTRI3D_e) ;
+
+        stage3d_e(_ss[0], _ok[0], _po, _pq, _ta, _tb) ;
+        stage3d_e(_ss[3], _ok[3], _ta, _tb, _tc, _po) ;
+
+        if (linear_same(_ss[0], _ss[3]))
+            return LINEAR_DISJOINT ;
+
+        stage3d_e(_ss[1], _ok[1], _po, _pq, _tb, _tc) ;
+        stage3d_e(_ss[2], _ok[2], _po, _pq, _tc, _ta) ;
+
+        return raytri3d_c(_ss) ;
+    }
+
+
+
+
+    /*
+    --------------------------------------------------------
+     * LOCATE-kD: point-in-cell classifiers in E^2, E^3.
+    --------------------------------------------------------
+     *
+     * Return the signs of all faces of a cell wrt. a query
+     * point q, with ss[i] taking the sign of the orient
+     * test in which q replaces the i-th vertex, e.g.
+     *
+     *   ss[0] = orient3d(q,b,c,d) ,
+     *   ss[3] = orient3d(a,b,c,q) , etc.
+     *
+     * such that ss[i] shares the sign of the cell itself
+     * when q lies on the inner side of the face opposite
+     * vertex i.
+     *
+     * The "float" stage translates all vertices by q once,
+     * so that the coord. diff. and (in E^3) the 2 x 2 xy-
+     * minors are shared between all faces. Only those
+     * faces whose signs are not certain are passed to the
+     * "bound" and "exact" orient kernels.
+     *
+     * Cells are assumed to be non-degenerate: this is NOT
+     * checked.
+     *
+    --------------------------------------------------------
+     */
+
+    /*--------------- classify q vs. cell from face signs */
+
+    template <
+        size_t      NF
+             >
+    __inline_call INDX_TYPE locate_c (
+        REAL_TYPE const(&_ss) [NF]
+        )
+    {
+        bool_type _zz = false ;
+        REAL_TYPE _se = +0. ;
+        for (size_t _ii = +0; _ii < NF; ++_ii)
+        {
+            if (_ss[_ii] == +0.)
+            {
+                _zz = true ;
+            }
+            else
+            if (_se == +0.)
+            {
+                _se = _ss[_ii] ;
+            }
+            else
+            if (linear_diff(_se, _ss[_ii]))
+            {
+                return LOCATE_OUTSIDE ;
+            }
+        }
+
+        return _zz ? LOCATE_BOUNDARY : LOCATE_INTERIOR ;
+    }
+
+    __normal_call void locate2d_f (
+      __const_ptr(REAL_TYPE) _pq ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        REAL_TYPE(&_ss) [3] ,
+        bool_type(&_ok) [3]
+        )
+    {
+    /*--------------- locate2d predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+        +  4. * mp::_epsilon ;
+
+        REAL_TYPE _aqx, _aqy ,
+                  _bqx, _bqy ,
+                  _cqx, _cqy ;
+
+        REAL_TYPE _bqxcqy, _cqxbqy ,
+                  _cqxaqy, _aqxcqy ,
+                  _aqxbqy, _bqxaqy ;
+
+        REAL_TYPE _FT[3] ;
+
+        _aqx = _pa [0] - _pq [0] ;        // coord. diff.
+        _aqy = _pa [1] - _pq [1] ;
+
+        _bqx = _pb [0] - _pq [0] ;
+        _bqy = _pb [1] - _pq [1] ;
+
+        _cqx = _pc [0] - _pq [0] ;
+        _cqy = _pc [1] - _pq [1] ;
+
+        _bqxcqy = _bqx * _cqy ;
+        _cqxbqy = _cqx * _bqy ;
+        _cqxaqy = _cqx * _aqy ;
+        _aqxcqy = _aqx * _cqy ;
+        _aqxbqy = _aqx * _bqy ;
+        _bqxaqy = _bqx * _aqy ;
+
+        _FT[0] =                          // roundoff tol
+        std::abs(_bqxcqy) + std::abs(_cqxbqy) ;
+        _FT[1] =
+        std::abs(_cqxaqy) + std::abs(_aqxcqy) ;
+        _FT[2] =
+        std::abs(_aqxbqy) + std::abs(_bqxaqy) ;
+
+        _ss[0] = _bqxcqy - _cqxbqy ;      // 2 x 2 result
+        _ss[1] = _cqxaqy - _aqxcqy ;
+        _ss[2] = _aqxbqy - _bqxaqy ;
+
+        for (size_t _ii = +0; _ii < +3; ++_ii)
+        {
+            _FT[_ii] *= _ER ;
+
+            _ok[_ii] =
+             (_ss[_ii] > +_FT[_ii] ||
+              _ss[_ii] < -_FT[_ii])
+              && std::isnormal(_ss[_ii]) ;
+        }
+    }
+
+    __normal_call void locate3d_f (
+      __const_ptr(REAL_TYPE) _pq ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        REAL_TYPE(&_ss) [4] ,
+        bool_type(&_ok) [4]
+        )
+    {
+    /*--------------- locate3d predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+        +  8. * mp::_epsilon ;
+
+        REAL_TYPE _aqx, _aqy, _aqz ,
+                  _bqx, _bqy, _bqz ,
+                  _cqx, _cqy, _cqz ,
+                  _dqx, _dqy, _dqz ;
+
+        REAL_TYPE _AQZ, _BQZ, _CQZ, _DQZ ;
+
+        REAL_TYPE _m_ab, _m_ac, _m_ad ,   // 2 x 2 minors
+                  _m_bc, _m_bd, _m_cd ;
+        REAL_TYPE _M_AB, _M_AC, _M_AD ,   // + permanents
+                  _M_BC, _M_BD, _M_CD ;
+
+        REAL_TYPE _FT[4] ;
+
+        _aqx = _pa [0] - _pq [0] ;        // coord. diff.
+        _aqy = _pa [1] - _pq [1] ;
+        _aqz = _pa [2] - _pq [2] ;
+
+        _bqx = _pb [0] - _pq [0] ;
+        _bqy = _pb [1] - _pq [1] ;
+        _bqz = _pb [2] - _pq [2] ;
+
+        _cqx = _pc [0] - _pq [0] ;
+        _cqy = _pc [1] - _pq [1] ;
+        _cqz = _pc [2] - _pq [2] ;
+
+        _dqx = _pd [0] - _pq [0] ;
+        _dqy = _pd [1] - _pq [1] ;
+        _dqz = _pd [2] - _pq [2] ;
+
+        _AQZ = std::abs (_aqz) ;
+        _BQZ = std::abs (_bqz) ;
+        _CQZ = std::abs (_cqz) ;
+        _DQZ = std::abs (_dqz) ;
+
+        REAL_TYPE _aqxbqy = _aqx * _bqy ; // 2 x 2 minors
+        REAL_TYPE _bqxaqy = _bqx * _aqy ;
+        REAL_TYPE _aqxcqy = _aqx * _cqy ;
+        REAL_TYPE _cqxaqy = _cqx * _aqy ;
+        REAL_TYPE _aqxdqy = _aqx * _dqy ;
+        REAL_TYPE _dqxaqy = _dqx * _aqy ;
+        REAL_TYPE _bqxcqy = _bqx * _cqy ;
+        REAL_TYPE _cqxbqy = _cqx * _bqy ;
+        REAL_TYPE _bqxdqy = _bqx * _dqy ;
+        REAL_TYPE _dqxbqy = _dqx * _bqy ;
+        REAL_TYPE _cqxdqy = _cqx * _dqy ;
+        REAL_TYPE _dqxcqy = _dqx * _cqy ;
+
+        _m_ab = _aqxbqy - _bqxaqy ;
+        _m_ac = _aqxcqy - _cqxaqy ;
+        _m_ad = _aqxdqy - _dqxaqy ;
+        _m_bc = _bqxcqy - _cqxbqy ;
+        _m_bd = _bqxdqy - _dqxbqy ;
+        _m_cd = _cqxdqy - _dqxcqy ;
+
+        _M_AB =
+        std::abs(_aqxbqy) + std::abs(_bqxaqy) ;
+        _M_AC =
+        std::abs(_aqxcqy) + std::abs(_cqxaqy) ;
+        _M_AD =
+        std::abs(_aqxdqy) + std::abs(_dqxaqy) ;
+        _M_BC =
+        std::abs(_bqxcqy) + std::abs(_cqxbqy) ;
+        _M_BD =
+        std::abs(_bqxdqy) + std::abs(_dqxbqy) ;
+        _M_CD =
+        std::abs(_cqxdqy) + std::abs(_dqxcqy) ;
+
+    /*--------------- faces opp. a, b, c, d: with q as pt. */
+        _ss[0] =                          // -|b c d|
+          _cqz * _m_bd
+        - _bqz * _m_cd
+        - _dqz * _m_bc ;
+        _ss[1] =                          // +|a c d|
+          _aqz * _m_cd
+        - _cqz * _m_ad
+        + _dqz * _m_ac ;
+        _ss[2] =                          // -|a b d|
+          _bqz * _m_ad
+        - _aqz * _m_bd
+        - _dqz * _m_ab ;
+        _ss[3] =                          // +|a b c|
+          _aqz * _m_bc
+        - _bqz * _m_ac
+        + _cqz * _m_ab ;
+
+        _FT[0] =                          // roundoff tol
+          _BQZ * _M_CD + _CQZ * _M_BD + _DQZ * _M_BC ;
+        _FT[1] =
+          _AQZ * _M_CD + _CQZ * _M_AD + _DQZ * _M_AC ;
+        _FT[2] =
+          _AQZ * _M_BD + _BQZ * _M_AD + _DQZ * _M_AB ;
+        _FT[3] =
+          _AQZ * _M_BC + _BQZ * _M_AC + _CQZ * _M_AB ;
+
+        for (size_t _ii = +0; _ii < +4; ++_ii)
+        {
+            _FT[_ii] *= _ER ;
+
+            _ok[_ii] =
+             (_ss[_ii] > +_FT[_ii] ||
+              _ss[_ii] < -_FT[_ii])
+              && std::isnormal(_ss[_ii]) ;
+        }
+    }
+
+    __normal_call INDX_TYPE locate2d (
+      __const_ptr(REAL_TYPE) _pq ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        REAL_TYPE(&_ss) [3]
+        )
+    {
+    /*--------------- locate2d predicate, "staged" version */
+        bool_type _ok[3] ;
+
+        __kernel_tick(LOCATE2D_f) ;
+
+        locate2d_f(_pq, _pa, _pb, _pc, _ss, _ok) ;
+
+        if (_ok[0] && _ok[1] && _ok[2])
+            return locate_c(_ss) ;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(LOCATE2D_i) ;
+
+        stage2d_i(_ss[0], _ok[0], _pq, _pb, _pc) ;
+        stage2d_i(_ss[1], _ok[1], _pa, _pq, _pc) ;
+        stage2d_i(_ss[2], _ok[2], _pa, _pb, _pq) ;
+
+        if (_ok[0] && _ok[1] && _ok[2])
+            return locate_c(_ss) ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(LOCATE2D_d) ;
+
+        stage2d_d(_ss[0], _ok[0], _pq, _pb, _pc) ;
+        stage2d_d(_ss[1], _ok[1], _pa, _pq, _pc) ;
+        stage2d_d(_ss[2], _ok[2], _pa, _pb, _pq) ;
+
+        if (_ok[0] && _ok[1] && _ok[2])
+            return locate_c(_ss) ;
+    #   endif
+
+        __kernel_tick(LOCATE2D_e) ;
+
+        stage2d_e(_ss[0], _ok[0], _pq, _pb, _pc) ;
+        stage2d_e(_ss[1], _ok[1], _pa, _pq, _pc) ;
+        stage2d_e(_ss[2], _ok[2], _pa, _pb, _pq) ;
+
+        return locate_c(_ss) ;
+    }
+
+    __normal_call INDX_TYPE locate3d (
+      __const_ptr(REAL_TYPE) _pq ,
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        REAL_TYPE(&_ss) [4]
+        )
+    {
+    /*--------------- locate3d predicate, "staged" version */
+        bool_type _ok[4] ;
+
+        __kernel_tick(LOCATE3D_f) ;
+
+        locate3d_f(_pq, _pa, _pb, _pc, _pd, _ss, _ok) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return locate_c(_ss) ;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(LOCATE3D_i) ;
+
+        stage3d_i(_ss[0], _ok[0], _pq, _pb, _pc, _pd) ;
+        stage3d_i(_ss[1], _ok[1], _pa, _pq, _pc, _pd) ;
+        stage3d_i(_ss[2], _ok[2], _pa, _pb, _pq, _pd) ;
+        stage3d_i(_ss[3], _ok[3], _pa, _pb, _pc, _pq) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return locate_c(_ss) ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(LOCATE3D_d) ;
+
+        stage3d_d(_ss[0], _ok[0], _pq, _pb, _pc, _pd) ;
+        stage3d_d(_ss[1], _ok[1], _pa, _pq, _pc, _pd) ;
+        stage3d_d(_ss[2], _ok[2], _pa, _pb, _pq, _pd) ;
+        stage3d_d(_ss[3], _ok[3], _pa, _pb, _pc, _pq) ;
+
+        if (_ok[0] && _ok[1] && _ok[2] && _ok[3])
+            return locate_c(_ss) ;
+    #   endif
+
+        __kernel_tick(LOCATE3D_e) ;
+
+        stage3d_e(_ss[0], _ok[0], _pq, _pb, _pc, _pd) ;
+        stage3d_e(_ss[1], _ok[1], _pa, _pq, _pc, _pd) ;
+        stage3d_e(_ss[2], _ok[2], _pa, _pb, _pq, _pd) ;
+        stage3d_e(_ss[3], _ok[3], _pa, _pb, _pc, _pq) ;
+
+        return locate_c(_ss) ;
+    }
@@ -44,6 +44,38 @@
     // from predicate_k.hpp...
 
 
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, given translated coordinates
+     *
+     *   | acx  acy |
+     *   | bcx  bcy |
+     *
+     * with AC = A - C, etc. This is only valid when the
+     * coord. diff. are themselves exact.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE orient2d_t (
+      __const_ptr(REAL_TYPE) _ac ,
+      __const_ptr(REAL_TYPE) _bc
+        )
+    {
+    /*--------------- orient2d predicate, "shift" version */
+        mp::expansion< 4 > _d2full;
+
+    /*-------------------------------------- 2 x 2 result */
+        compute_det_2x2(_ac[ 0], _ac[ 1],
+                        _bc[ 0], _bc[ 1],
+                        _d2full ) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d2full) ;
+    }
+
     /*
     --------------------------------------------------------
      *
@@ -69,10 +101,17 @@
     /*--------------- orient2d predicate, "exact" version */
         mp::expansion< 4 > _d2_ab_, _d2_ac_,
                            _d2_bc_;
-        mp::expansion< 12> _d3full;
 
         _OK = true;
 
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ac[2], _bc[2] ;
+        if (mp::translate_exact<2>(_pa, _pc, _ac) &&
+            mp::translate_exact<2>(_pb, _pc, _bc) )
+        {
+            return orient2d_t(_ac, _bc) ;
+        }
+
     /*-------------------------------------- 2 x 2 minors */
         compute_det_2x2(_pa[ 0], _pa[ 1],
                         _pb[ 0], _pb[ 1],
@@ -87,12 +126,53 @@
                         _d2_bc_ ) ;
 
     /*-------------------------------------- 3 x 3 result */
-        unitary_det_3x3(_d2_bc_, _d2_ac_,
+        return (REAL_TYPE)
+        unitary_sgn_3x3(_d2_bc_, _d2_ac_,
                         _d2_ab_,
-                        _d3full, +3) ;
+                        +3) ;
+    }
 
-    /*-------------------------------------- leading det. */
-        return mp::expansion_est(_d3full) ;
+    __normal_call REAL_TYPE orient2d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- orient2d predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        +  4. * _dd_eps ;
+
+        dd_flt    _acx, _acy ;
+        dd_flt    _bcx, _bcy ;
+        dd_flt    _acxbcy, _acybcx ;
+
+        REAL_TYPE _ACXBCY, _ACYBCX ;
+
+        dd_flt    _sgn ;
+        REAL_TYPE _FT ;
+
+        _acx.from_sub(_pa[0], _pc[0]) ;   // coord. diff.
+        _acy.from_sub(_pa[1], _pc[1]) ;
+
+        _bcx.from_sub(_pb[0], _pc[0]) ;
+        _bcy.from_sub(_pb[1], _pc[1]) ;
+
+        _acxbcy = _acx * _bcy ;
+        _acybcx = _acy * _bcx ;
+
+        _ACXBCY = std::abs(_acxbcy.hi());
+        _ACYBCX = std::abs(_acybcx.hi());
+
+        _FT  = _ACXBCY + _ACYBCX ;        // roundoff tol
+        _FT *= _ER ;
+
+        _sgn = _acxbcy - _acybcx ;        // 2 x 2 result
+
+        _OK  =
+          _sgn.hi() > +_FT || _sgn.hi() < -_FT ;
+
+        return ( _sgn.hi() ) ;
     }
 
     __normal_call REAL_TYPE orient2d_i (
@@ -109,8 +189,6 @@
 
         ia_flt    _sgn;
 
-        ia_rnd    _rnd;                   // up rounding!
-
         _acx.from_sub(_pa[0], _pc[0]) ;   // coord. diff.
         _acy.from_sub(_pa[1], _pc[1]) ;
 
@@ -123,8 +201,10 @@
         _sgn = _acxbcy - _acybcx ;        // 2 x 2 result
 
         _OK  =
-           _sgn.lo() >= (REAL_TYPE)0.
-        || _sgn.up() <= (REAL_TYPE)0. ;
+           _sgn.lo() >  (REAL_TYPE)0.
+        || _sgn.up() <  (REAL_TYPE)0.
+        || (_sgn.lo() == (REAL_TYPE)0. &&
+            _sgn.up() == (REAL_TYPE)0.) ;
 
         return ( _sgn.mid() ) ;
     }
@@ -137,8 +217,8 @@
         )
     {
     /*--------------- orient2d predicate, "float" version */
-        REAL_TYPE static const _ER =
-        +  4. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        +  4. * mp::_epsilon ;
 
         REAL_TYPE _acx, _acy ;
         REAL_TYPE _bcx, _bcy ;
@@ -171,6 +251,60 @@
         return ( _sgn ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, given translated coordinates
+     *
+     *   | adx  ady  adz |
+     *   | bdx  bdy  bdz |
+     *   | cdx  cdy  cdz |
+     *
+     * with AD = A - D, etc. This is only valid when the
+     * coord. diff. are themselves exact.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE orient3d_t (
+      __const_ptr(REAL_TYPE) _ad ,
+      __const_ptr(REAL_TYPE) _bd ,
+      __const_ptr(REAL_TYPE) _cd
+        )
+    {
+    /*--------------- orient3d predicate, "shift" version */
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_bc_;
+        mp::expansion< 24> _d3full;
+
+        mp::expansion< 1 > _ad_zz_(_ad[ 2]);
+        mp::expansion< 1 > _bd_zz_(_bd[ 2]);
+        mp::expansion< 1 > _cd_zz_(_cd[ 2]);
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_ad[ 0], _ad[ 1],
+                        _bd[ 0], _bd[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_ad[ 0], _ad[ 1],
+                        _cd[ 0], _cd[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_bd[ 0], _bd[ 1],
+                        _cd[ 0], _cd[ 1],
+                        _d2_bc_ ) ;
+
+    /*-------------------------------------- 3 x 3 result */
+        compute_det_3x3(_d2_bc_, _ad_zz_,
+                        _d2_ac_, _bd_zz_,
+                        _d2_ab_, _cd_zz_,
+                        _d3full, +3) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d3full) ;
+    }
+
     /*
     --------------------------------------------------------
      *
@@ -202,10 +336,18 @@
                            _d2_cd_;
         mp::expansion< 12> _d3_abc, _d3_abd,
                            _d3_acd, _d3_bcd;
-        mp::expansion< 96> _d4full;
 
         _OK = true;
 
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ad[3], _bd[3], _cd[3] ;
+        if (mp::translate_exact<3>(_pa, _pd, _ad) &&
+            mp::translate_exact<3>(_pb, _pd, _bd) &&
+            mp::translate_exact<3>(_pc, _pd, _cd) )
+        {
+            return orient3d_t(_ad, _bd, _cd) ;
+        }
+
         mp::expansion< 1 > _pa_zz_(_pa[ 2]);
         mp::expansion< 1 > _pb_zz_(_pb[ 2]);
         mp::expansion< 1 > _pc_zz_(_pc[ 2]);
@@ -254,14 +396,89 @@
                         _d3_abc, +3) ;
 
     /*-------------------------------------- 4 x 4 result */
-        compute_det_4x4(_d3_bcd, _pa_zz_,
+        return (REAL_TYPE)
+        compute_sgn_4x4(_d3_bcd, _pa_zz_,
                         _d3_acd, _pb_zz_,
                         _d3_abd, _pc_zz_,
                         _d3_abc, _pd_zz_,
-                        _d4full, +3) ;
+                        +3) ;
+    }
 
-    /*-------------------------------------- leading det. */
-        return mp::expansion_est(_d4full) ;
+    __normal_call REAL_TYPE orient3d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- orient3d predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        +  8. * _dd_eps ;
+
+        dd_flt    _adx, _ady, _adz ,
+                  _bdx, _bdy, _bdz ,
+                  _cdx, _cdy, _cdz ;
+        dd_flt    _bdxcdy, _cdxbdy ,
+                  _cdxady, _adxcdy ,
+                  _adxbdy, _bdxady ;
+
+        REAL_TYPE _ADZ, _BDZ, _CDZ ;
+        REAL_TYPE _BDXCDY, _CDXBDY ,
+                  _CDXADY, _ADXCDY ,
+                  _ADXBDY, _BDXADY ;
+
+        dd_flt    _sgn ;
+        REAL_TYPE _FT ;
+
+        _adx.from_sub(_pa[0], _pd[0]) ;   // coord. diff.
+        _ady.from_sub(_pa[1], _pd[1]) ;
+        _adz.from_sub(_pa[2], _pd[2]) ;
+
+        _ADZ = std::abs (_adz.hi()) ;
+
+        _bdx.from_sub(_pb[0], _pd[0]) ;
+        _bdy.from_sub(_pb[1], _pd[1]) ;
+        _bdz.from_sub(_pb[2], _pd[2]) ;
+
+        _BDZ = std::abs (_bdz.hi()) ;
+
+        _cdx.from_sub(_pc[0], _pd[0]) ;
+        _cdy.from_sub(_pc[1], _pd[1]) ;
+        _cdz.from_sub(_pc[2], _pd[2]) ;
+
+        _CDZ = std::abs (_cdz.hi()) ;
+
+        _bdxcdy = _bdx * _cdy ;           // 2 x 2 minors
+        _cdxbdy = _cdx * _bdy ;
+        _cdxady = _cdx * _ady ;
+        _adxcdy = _adx * _cdy ;
+        _adxbdy = _adx * _bdy ;
+        _bdxady = _bdx * _ady ;
+
+        _BDXCDY = std::abs (_bdxcdy.hi()) ;
+        _CDXBDY = std::abs (_cdxbdy.hi()) ;
+        _CDXADY = std::abs (_cdxady.hi()) ;
+        _ADXCDY = std::abs (_adxcdy.hi()) ;
+        _ADXBDY = std::abs (_adxbdy.hi()) ;
+        _BDXADY = std::abs (_bdxady.hi()) ;
+
+        _FT  =                            // roundoff tol
+          _ADZ * (_BDXCDY + _CDXBDY)
+        + _BDZ * (_CDXADY + _ADXCDY)
+        + _CDZ * (_ADXBDY + _BDXADY) ;
+
+        _FT *= _ER ;
+
+        _sgn =                            // 3 x 3 result
+          _adz * (_bdxcdy - _cdxbdy)
+        + _bdz * (_cdxady - _adxcdy)
+        + _cdz * (_adxbdy - _bdxady) ;
+
+        _OK  =
+          _sgn.hi() > +_FT || _sgn.hi() < -_FT ;
+
+        return ( _sgn.hi() ) ;
     }
 
     __normal_call REAL_TYPE orient3d_i (
@@ -282,8 +499,6 @@
 
         ia_flt    _sgn;
 
-        ia_rnd    _rnd;                   // up rounding!
-
         _adx.from_sub(_pa[0], _pd[0]) ;   // coord. diff.
         _ady.from_sub(_pa[1], _pd[1]) ;
         _adz.from_sub(_pa[2], _pd[2]) ;
@@ -309,8 +524,10 @@
         + _cdz * (_adxbdy - _bdxady);
 
         _OK  =
-          _sgn.lo() >= (REAL_TYPE)0.
-        ||_sgn.up() <= (REAL_TYPE)0.;
+          _sgn.lo() >  (REAL_TYPE)0.
+        ||_sgn.up() <  (REAL_TYPE)0.
+        ||(_sgn.lo() == (REAL_TYPE)0. &&
+           _sgn.up() == (REAL_TYPE)0.);
 
         return ( _sgn.mid() ) ;
     }
@@ -324,8 +541,8 @@
         )
     {
     /*--------------- orient3d predicate, "float" version */
-        REAL_TYPE static const _ER =
-        +  8. * std::pow(mp::_epsilon, 1) ;
+        REAL_TYPE constexpr _ER =
+        +  8. * mp::_epsilon ;
 
         REAL_TYPE _adx, _ady, _adz ,
                   _bdx, _bdy, _bdz ,
@@ -391,5 +608,829 @@
         return ( _sgn ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, given translated coordinates
+     *
+     *   | aex  aey  aez  aet |
+     *   | bex  bey  bez  bet |
+     *   | cex  cey  cez  cet |
+     *   | dex  dey  dez  det |
+     *
+     * with AE = A - E, etc. This is only valid when the
+     * coord. diff. are themselves exact.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE orient4d_t (
+      __const_ptr(REAL_TYPE) _ae ,
+      __const_ptr(REAL_TYPE) _be ,
+      __const_ptr(REAL_TYPE) _ce ,
+      __const_ptr(REAL_TYPE) _de
+        )
+    {
+    /*--------------- orient4d predicate, "shift" version */
+        mp::expansion< 4 > _d2_ab_, _d2_ac_, _d2_ad_ ,
+                           _d2_bc_, _d2_bd_, _d2_cd_ ;
+        mp::expansion< 24> _d3_abc, _d3_abd, _d3_acd ,
+                           _d3_bcd ;
+        mp::expansion<192>_d4full;
+
+        mp::expansion< 1 > _ae_zz_(_ae[ 2]);
+        mp::expansion< 1 > _be_zz_(_be[ 2]);
+        mp::expansion< 1 > _ce_zz_(_ce[ 2]);
+        mp::expansion< 1 > _de_zz_(_de[ 2]);
+        mp::expansion< 1 > _ae_tt_(_ae[ 3]);
+        mp::expansion< 1 > _be_tt_(_be[ 3]);
+        mp::expansion< 1 > _ce_tt_(_ce[ 3]);
+        mp::expansion< 1 > _de_tt_(_de[ 3]);
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _be[ 0], _be[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _ce[ 0], _ce[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_ae[ 0], _ae[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_be[ 0], _be[ 1],
+                        _ce[ 0], _ce[ 1],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_be[ 0], _be[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_ce[ 0], _ce[ 1],
+                        _de[ 0], _de[ 1],
+                        _d2_cd_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_bc_, _ae_zz_,
+                        _d2_ac_, _be_zz_,
+                        _d2_ab_, _ce_zz_,
+                        _d3_abc, +3) ;
+
+        compute_det_3x3(_d2_bd_, _ae_zz_,
+                        _d2_ad_, _be_zz_,
+                        _d2_ab_, _de_zz_,
+                        _d3_abd, +3) ;
+
+        compute_det_3x3(_d2_cd_, _ae_zz_,
+                        _d2_ad_, _ce_zz_,
+                        _d2_ac_, _de_zz_,
+                        _d3_acd, +3) ;
+
+        compute_det_3x3(_d2_cd_, _be_zz_,
+                        _d2_bd_, _ce_zz_,
+                        _d2_bc_, _de_zz_,
+                        _d3_bcd, +3) ;
+
+    /*-------------------------------------- 4 x 4 result */
+        compute_det_4x4(_d3_bcd, _ae_tt_,
+                        _d3_acd, _be_tt_,
+                        _d3_abd, _ce_tt_,
+                        _d3_abc, _de_tt_,
+                        _d4full, +4) ;
+
+    /*-------------------------------------- leading det. */
+        return mp::expansion_est(_d4full) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Compute an exact determinant using multi-precision
+     * expansions, a'la shewchuk
+     *
+     *   | ax  ay  az  at  +1. |
+     *   | bx  by  bz  bt  +1. |
+     *   | cx  cy  cz  ct  +1. |
+     *   | dx  dy  dz  dt  +1. |
+     *   | ex  ey  ez  et  +1. |
+     *
+     * This is the "orientation" predicate in E^4, i.e. the
+     * side of the hyperplane (a,b,c,d) that E lies on.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE orient4d_e (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- orient4d predicate, "exact" version */
+        mp::expansion< 4 > _d2_ab_, _d2_ac_, _d2_ad_ ,
+                           _d2_ae_, _d2_bc_, _d2_bd_ ,
+                           _d2_be_, _d2_cd_, _d2_ce_ ,
+                           _d2_de_ ;
+        mp::expansion< 24> _d3_abc, _d3_abd, _d3_abe ,
+                           _d3_acd, _d3_ace, _d3_ade ,
+                           _d3_bcd, _d3_bce, _d3_bde ,
+                           _d3_cde ;
+        mp::expansion<192> _d4abcd, _d4abce, _d4abde ,
+                           _d4acde, _d4bcde ;
+        mp::expansion<960>_d5full;
+
+        _OK = true;
+
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ae[4], _be[4], _ce[4], _de[4] ;
+        if (mp::translate_exact<4>(_pa, _pe, _ae) &&
+            mp::translate_exact<4>(_pb, _pe, _be) &&
+            mp::translate_exact<4>(_pc, _pe, _ce) &&
+            mp::translate_exact<4>(_pd, _pe, _de) )
+        {
+            return orient4d_t(_ae, _be, _ce, _de) ;
+        }
+
+        mp::expansion< 1 > _pa_zz_(_pa[ 2]);
+        mp::expansion< 1 > _pb_zz_(_pb[ 2]);
+        mp::expansion< 1 > _pc_zz_(_pc[ 2]);
+        mp::expansion< 1 > _pd_zz_(_pd[ 2]);
+        mp::expansion< 1 > _pe_zz_(_pe[ 2]);
+        mp::expansion< 1 > _pa_tt_(_pa[ 3]);
+        mp::expansion< 1 > _pb_tt_(_pb[ 3]);
+        mp::expansion< 1 > _pc_tt_(_pc[ 3]);
+        mp::expansion< 1 > _pd_tt_(_pd[ 3]);
+        mp::expansion< 1 > _pe_tt_(_pe[ 3]);
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pb[ 0], _pb[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_ad_ ) ;
+
+        compute_det_2x2(_pa[ 0], _pa[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_ae_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pc[ 0], _pc[ 1],
+                        _d2_bc_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_bd_ ) ;
+
+        compute_det_2x2(_pb[ 0], _pb[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_be_ ) ;
+
+        compute_det_2x2(_pc[ 0], _pc[ 1],
+                        _pd[ 0], _pd[ 1],
+                        _d2_cd_ ) ;
+
+        compute_det_2x2(_pc[ 0], _pc[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_ce_ ) ;
+
+        compute_det_2x2(_pd[ 0], _pd[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_de_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_bc_, _pa_zz_,
+                        _d2_ac_, _pb_zz_,
+                        _d2_ab_, _pc_zz_,
+                        _d3_abc, +3) ;
+
+        compute_det_3x3(_d2_bd_, _pa_zz_,
+                        _d2_ad_, _pb_zz_,
+                        _d2_ab_, _pd_zz_,
+                        _d3_abd, +3) ;
+
+        compute_det_3x3(_d2_be_, _pa_zz_,
+                        _d2_ae_, _pb_zz_,
+                        _d2_ab_, _pe_zz_,
+                        _d3_abe, +3) ;
+
+        compute_det_3x3(_d2_cd_, _pa_zz_,
+                        _d2_ad_, _pc_zz_,
+                        _d2_ac_, _pd_zz_,
+                        _d3_acd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _pa_zz_,
+                        _d2_ae_, _pc_zz_,
+                        _d2_ac_, _pe_zz_,
+                        _d3_ace, +3) ;
+
+        compute_det_3x3(_d2_de_, _pa_zz_,
+                        _d2_ae_, _pd_zz_,
+                        _d2_ad_, _pe_zz_,
+                        _d3_ade, +3) ;
+
+        compute_det_3x3(_d2_cd_, _pb_zz_,
+                        _d2_bd_, _pc_zz_,
+                        _d2_bc_, _pd_zz_,
+                        _d3_bcd, +3) ;
+
+        compute_det_3x3(_d2_ce_, _pb_zz_,
+                        _d2_be_, _pc_zz_,
+                        _d2_bc_, _pe_zz_,
+                        _d3_bce, +3) ;
+
+        compute_det_3x3(_d2_de_, _pb_zz_,
+                        _d2_be_, _pd_zz_,
+                        _d2_bd_, _pe_zz_,
+                        _d3_bde, +3) ;
+
+        compute_det_3x3(_d2_de_, _pc_zz_,
+                        _d2_ce_, _pd_zz_,
+                        _d2_cd_, _pe_zz_,
+                        _d3_cde, +3) ;
+
+    /*-------------------------------------- 4 x 4 minors */
+        compute_det_4x4(_d3_bcd, _pa_tt_,
+                        _d3_acd, _pb_tt_,
+                        _d3_abd, _pc_tt_,
+                        _d3_abc, _pd_tt_,
+                        _d4abcd, +4) ;
+
+        compute_det_4x4(_d3_bce, _pa_tt_,
+                        _d3_ace, _pb_tt_,
+                        _d3_abe, _pc_tt_,
+                        _d3_abc, _pe_tt_,
+                        _d4abce, +4) ;
+
+        compute_det_4x4(_d3_bde, _pa_tt_,
+                        _d3_ade, _pb_tt_,
+                        _d3_abe, _pd_tt_,
+                        _d3_abd, _pe_tt_,
+                        _d4abde, +4) ;
+
+        compute_det_4x4(_d3_cde, _pa_tt_,
+                        _d3_ade, _pc_tt_,
+                        _d3_ace, _pd_tt_,
+                        _d3_acd, _pe_tt_,
+                        _d4acde, +4) ;
+
+        compute_det_4x4(_d3_cde, _pb_tt_,
+                        _d3_bde, _pc_tt_,
+                        _d3_bce, _pd_tt_,
+                        _d3_bcd, _pe_tt_,
+                        _d4bcde, +4) ;
+
+    /*-------------------------------------- 5 x 5 result */
+        unitary_det_5x5(_d4bcde, _d4acde,
+                        _d4abde, _d4abce,
+                        _d4abcd,
+                        _d5full, +5) ;
+
+        return (REAL_TYPE)
+            mp::expansion_sgn(_d5full) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     *
+     * Adaptive evaluation of the orient4d determinant
+     *
+     *   | aex  aey  aez  aet |
+     *   | bex  bey  bez  bet |
+     *   | cex  cey  cez  cet |
+     *   | dex  dey  dez  det |
+     *
+     * Stage B evaluates the translated det. exactly, given
+     * the rounded coord. diff. AE = A - E, etc. Each term
+     * is a product of 4 diff., each with relative error at
+     * most EPS, so the error in stage B is bounded by
+     * (4 EPS + O(EPS^2)) times the permanent. When the diff.
+     * are all exact, stage B is also exact. Otherwise, the
+     * full 5 x 5 determinant is required.
+     *
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE orient4d_a (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- orient4d predicate, "adapt" version */
+        REAL_TYPE constexpr _EB =
+        +  4. * mp::_epsilon
+        + 64. * mp::_epsilon * mp::_epsilon ;
+
+        REAL_TYPE _aex, _aey, _aez, _aet ,
+                  _bex, _bey, _bez, _bet ,
+                  _cex, _cey, _cez, _cet ,
+                  _dex, _dey, _dez, _det ;
+        REAL_TYPE _aext, _aeyt, _aezt, _aett ,
+                  _bext, _beyt, _bezt, _bett ,
+                  _cext, _ceyt, _cezt, _cett ,
+                  _dext, _deyt, _dezt, _dett ;
+        REAL_TYPE _AB_, _AC_, _AD_, _BC_ ,
+                  _BD_, _CD_ ;
+        REAL_TYPE _ABC, _ABD, _ACD, _BCD ;
+
+        REAL_TYPE _d44, _PP, _FT ;
+
+        _OK = false;
+
+        mp::one_one_sub_full(             // coord. diff.
+            _pa[0], _pe[0], _aex, _aext) ;
+        mp::one_one_sub_full(
+            _pa[1], _pe[1], _aey, _aeyt) ;
+        mp::one_one_sub_full(
+            _pa[2], _pe[2], _aez, _aezt) ;
+        mp::one_one_sub_full(
+            _pa[3], _pe[3], _aet, _aett) ;
+
+        mp::one_one_sub_full(
+            _pb[0], _pe[0], _bex, _bext) ;
+        mp::one_one_sub_full(
+            _pb[1], _pe[1], _bey, _beyt) ;
+        mp::one_one_sub_full(
+            _pb[2], _pe[2], _bez, _bezt) ;
+        mp::one_one_sub_full(
+            _pb[3], _pe[3], _bet, _bett) ;
+
+        mp::one_one_sub_full(
+            _pc[0], _pe[0], _cex, _cext) ;
+        mp::one_one_sub_full(
+            _pc[1], _pe[1], _cey, _ceyt) ;
+        mp::one_one_sub_full(
+            _pc[2], _pe[2], _cez, _cezt) ;
+        mp::one_one_sub_full(
+            _pc[3], _pe[3], _cet, _cett) ;
+
+        mp::one_one_sub_full(
+            _pd[0], _pe[0], _dex, _dext) ;
+        mp::one_one_sub_full(
+            _pd[1], _pe[1], _dey, _deyt) ;
+        mp::one_one_sub_full(
+            _pd[2], _pe[2], _dez, _dezt) ;
+        mp::one_one_sub_full(
+            _pd[3], _pe[3], _det, _dett) ;
+
+        _AB_ = std::abs(_aex * _bey)      // 2 x 2 minors
+             + std::abs(_bex * _aey) ;
+        _AC_ = std::abs(_aex * _cey)
+             + std::abs(_cex * _aey) ;
+        _AD_ = std::abs(_aex * _dey)
+             + std::abs(_dex * _aey) ;
+        _BC_ = std::abs(_bex * _cey)
+             + std::abs(_cex * _bey) ;
+        _BD_ = std::abs(_bex * _dey)
+             + std::abs(_dex * _bey) ;
+        _CD_ = std::abs(_cex * _dey)
+             + std::abs(_dex * _cey) ;
+
+        _ABC =                            // 3 x 3 minors
+          std::abs(_aez) * _BC_ + std::abs(_bez) * _AC_
+        + std::abs(_cez) * _AB_ ;
+
+        _ABD =
+          std::abs(_aez) * _BD_ + std::abs(_bez) * _AD_
+        + std::abs(_dez) * _AB_ ;
+
+        _ACD =
+          std::abs(_aez) * _CD_ + std::abs(_cez) * _AD_
+        + std::abs(_dez) * _AC_ ;
+
+        _BCD =
+          std::abs(_bez) * _CD_ + std::abs(_cez) * _BD_
+        + std::abs(_dez) * _BC_ ;
+
+        _PP  =                            // permanent
+          std::abs(_aet) * _BCD + std::abs(_bet) * _ACD
+        + std::abs(_cet) * _ABD + std::abs(_det) * _ABC ;
+
+        if (!std::isfinite(_PP))
+            return ( +0.0 ) ;
+
+    /*------------- stage B: exact det. of rounded diff. */
+        REAL_TYPE _ae[4] = {_aex, _aey, _aez, _aet} ;
+        REAL_TYPE _be[4] = {_bex, _bey, _bez, _bet} ;
+        REAL_TYPE _ce[4] = {_cex, _cey, _cez, _cet} ;
+        REAL_TYPE _de[4] = {_dex, _dey, _dez, _det} ;
+
+        _d44 = orient4d_t(_ae, _be, _ce, _de) ;
+
+        _FT  = _PP * _EB ;
+
+        if (_d44 >= _FT || -_d44 >= _FT)
+        {
+            _OK = true; return _d44 ;
+        }
+
+        if (_aext == 0. && _aeyt == 0. && _aezt == 0. &&
+            _aett == 0. && _bext == 0. && _beyt == 0. &&
+            _bezt == 0. && _bett == 0. && _cext == 0. &&
+            _ceyt == 0. && _cezt == 0. && _cett == 0. &&
+            _dext == 0. && _deyt == 0. && _dezt == 0. &&
+            _dett == 0. )
+        {                   // diff. exact, so det. exact
+            _OK = true; return _d44 ;
+        }
+
+        return ( _d44 ) ;
+    }
+
+    __normal_call REAL_TYPE orient4d_d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- orient4d predicate, "ddflt" version */
+        REAL_TYPE constexpr _ER =
+        + 14. * _dd_eps ;
+
+        dd_flt    _aex, _aey, _aez, _aet ,
+                  _bex, _bey, _bez, _bet ,
+                  _cex, _cey, _cez, _cet ,
+                  _dex, _dey, _dez, _det ;
+        dd_flt    _aexbey, _bexaey ,
+                  _aexcey, _cexaey ,
+                  _aexdey, _dexaey ,
+                  _bexcey, _cexbey ,
+                  _bexdey, _dexbey ,
+                  _cexdey, _dexcey ;
+        dd_flt    _ab_, _ac_, _ad_, _bc_ ,
+                  _bd_, _cd_ ;
+        dd_flt    _abc, _abd, _acd, _bcd ;
+
+        REAL_TYPE _AEZ, _AET ,
+                  _BEZ, _BET ,
+                  _CEZ, _CET ,
+                  _DEZ, _DET ;
+        REAL_TYPE _AB_, _AC_, _AD_, _BC_ ,
+                  _BD_, _CD_ ;
+        REAL_TYPE _ABC, _ABD, _ACD, _BCD ;
+
+        dd_flt    _sgn ;
+        REAL_TYPE _FT ;
+
+        _aex.from_sub(_pa[0], _pe[0]) ;   // coord. diff.
+        _aey.from_sub(_pa[1], _pe[1]) ;
+        _aez.from_sub(_pa[2], _pe[2]) ;
+        _aet.from_sub(_pa[3], _pe[3]) ;
+
+        _AEZ = std::abs (_aez.hi()) ;
+        _AET = std::abs (_aet.hi()) ;
+
+        _bex.from_sub(_pb[0], _pe[0]) ;
+        _bey.from_sub(_pb[1], _pe[1]) ;
+        _bez.from_sub(_pb[2], _pe[2]) ;
+        _bet.from_sub(_pb[3], _pe[3]) ;
+
+        _BEZ = std::abs (_bez.hi()) ;
+        _BET = std::abs (_bet.hi()) ;
+
+        _cex.from_sub(_pc[0], _pe[0]) ;
+        _cey.from_sub(_pc[1], _pe[1]) ;
+        _cez.from_sub(_pc[2], _pe[2]) ;
+        _cet.from_sub(_pc[3], _pe[3]) ;
+
+        _CEZ = std::abs (_cez.hi()) ;
+        _CET = std::abs (_cet.hi()) ;
+
+        _dex.from_sub(_pd[0], _pe[0]) ;
+        _dey.from_sub(_pd[1], _pe[1]) ;
+        _dez.from_sub(_pd[2], _pe[2]) ;
+        _det.from_sub(_pd[3], _pe[3]) ;
+
+        _DEZ = std::abs (_dez.hi()) ;
+        _DET = std::abs (_det.hi()) ;
+
+        _aexbey = _aex * _bey ;           // 2 x 2 minors
+        _bexaey = _bex * _aey ;
+        _ab_ = _aexbey - _bexaey ;
+        _AB_ = std::abs(_aexbey.hi())
+             + std::abs(_bexaey.hi()) ;
+
+        _aexcey = _aex * _cey ;
+        _cexaey = _cex * _aey ;
+        _ac_ = _aexcey - _cexaey ;
+        _AC_ = std::abs(_aexcey.hi())
+             + std::abs(_cexaey.hi()) ;
+
+        _aexdey = _aex * _dey ;
+        _dexaey = _dex * _aey ;
+        _ad_ = _aexdey - _dexaey ;
+        _AD_ = std::abs(_aexdey.hi())
+             + std::abs(_dexaey.hi()) ;
+
+        _bexcey = _bex * _cey ;
+        _cexbey = _cex * _bey ;
+        _bc_ = _bexcey - _cexbey ;
+        _BC_ = std::abs(_bexcey.hi())
+             + std::abs(_cexbey.hi()) ;
+
+        _bexdey = _bex * _dey ;
+        _dexbey = _dex * _bey ;
+        _bd_ = _bexdey - _dexbey ;
+        _BD_ = std::abs(_bexdey.hi())
+             + std::abs(_dexbey.hi()) ;
+
+        _cexdey = _cex * _dey ;
+        _dexcey = _dex * _cey ;
+        _cd_ = _cexdey - _dexcey ;
+        _CD_ = std::abs(_cexdey.hi())
+             + std::abs(_dexcey.hi()) ;
+
+        _abc =                            // 3 x 3 minors
+          _aez * _bc_ - _bez * _ac_
+        + _cez * _ab_ ;
+        _ABC =
+          _AEZ * _BC_ + _BEZ * _AC_
+        + _CEZ * _AB_ ;
+
+        _abd =
+          _aez * _bd_ - _bez * _ad_
+        + _dez * _ab_ ;
+        _ABD =
+          _AEZ * _BD_ + _BEZ * _AD_
+        + _DEZ * _AB_ ;
+
+        _acd =
+          _aez * _cd_ - _cez * _ad_
+        + _dez * _ac_ ;
+        _ACD =
+          _AEZ * _CD_ + _CEZ * _AD_
+        + _DEZ * _AC_ ;
+
+        _bcd =
+          _bez * _cd_ - _cez * _bd_
+        + _dez * _bc_ ;
+        _BCD =
+          _BEZ * _CD_ + _CEZ * _BD_
+        + _DEZ * _BC_ ;
+
+        _FT  =                            // roundoff tol
+          _AET * _BCD + _BET * _ACD
+        + _CET * _ABD + _DET * _ABC ;
+
+        _FT *= _ER ;
+
+        _sgn =                            // 4 x 4 result
+          _det * _abc - _cet * _abd
+        + _bet * _acd - _aet * _bcd ;
+
+        _OK  =
+          _sgn.hi() > +_FT || _sgn.hi() < -_FT ;
+
+        return ( _sgn.hi() ) ;
+    }
+
+    __normal_call REAL_TYPE orient4d_i (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- orient4d predicate, "bound" version */
+        ia_flt    _aex, _aey, _aez, _aet ,
+                  _bex, _bey, _bez, _bet ,
+                  _cex, _cey, _cez, _cet ,
+                  _dex, _dey, _dez, _det ;
+        ia_flt    _ab_, _ac_, _ad_, _bc_ ,
+                  _bd_, _cd_ ;
+        ia_flt    _abc, _abd, _acd, _bcd ;
+        ia_flt    _sgn;
+
+        _aex.from_sub(_pa[0], _pe[0]) ;   // coord. diff.
+        _aey.from_sub(_pa[1], _pe[1]) ;
+        _aez.from_sub(_pa[2], _pe[2]) ;
+        _aet.from_sub(_pa[3], _pe[3]) ;
+
+        _bex.from_sub(_pb[0], _pe[0]) ;
+        _bey.from_sub(_pb[1], _pe[1]) ;
+        _bez.from_sub(_pb[2], _pe[2]) ;
+        _bet.from_sub(_pb[3], _pe[3]) ;
+
+        _cex.from_sub(_pc[0], _pe[0]) ;
+        _cey.from_sub(_pc[1], _pe[1]) ;
+        _cez.from_sub(_pc[2], _pe[2]) ;
+        _cet.from_sub(_pc[3], _pe[3]) ;
+
+        _dex.from_sub(_pd[0], _pe[0]) ;
+        _dey.from_sub(_pd[1], _pe[1]) ;
+        _dez.from_sub(_pd[2], _pe[2]) ;
+        _det.from_sub(_pd[3], _pe[3]) ;
+
+        _ab_ = _aex * _bey                // 2 x 2 minors
+             - _bex * _aey ;
+        _ac_ = _aex * _cey
+             - _cex * _aey ;
+        _ad_ = _aex * _dey
+             - _dex * _aey ;
+        _bc_ = _bex * _cey
+             - _cex * _bey ;
+        _bd_ = _bex * _dey
+             - _dex * _bey ;
+        _cd_ = _cex * _dey
+             - _dex * _cey ;
+
+        _abc =                            // 3 x 3 minors
+          _aez * _bc_ - _bez * _ac_
+        + _cez * _ab_ ;
+
+        _abd =
+          _aez * _bd_ - _bez * _ad_
+        + _dez * _ab_ ;
+
+        _acd =
+          _aez * _cd_ - _cez * _ad_
+        + _dez * _ac_ ;
+
+        _bcd =
+          _bez * _cd_ - _cez * _bd_
+        + _dez * _bc_ ;
+
+        _sgn =                            // 4 x 4 result
+          _det * _abc - _cet * _abd
+        + _bet * _acd - _aet * _bcd ;
+
+        _OK  =
+          _sgn.lo() >  (REAL_TYPE)0.
+        ||_sgn.up() <  (REAL_TYPE)0.
+        ||(_sgn.lo() == (REAL_TYPE)0. &&
+           _sgn.up() == (REAL_TYPE)0.);
+
+        return ( _sgn.mid() ) ;
+    }
+
+    __normal_call REAL_TYPE orient4d_f (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        )
+    {
+    /*--------------- orient4d predicate, "float" version */
+        REAL_TYPE constexpr _ER =
+        + 14. * mp::_epsilon ;
+
+        REAL_TYPE _aex, _aey, _aez, _aet ,
+                  _bex, _bey, _bez, _bet ,
+                  _cex, _cey, _cez, _cet ,
+                  _dex, _dey, _dez, _det ;
+        REAL_TYPE _aexbey, _bexaey ,
+                  _aexcey, _cexaey ,
+                  _aexdey, _dexaey ,
+                  _bexcey, _cexbey ,
+                  _bexdey, _dexbey ,
+                  _cexdey, _dexcey ;
+        REAL_TYPE _ab_, _ac_, _ad_, _bc_ ,
+                  _bd_, _cd_ ;
+        REAL_TYPE _abc, _abd, _acd, _bcd ;
+
+        REAL_TYPE _AEZ, _AET ,
+                  _BEZ, _BET ,
+                  _CEZ, _CET ,
+                  _DEZ, _DET ;
+        REAL_TYPE _AB_, _AC_, _AD_, _BC_ ,
+                  _BD_, _CD_ ;
+        REAL_TYPE _ABC, _ABD, _ACD, _BCD ;
+
+        REAL_TYPE _sgn, _FT ;
+
+        _aex = _pa [0] - _pe [0] ;        // coord. diff.
+        _aey = _pa [1] - _pe [1] ;
+        _aez = _pa [2] - _pe [2] ;
+        _aet = _pa [3] - _pe [3] ;
+
+        _AEZ = std::abs (_aez) ;
+        _AET = std::abs (_aet) ;
+
+        _bex = _pb [0] - _pe [0] ;
+        _bey = _pb [1] - _pe [1] ;
+        _bez = _pb [2] - _pe [2] ;
+        _bet = _pb [3] - _pe [3] ;
+
+        _BEZ = std::abs (_bez) ;
+        _BET = std::abs (_bet) ;
+
+        _cex = _pc [0] - _pe [0] ;
+        _cey = _pc [1] - _pe [1] ;
+        _cez = _pc [2] - _pe [2] ;
+        _cet = _pc [3] - _pe [3] ;
+
+        _CEZ = std::abs (_cez) ;
+        _CET = std::abs (_cet) ;
+
+        _dex = _pd [0] - _pe [0] ;
+        _dey = _pd [1] - _pe [1] ;
+        _dez = _pd [2] - _pe [2] ;
+        _det = _pd [3] - _pe [3] ;
+
+        _DEZ = std::abs (_dez) ;
+        _DET = std::abs (_det) ;
+
+        _aexbey = _aex * _bey ;           // 2 x 2 minors
+        _bexaey = _bex * _aey ;
+        _ab_ = _aexbey - _bexaey ;
+        _AB_ = std::abs(_aexbey)
+             + std::abs(_bexaey) ;
+
+        _aexcey = _aex * _cey ;
+        _cexaey = _cex * _aey ;
+        _ac_ = _aexcey - _cexaey ;
+        _AC_ = std::abs(_aexcey)
+             + std::abs(_cexaey) ;
+
+        _aexdey = _aex * _dey ;
+        _dexaey = _dex * _aey ;
+        _ad_ = _aexdey - _dexaey ;
+        _AD_ = std::abs(_aexdey)
+             + std::abs(_dexaey) ;
+
+        _bexcey = _bex * _cey ;
+        _cexbey = _cex * _bey ;
+        _bc_ = _bexcey - _cexbey ;
+        _BC_ = std::abs(_bexcey)
+             + std::abs(_cexbey) ;
+
+        _bexdey = _bex * _dey ;
+        _dexbey = _dex * _bey ;
+        _bd_ = _bexdey - _dexbey ;
+        _BD_ = std::abs(_bexdey)
+             + std::abs(_dexbey) ;
+
+        _cexdey = _cex * _dey ;
+        _dexcey = _dex * _cey ;
+        _cd_ = _cexdey - _dexcey ;
+        _CD_ = std::abs(_cexdey)
+             + std::abs(_dexcey) ;
+
+        _abc =                            // 3 x 3 minors
+          _aez * _bc_ - _bez * _ac_
+        + _cez * _ab_ ;
+        _ABC =
+          _AEZ * _BC_ + _BEZ * _AC_
+        + _CEZ * _AB_ ;
+
+        _abd =
+          _aez * _bd_ - _bez * _ad_
+        + _dez * _ab_ ;
+        _ABD =
+          _AEZ * _BD_ + _BEZ * _AD_
+        + _DEZ * _AB_ ;
+
+        _acd =
+          _aez * _cd_ - _cez * _ad_
+        + _dez * _ac_ ;
+        _ACD =
+          _AEZ * _CD_ + _CEZ * _AD_
+        + _DEZ * _AC_ ;
+
+        _bcd =
+          _bez * _cd_ - _cez * _bd_
+        + _dez * _bc_ ;
+        _BCD =
+          _BEZ * _CD_ + _CEZ * _BD_
+        + _DEZ * _BC_ ;
+
+        _FT  =                            // roundoff tol
+          _AET * _BCD + _BET * _ACD
+        + _CET * _ABD + _DET * _ABC ;
+
+        _FT *= _ER ;
+
+        _sgn =                            // 4 x 4 result
+          _det * _abc - _cet * _abd
+        + _bet * _acd - _aet * _bcd ;
+
+        _OK  =
+          _sgn > +_FT || _sgn < -_FT ;
+
+        return ( _sgn ) ;
+    }
+
 
 
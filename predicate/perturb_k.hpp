@@ -0,0 +1,426 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 16 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Symbolically perturbed predicates, that never return
+     * zero, a'la "Simulation of Simplicity" [Edelsbrunner
+     * and Muecke, 1990].
+     *
+     * Each point carries a (unique) index i, and its coord.
+     * are perturbed as x_i,j + eps^(2^(i*d-j)), so that the
+     * lower index is perturbed "more". When the exact det.
+     * is zero, the sign of the perturbed det. is the sign
+     * of the first non-zero term in a fixed sequence of
+     * (signed) minors of the points, sorted by index. These
+     * minors are just coord. differences and projected
+     * orient2d's, evaluated exactly.
+     *
+     * In-ball tests instead perturb the lifted coord. by a
+     * (much larger) delta_i, again more for lower i. The
+     * sign is then that of the first non-zero delta term,
+     * each +/- an orient-kd of the other points, see the
+     * notes on INBALL-kD below.
+     *
+     * The filtered predicates are called first, so inputs
+     * that are not degenerate pay nothing extra. Returns
+     * the predicate value if non-zero, otherwise +1 or -1
+     * for the perturbed configuration.
+     *
+    --------------------------------------------------------
+     */
+
+    /*--------------- sort pts. by index: return parity */
+
+    template <
+        size_t NP
+             >
+    __inline_call INDX_TYPE sos_sort (
+        INDX_TYPE             (&_ii) [NP] ,
+      __const_ptr(REAL_TYPE)  (&_pp) [NP]
+        )
+    {
+        INDX_TYPE _sg = +1 ;
+        for (size_t _jj = +1; _jj < NP; ++_jj)
+        for (size_t _kk = _jj; _kk > 0 &&
+                _ii[_kk - 1] > _ii[_kk]; --_kk)
+        {
+            std::swap(_ii[_kk - 1], _ii[_kk]) ;
+            std::swap(_pp[_kk - 1], _pp[_kk]) ;
+            _sg = -_sg ;
+        }
+        return _sg ;
+    }
+
+    /*--------------- sign of an exact coord. difference */
+
+    __inline_call INDX_TYPE sos_diff (
+        REAL_TYPE  _aa ,
+        REAL_TYPE  _bb
+        )
+    {   return (_aa > _bb) - (_aa < _bb) ;
+    }
+
+    /*--------------- sign of orient2d, on (j,k) coords. */
+
+    __inline_call INDX_TYPE sos_proj (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        INDX_TYPE  _jj ,
+        INDX_TYPE  _kk
+        )
+    {
+        REAL_TYPE _qa[2] = {_pa[_jj], _pa[_kk]} ;
+        REAL_TYPE _qb[2] = {_pb[_jj], _pb[_kk]} ;
+        REAL_TYPE _qc[2] = {_pc[_jj], _pc[_kk]} ;
+
+        REAL_TYPE _rr = orient2d(_qa, _qb, _qc) ;
+
+        return (_rr > +0.) - (_rr < +0.) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * ORIENT-kD: perturbed orientation tests.
+    --------------------------------------------------------
+     */
+
+    __normal_call REAL_TYPE orient2d_sos (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+        INDX_TYPE  _ia ,
+        INDX_TYPE  _ib ,
+        INDX_TYPE  _ic
+        )
+    {
+    /*------------ orient2d predicate, "perturb" version */
+        REAL_TYPE _rr = orient2d(_pa, _pb, _pc) ;
+
+        if (_rr != (REAL_TYPE) +0.) return _rr ;
+
+        INDX_TYPE _ii[3] = {_ia, _ib, _ic} ;
+      __const_ptr(REAL_TYPE) _pp[3] = {_pa, _pb, _pc} ;
+
+        INDX_TYPE _sg = sos_sort(_ii, _pp) ;
+        INDX_TYPE _ss ;
+
+        __const_ptr(REAL_TYPE) _p1 = _pp[0] ;
+        __const_ptr(REAL_TYPE) _p2 = _pp[1] ;
+        __const_ptr(REAL_TYPE) _p3 = _pp[2] ;
+
+        if ((_ss = sos_diff(_p2[0], _p3[0])) != 0)
+            return (REAL_TYPE) (-_sg * _ss) ;
+
+        if ((_ss = sos_diff(_p2[1], _p3[1])) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        if ((_ss = sos_diff(_p1[0], _p3[0])) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        return (REAL_TYPE) (+_sg) ;
+    }
+
+    __normal_call REAL_TYPE orient3d_sos (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        INDX_TYPE  _ia ,
+        INDX_TYPE  _ib ,
+        INDX_TYPE  _ic ,
+        INDX_TYPE  _id
+        )
+    {
+    /*------------ orient3d predicate, "perturb" version */
+        REAL_TYPE _rr = orient3d(_pa, _pb, _pc, _pd) ;
+
+        if (_rr != (REAL_TYPE) +0.) return _rr ;
+
+        INDX_TYPE _ii[4] = {_ia, _ib, _ic, _id} ;
+      __const_ptr(REAL_TYPE) _pp[4] = {_pa, _pb, _pc, _pd} ;
+
+        INDX_TYPE _sg = sos_sort(_ii, _pp) ;
+        INDX_TYPE _ss ;
+
+        __const_ptr(REAL_TYPE) _p1 = _pp[0] ;
+        __const_ptr(REAL_TYPE) _p2 = _pp[1] ;
+        __const_ptr(REAL_TYPE) _p3 = _pp[2] ;
+        __const_ptr(REAL_TYPE) _p4 = _pp[3] ;
+
+        if ((_ss = sos_proj(_p2, _p3, _p4, 0, 1)) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        if ((_ss = sos_proj(_p2, _p3, _p4, 0, 2)) != 0)
+            return (REAL_TYPE) (-_sg * _ss) ;
+
+        if ((_ss = sos_proj(_p2, _p3, _p4, 1, 2)) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        if ((_ss = sos_proj(_p1, _p3, _p4, 0, 1)) != 0)
+            return (REAL_TYPE) (-_sg * _ss) ;
+
+        if ((_ss = sos_diff(_p3[0], _p4[0])) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        if ((_ss = sos_diff(_p3[1], _p4[1])) != 0)
+            return (REAL_TYPE) (-_sg * _ss) ;
+
+        if ((_ss = sos_proj(_p1, _p3, _p4, 0, 2)) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        if ((_ss = sos_diff(_p3[2], _p4[2])) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        if ((_ss = sos_proj(_p1, _p3, _p4, 1, 2)) != 0)
+            return (REAL_TYPE) (-_sg * _ss) ;
+
+        if ((_ss = sos_proj(_p1, _p2, _p4, 0, 1)) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        if ((_ss = sos_diff(_p2[0], _p4[0])) != 0)
+            return (REAL_TYPE) (-_sg * _ss) ;
+
+        if ((_ss = sos_diff(_p2[1], _p4[1])) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        if ((_ss = sos_diff(_p1[0], _p4[0])) != 0)
+            return (REAL_TYPE) (+_sg * _ss) ;
+
+        return (REAL_TYPE) (+_sg) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * INBALL-kD: perturbed in-ball tests.
+    --------------------------------------------------------
+     *
+     * With pts. sorted by index, the lifted coord. of the
+     * i-th pt. is perturbed by delta^(i+1), so the det. is
+     * D + sum_i delta^(i+1) * C_i, where C_i is the cofactor
+     * of the i-th lifted term: +/- the orient-kd of all
+     * pts. other than i. The sign of D is then that of the
+     * first non-zero C_i [Devillers and Teillaud, 2011].
+     *
+     * The C_i only all vanish if the pts. are themselves
+     * degenerate (all coplanar in E^3, etc), in which case
+     * C_0 is resolved via the perturbed orient-kd.
+     *
+    --------------------------------------------------------
+     */
+
+    /*--------------- sign of lift perturbation, sorted */
+
+    __normal_call REAL_TYPE inball2x_sos (
+      __const_ptr(REAL_TYPE)  (&_pp) [4] ,
+        INDX_TYPE const       (&_ii) [4] ,
+        INDX_TYPE  _sg
+        )
+    {
+        for (INDX_TYPE _kk = +0; _kk < +4; ++_kk)
+        {
+            __const_ptr(REAL_TYPE) _qq[3] ;
+            for (INDX_TYPE _jj = +0, _nq = +0;
+                    _jj < +4; ++_jj)
+                if (_jj != _kk) _qq[_nq++] = _pp[_jj] ;
+
+            REAL_TYPE _rr =                 // C_k = +/- orient
+                orient2d(_qq[0], _qq[1], _qq[2]) ;
+
+            if (_rr != (REAL_TYPE) +0.)
+            {
+                if (_kk % 2 != 0) _rr = -_rr ;
+
+                return (REAL_TYPE)
+                    (_rr > +0. ? +_sg : -_sg) ;
+            }
+        }
+
+        REAL_TYPE _rr = orient2d_sos(       // all collinear
+            _pp[1], _pp[2], _pp[3],
+            _ii[1], _ii[2], _ii[3]) ;
+
+        return (REAL_TYPE)
+            (_rr > +0. ? +_sg : -_sg) ;
+    }
+
+    __normal_call REAL_TYPE inball3x_sos (
+      __const_ptr(REAL_TYPE)  (&_pp) [5] ,
+        INDX_TYPE const       (&_ii) [5] ,
+        INDX_TYPE  _sg
+        )
+    {
+        for (INDX_TYPE _kk = +0; _kk < +5; ++_kk)
+        {
+            __const_ptr(REAL_TYPE) _qq[4] ;
+            for (INDX_TYPE _jj = +0, _nq = +0;
+                    _jj < +5; ++_jj)
+                if (_jj != _kk) _qq[_nq++] = _pp[_jj] ;
+
+            REAL_TYPE _rr =                 // C_k = -/+ orient
+                orient3d(_qq[0], _qq[1], _qq[2], _qq[3]) ;
+
+            if (_rr != (REAL_TYPE) +0.)
+            {
+                if (_kk % 2 != 0) _rr = -_rr ;
+
+                return (REAL_TYPE)
+                    (_rr > +0. ? -_sg : +_sg) ;
+            }
+        }
+
+        REAL_TYPE _rr = orient3d_sos(       // all coplanar
+            _pp[1], _pp[2], _pp[3], _pp[4],
+            _ii[1], _ii[2], _ii[3], _ii[4]) ;
+
+        return (REAL_TYPE)
+            (_rr > +0. ? -_sg : +_sg) ;
+    }
+
+    __normal_call REAL_TYPE inball2d_sos (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        INDX_TYPE  _ia ,
+        INDX_TYPE  _ib ,
+        INDX_TYPE  _ic ,
+        INDX_TYPE  _id
+        )
+    {
+    /*------------ inball2d predicate, "perturb" version */
+        REAL_TYPE _rr = inball2d(_pa, _pb, _pc, _pd) ;
+
+        if (_rr != (REAL_TYPE) +0.) return _rr ;
+
+        INDX_TYPE _ii[4] = {_ia, _ib, _ic, _id} ;
+      __const_ptr(REAL_TYPE) _pp[4] = {_pa, _pb, _pc, _pd} ;
+
+        INDX_TYPE _sg = sos_sort(_ii, _pp) ;
+
+        return inball2x_sos(_pp, _ii, _sg) ;
+    }
+
+    __normal_call REAL_TYPE inball2w_sos (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+        INDX_TYPE  _ia ,
+        INDX_TYPE  _ib ,
+        INDX_TYPE  _ic ,
+        INDX_TYPE  _id
+        )
+    {
+    /*------------ inball2w predicate, "perturb" version */
+        REAL_TYPE _rr = inball2w(_pa, _pb, _pc, _pd) ;
+
+        if (_rr != (REAL_TYPE) +0.) return _rr ;
+
+        INDX_TYPE _ii[4] = {_ia, _ib, _ic, _id} ;
+      __const_ptr(REAL_TYPE) _pp[4] = {_pa, _pb, _pc, _pd} ;
+
+        INDX_TYPE _sg = sos_sort(_ii, _pp) ;
+
+        return inball2x_sos(_pp, _ii, _sg) ;
+    }
+
+    __normal_call REAL_TYPE inball3d_sos (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        INDX_TYPE  _ia ,
+        INDX_TYPE  _ib ,
+        INDX_TYPE  _ic ,
+        INDX_TYPE  _id ,
+        INDX_TYPE  _ie
+        )
+    {
+    /*------------ inball3d predicate, "perturb" version */
+        REAL_TYPE _rr = inball3d(_pa, _pb, _pc, _pd, _pe) ;
+
+        if (_rr != (REAL_TYPE) +0.) return _rr ;
+
+        INDX_TYPE _ii[5] = {_ia, _ib, _ic, _id, _ie} ;
+      __const_ptr(REAL_TYPE) _pp[5] = {
+            _pa, _pb, _pc, _pd, _pe} ;
+
+        INDX_TYPE _sg = sos_sort(_ii, _pp) ;
+
+        return inball3x_sos(_pp, _ii, _sg) ;
+    }
+
+    __normal_call REAL_TYPE inball3w_sos (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+        INDX_TYPE  _ia ,
+        INDX_TYPE  _ib ,
+        INDX_TYPE  _ic ,
+        INDX_TYPE  _id ,
+        INDX_TYPE  _ie
+        )
+    {
+    /*------------ inball3w predicate, "perturb" version */
+        REAL_TYPE _rr = inball3w(_pa, _pb, _pc, _pd, _pe) ;
+
+        if (_rr != (REAL_TYPE) +0.) return _rr ;
+
+        INDX_TYPE _ii[5] = {_ia, _ib, _ic, _id, _ie} ;
+      __const_ptr(REAL_TYPE) _pp[5] = {
+            _pa, _pb, _pc, _pd, _pe} ;
+
+        INDX_TYPE _sg = sos_sort(_ii, _pp) ;
+
+        return inball3x_sos(_pp, _ii, _sg) ;
+    }
+
+
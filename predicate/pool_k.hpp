@@ -0,0 +1,468 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 16 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Multi-threaded batched predicates, via a simple work-
+     * stealing pool.
+     *
+     * The input range is cut into chunks of BATCH_GRAIN_SIZE
+     * items, and the chunk indices are dealt out evenly as
+     * one contiguous range [lo, hi) per worker. An owner
+     * takes chunks from the front of its own range; once
+     * empty, it steals the back half of another worker's
+     * range. Both ops are a single CAS on a packed 64-bit
+     * (lo, hi) word, so no locks are taken per chunk.
+     * Stealing matters here: inputs requiring the exact
+     * kernels tend to cluster spatially, so a static split
+     * can leave most threads idle.
+     *
+     * Workers run the usual kernels, so kernel_stats and
+     * the expansion arena are per-thread. The calling
+     * thread joins in as worker 0. Functions passed to
+     * parallel_for must not throw, and only one call to
+     * parallel_for may be active on a pool at a time.
+     *
+    --------------------------------------------------------
+     */
+
+#   ifndef  BATCH_GRAIN_SIZE
+#   define  BATCH_GRAIN_SIZE  256   // items per stolen chunk
+#   endif
+
+    class batch_pool
+    {
+/*-------------- fixed set of workers, with range stealing */
+    public  :
+    typedef void (*call_func) (
+        void *, size_t, size_t) ;
+
+    class alignas(64) part_type
+    {
+    public  :
+        std::atomic<uint64_t>       _range ;
+    } ;
+
+    std::vector<std::thread>   _work ;
+    std::unique_ptr<part_type[]>
+                               _part ;
+
+    std::mutex                 _lock ;
+    std::condition_variable    _wake ;
+    std::condition_variable    _done ;
+
+    size_t                     _epoch = +0 ;
+    size_t                     _busy  = +0 ;
+    bool_type                  _stop  = false ;
+
+    call_func                  _call  = nullptr ;
+    void                      *_data  = nullptr ;
+    size_t                     _nn    = +0 ;
+    size_t                     _grain = +1 ;
+
+    std::atomic<size_t>        _left ;
+
+    public  :
+/*------------------------------ pack/unpack chunk ranges */
+    __inline_call static uint64_t pack (
+        uint64_t   _lo,
+        uint64_t   _hi
+        )
+    {   return (_lo << 32) | _hi ;
+    }
+
+    __inline_call static uint64_t lower (
+        uint64_t   _rr
+        )
+    {   return  _rr >> 32 ;
+    }
+
+    __inline_call static uint64_t upper (
+        uint64_t   _rr
+        )
+    {   return  _rr & 0xffffffff ;
+    }
+
+/*------------------------------ take next chunk from own */
+    __inline_call bool_type take (
+        size_t     _id,
+        uint64_t  &_ck
+        )
+    {
+        std::atomic<uint64_t> &_rr =
+            this->_part[_id]._range ;
+
+        uint64_t _r0 = _rr.load() ;
+        for ( ; ; )
+        {
+            uint64_t _lo = lower(_r0) ;
+            uint64_t _hi = upper(_r0) ;
+
+            if (_lo >= _hi) return false ;
+
+            if (_rr.compare_exchange_weak(
+                    _r0, pack(_lo + 1, _hi)))
+            {
+                _ck = _lo ; return true ;
+            }
+        }
+    }
+
+/*------------------------------ steal half from a victim */
+    __inline_call bool_type steal (
+        size_t     _id
+        )
+    {
+        size_t _nw = this->_work.size() + 1 ;
+
+        for (size_t _kk = +1; _kk < _nw; ++_kk)
+        {
+            std::atomic<uint64_t> &_rr =
+            this->_part[(_id + _kk) % _nw]._range ;
+
+            uint64_t _r0 = _rr.load() ;
+            for ( ; ; )
+            {
+                uint64_t _lo = lower(_r0) ;
+                uint64_t _hi = upper(_r0) ;
+
+                if (_lo >= _hi) break ;
+
+                uint64_t _mi =
+                    _hi - (_hi - _lo + 1) / 2 ;
+
+                if (_rr.compare_exchange_weak(
+                        _r0, pack(_lo, _mi)))
+                {
+                    this->_part[_id]._range.store(
+                        pack(_mi, _hi)) ;
+                    return true ;
+                }
+            }
+        }
+
+        return false ;
+    }
+
+/*------------------------------ run chunks until drained */
+    __inline_call void drain (
+        size_t     _id
+        )
+    {
+        for ( ; this->_left.load() > 0 ; )
+        {
+            uint64_t _ck ;
+            if (take(_id, _ck))
+            {
+                size_t _i0 = _ck * this->_grain ;
+                size_t _i1 = std::min(
+                    _i0 + this->_grain, this->_nn) ;
+
+                this->_call(this->_data, _i0, _i1) ;
+
+                this->_left.fetch_sub(+1) ;
+            }
+            else
+            if (!steal(_id))
+            {
+                std::this_thread::yield() ;
+            }
+        }
+    }
+
+/*------------------------------ worker: wait for new job */
+    __inline_call void worker (
+        size_t     _id
+        )
+    {
+        size_t _seen = +0 ;
+        for ( ; ; )
+        {
+            {
+            std::unique_lock<std::mutex> _lk(this->_lock) ;
+            this->_wake.wait(_lk, [&] {
+                return this->_stop ||
+                       this->_epoch != _seen ; } ) ;
+
+            if (this->_stop) return ;
+
+            _seen = this->_epoch ;
+            }
+
+            drain(_id) ;
+
+            {
+            std::lock_guard<std::mutex> _lk(this->_lock) ;
+            if (--this->_busy == +0)
+                this->_done.notify_all() ;
+            }
+        }
+    }
+
+    template <
+        typename  func_type
+             >
+    __inline_call static void thunk (
+        void      *_data,
+        size_t     _i0,
+        size_t     _i1
+        )
+    {   (*static_cast<func_type *>(_data)) (_i0, _i1) ;
+    }
+
+    public  :
+/*------------------------------ spawn NT - 1 extra threads */
+    __inline_call batch_pool (
+        size_t     _nt = std::thread::hardware_concurrency()
+        )
+    {
+        if (_nt < 1) _nt = +1 ;
+
+        this->_part.reset(new part_type[_nt]) ;
+
+        for (size_t _id = +0; _id < _nt; ++_id)
+            this->_part[_id]._range.store(pack(0, 0)) ;
+
+        this->_left.store(+0) ;
+
+        for (size_t _id = +1; _id < _nt; ++_id)
+            this->_work.emplace_back(
+                &batch_pool::worker, this, _id) ;
+    }
+
+    __inline_call~batch_pool (
+        )
+    {
+        {
+        std::lock_guard<std::mutex> _lk(this->_lock) ;
+        this->_stop = true ;
+        }
+        this->_wake.notify_all() ;
+
+        for (auto &_tt : this->_work) _tt.join() ;
+    }
+
+    batch_pool (batch_pool const&) = delete ;
+    batch_pool& operator = (
+        batch_pool const&) = delete ;
+
+    __inline_call size_t size (
+        ) const
+    {   return this->_work.size() + 1 ;
+    }
+
+/*------------------------------ call FF(i0, i1) on chunks */
+    template <
+        typename  func_type
+             >
+    __inline_call void parallel_for (
+        size_t     _nn,
+        size_t     _grain,
+        func_type &&_ff
+        )
+    {
+        if (_grain < 1) _grain = +1 ;
+
+        size_t _nc = (_nn + _grain - 1) / _grain ;
+        size_t _nw = size() ;
+
+        if (_nc <= 1 || _nw <= 1 ||
+            _nc > (size_t) 0xffffffff)
+        {                           // just run serially
+            if (_nn > 0) _ff((size_t)0, _nn) ;
+            return ;
+        }
+
+        typedef typename
+            std::remove_reference<func_type>::type fn_type;
+
+        {
+        std::lock_guard<std::mutex> _lk(this->_lock) ;
+
+        this->_call  = &thunk<fn_type> ;
+        this->_data  = (void *) &_ff ;
+        this->_nn    = _nn ;
+        this->_grain = _grain ;
+
+        for (size_t _id = +0; _id < _nw; ++_id)
+        {                           // even initial split
+            this->_part[_id]._range.store(pack(
+                (_nc * (_id + 0)) / _nw ,
+                (_nc * (_id + 1)) / _nw )) ;
+        }
+
+        this->_left.store(_nc) ;
+        this->_busy = _nw - 1 ;
+        this->_epoch+= +1 ;
+        }
+        this->_wake.notify_all() ;
+
+        drain(+0) ;
+
+        std::unique_lock<std::mutex> _lk(this->_lock) ;
+        this->_done.wait(_lk, [&] {
+            return this->_busy == +0 ; } ) ;
+    }
+    } ;
+
+    /*
+    --------------------------------------------------------
+     * ORIENT-kD: threaded versions of the SoA batches.
+    --------------------------------------------------------
+     */
+
+    __normal_call void orient2d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __const_ptr(INDX_TYPE) _tt ,
+      __write_ptr(REAL_TYPE) _rr ,
+        batch_pool &_pool
+        )
+    {
+    /*------------ orient2d predicate, "threaded" xy + tri */
+        _pool.parallel_for(_nn, BATCH_GRAIN_SIZE,
+            [=] (size_t _i0, size_t _i1) {
+            orient2d_batch(_i1 - _i0,
+                _pp, _tt + _i0 * 3, _rr + _i0) ;
+            } ) ;
+    }
+
+    __normal_call void orient3d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __const_ptr(INDX_TYPE) _tt ,
+      __write_ptr(REAL_TYPE) _rr ,
+        batch_pool &_pool
+        )
+    {
+    /*------------ orient3d predicate, "threaded" xyz + tet */
+        _pool.parallel_for(_nn, BATCH_GRAIN_SIZE,
+            [=] (size_t _i0, size_t _i1) {
+            orient3d_batch(_i1 - _i0,
+                _pp, _tt + _i0 * 4, _rr + _i0) ;
+            } ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * INBALL-kD: batched in-ball tests for point queries.
+    --------------------------------------------------------
+     */
+
+    __normal_call void inball2d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __const_ptr(INDX_TYPE) _tt ,
+      __const_ptr(INDX_TYPE) _qq ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ inball2d predicate, "batched" xy + tri */
+        for (size_t _ii = +0; _ii < _nn; ++_ii)
+        {
+            __const_ptr(INDX_TYPE) _ti = _tt + _ii * 3 ;
+
+            _rr[_ii] = inball2d (
+                _pp + _ti[0] * 2, _pp + _ti[1] * 2,
+                _pp + _ti[2] * 2, _pp + _qq[_ii] * 2) ;
+        }
+    }
+
+    __normal_call void inball2d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __const_ptr(INDX_TYPE) _tt ,
+      __const_ptr(INDX_TYPE) _qq ,
+      __write_ptr(REAL_TYPE) _rr ,
+        batch_pool &_pool
+        )
+    {
+    /*------------ inball2d predicate, "threaded" xy + tri */
+        _pool.parallel_for(_nn, BATCH_GRAIN_SIZE,
+            [=] (size_t _i0, size_t _i1) {
+            inball2d_batch(_i1 - _i0, _pp,
+                _tt + _i0 * 3, _qq + _i0, _rr + _i0) ;
+            } ) ;
+    }
+
+    __normal_call void inball3d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __const_ptr(INDX_TYPE) _tt ,
+      __const_ptr(INDX_TYPE) _qq ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ inball3d predicate, "batched" xyz + tet */
+        for (size_t _ii = +0; _ii < _nn; ++_ii)
+        {
+            __const_ptr(INDX_TYPE) _ti = _tt + _ii * 4 ;
+
+            _rr[_ii] = inball3d (
+                _pp + _ti[0] * 3, _pp + _ti[1] * 3,
+                _pp + _ti[2] * 3, _pp + _ti[3] * 3,
+                _pp + _qq[_ii] * 3) ;
+        }
+    }
+
+    __normal_call void inball3d_batch (
+        size_t     _nn ,
+      __const_ptr(REAL_TYPE) _pp ,
+      __const_ptr(INDX_TYPE) _tt ,
+      __const_ptr(INDX_TYPE) _qq ,
+      __write_ptr(REAL_TYPE) _rr ,
+        batch_pool &_pool
+        )
+    {
+    /*------------ inball3d predicate, "threaded" xyz + tet */
+        _pool.parallel_for(_nn, BATCH_GRAIN_SIZE,
+            [=] (size_t _i0, size_t _i1) {
+            inball3d_batch(_i1 - _i0, _pp,
+                _tt + _i0 * 4, _qq + _i0, _rr + _i0) ;
+            } ) ;
+    }
+
+
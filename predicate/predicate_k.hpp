@@ -72,7 +72,11 @@
 #   define __PREDICATE_K__
 
 #   define USE_KERNEL_FLTPOINT
-//  define USE_KERNEL_INTERVAL
+#   define USE_KERNEL_INTERVAL
+#   define USE_KERNEL_ADAPTIVE
+
+//  define USE_KERNEL_INTEGRAL      // opt-in "grid" stage
+//  define USE_KERNEL_DDFLOAT       // opt-in "ddflt" stage
 
     namespace geompred {
 
@@ -83,23 +87,232 @@
 
     enum _kernel {
     ORIENT2D_f, ORIENT2D_i, ORIENT2D_e ,
+    ORIENT2D_s, ORIENT2D_z, ORIENT2D_d,
     ORIENT3D_f, ORIENT3D_i, ORIENT3D_e ,
+    ORIENT3D_s, ORIENT3D_p, ORIENT3D_z, ORIENT3D_d,
+    ORIENT4D_f, ORIENT4D_i, ORIENT4D_e ,
+    ORIENT4D_a, ORIENT4D_d,
     BISECT2D_f, BISECT2D_i, BISECT2D_e ,
+    BISECT2D_d,
     BISECT2W_f, BISECT2W_i, BISECT2W_e ,
+    BISECT2W_d,
     BISECT3D_f, BISECT3D_i, BISECT3D_e ,
+    BISECT3D_d,
     BISECT3W_f, BISECT3W_i, BISECT3W_e ,
+    BISECT3W_d,
+    SEGSEG2D_f, SEGSEG2D_i, SEGSEG2D_e ,
+    SEGSEG2D_d,
+    SEGTRI3D_f, SEGTRI3D_i, SEGTRI3D_e ,
+    SEGTRI3D_d,
+    RAYTRI3D_f, RAYTRI3D_i, RAYTRI3D_e ,
+    RAYTRI3D_d,
+    LOCATE2D_f, LOCATE2D_i, LOCATE2D_e ,
+    LOCATE2D_d,
+    LOCATE3D_f, LOCATE3D_i, LOCATE3D_e ,
+    LOCATE3D_d,
+    EXPRSIGN_f, EXPRSIGN_i, EXPRSIGN_e ,
     INBALL2D_f, INBALL2D_i, INBALL2D_e ,
+    INBALL2D_s, INBALL2D_z, INBALL2D_d,
     INBALL2W_f, INBALL2W_i, INBALL2W_e ,
+    INBALL2W_d,
     INBALL3D_f, INBALL3D_i, INBALL3D_e ,
+    INBALL3D_a, INBALL3D_s, INBALL3D_p, INBALL3D_d,
     INBALL3W_f, INBALL3W_i, INBALL3W_e ,
+    INBALL3W_d,
+    INBALL4D_f, INBALL4D_i, INBALL4D_e ,
+    INBALL4D_a, INBALL4D_d,
+    INBALL4W_f, INBALL4W_i, INBALL4W_e ,
+    INBALL4W_a, INBALL4W_d,
+    CIRCUM2D_f, CIRCUM2D_d, CIRCUM2D_e ,
+    CIRCUM2W_f, CIRCUM2W_d, CIRCUM2W_e ,
+    CIRCUM3D_f, CIRCUM3D_d, CIRCUM3D_e ,
+    CIRCUM3W_f, CIRCUM3W_d, CIRCUM3W_e ,
+    LINEPL3D_f, LINEPL3D_d, LINEPL3D_e ,
     LASTKERNEL } ;
 
-    size_t _nn_calls[LASTKERNEL] = {0} ;
+    /*
+    --------------------------------------------------------
+     * KERNEL-STATS: per-thread kernel call counters.
+    --------------------------------------------------------
+     *
+     * Each thread updates its own block of counters, so
+     * the filtered predicates never share a cache-line.
+     * Counts are only aggregated on demand, via
+     *
+     *   kernel_counts _cc = kernel_stats::snapshot();
+     *   kernel_stats::reset();
+     *
+     * or locally through kernel_stats::local().counts().
+     * Counts from threads that have exited are retained.
+     * Define NO_KERNEL_COUNTERS to compile counting out.
+     *
+    --------------------------------------------------------
+     */
+
+    class kernel_counts
+    {
+/*-------------- a (plain) snapshot of the kernel counts */
+    public  :
+    size_t                     _nn_calls [LASTKERNEL] = {0} ;
+
+    public  :
+    __inline_call size_t      & operator[] (
+        INDX_TYPE  _kk
+        )
+    {   return this->_nn_calls[_kk] ;
+    }
+    __inline_call size_t const& operator[] (
+        INDX_TYPE  _kk
+        ) const
+    {   return this->_nn_calls[_kk] ;
+    }
+
+    __inline_call void merge (
+        kernel_counts const& _cc
+        )
+    {
+        for (INDX_TYPE _kk = +0; _kk < LASTKERNEL; ++_kk)
+            this->_nn_calls[_kk] += _cc._nn_calls[_kk] ;
+    }
+
+    __inline_call void reset (
+        )
+    {
+        for (INDX_TYPE _kk = +0; _kk < LASTKERNEL; ++_kk)
+            this->_nn_calls[_kk]  = +0 ;
+    }
+    } ;
+
+    class kernel_stats
+    {
+/*-------------- thread-local counters, global registry */
+    public  :
+    std::atomic<size_t>        _nn_calls [LASTKERNEL] ;
+
+    public  :
+    class registry
+    {
+    public  :
+        std::mutex                  _lock ;
+        std::vector<kernel_stats *> _live ;
+        kernel_counts               _dead ;
+    } ;
+
+    __inline_call static registry& global (
+        )
+    {   static registry _rr; return _rr ;
+    }
+
+    __inline_call static kernel_stats& local (
+        )
+    {   thread_local kernel_stats _ss; return _ss ;
+    }
+
+    public  :
+/*------------------------------ register with all threads */
+    __inline_call kernel_stats (
+        )
+    {
+        for (INDX_TYPE _kk = +0; _kk < LASTKERNEL; ++_kk)
+            this->_nn_calls[_kk].store(
+                +0, std::memory_order_relaxed) ;
+
+        registry &_rr = global() ;
+        std::lock_guard<std::mutex> _lk(_rr._lock) ;
+        _rr._live.push_back(this) ;
+    }
+
+/*------------------------------ retire counts on exiting */
+    __inline_call~kernel_stats (
+        )
+    {
+        registry &_rr = global() ;
+        std::lock_guard<std::mutex> _lk(_rr._lock) ;
+        _rr._dead.merge(this->counts()) ;
+        _rr._live.erase(std::find(
+            _rr._live.begin(),
+            _rr._live.end  (), this)) ;
+    }
+
+/*------------------------------ bump a counter: no RMW's */
+    __inline_call void tick (
+        INDX_TYPE  _kk,
+        size_t     _nn = +1
+        )
+    {   // single writer, so a relaxed load/store is enough
+        this->_nn_calls[_kk].store(
+        this->_nn_calls[_kk].load(
+            std::memory_order_relaxed) + _nn,
+            std::memory_order_relaxed) ;
+    }
+
+/*------------------------------ counts for "this" thread */
+    __inline_call kernel_counts counts (
+        ) const
+    {
+        kernel_counts _cc;
+        for (INDX_TYPE _kk = +0; _kk < LASTKERNEL; ++_kk)
+            _cc._nn_calls[_kk] =
+                this->_nn_calls[_kk].load(
+                    std::memory_order_relaxed) ;
+        return _cc ;
+    }
+
+/*------------------------------ sum counts, all threads */
+    __inline_call static kernel_counts snapshot (
+        )
+    {
+        registry &_rr = global() ;
+        std::lock_guard<std::mutex> _lk(_rr._lock) ;
+
+        kernel_counts _cc = _rr._dead ;
+        for (auto _ss : _rr._live)
+            _cc.merge(_ss->counts()) ;
+        return _cc ;
+    }
+
+/*------------------------------ zero counts, all threads */
+    __inline_call static void reset (
+        )
+    {   // racing ticks from busy threads may survive reset
+        registry &_rr = global() ;
+        std::lock_guard<std::mutex> _lk(_rr._lock) ;
+
+        _rr._dead.reset() ;
+        for (auto _ss : _rr._live)
+        for (INDX_TYPE _kk = +0; _kk < LASTKERNEL; ++_kk)
+            _ss->_nn_calls[_kk].store(
+                +0, std::memory_order_relaxed) ;
+    }
+    } ;
+
+#   ifdef  NO_KERNEL_COUNTERS
+#   define __kernel_tick(_kk)
+#   define __kernel_tock(_kk, _nn)
+#   else
+#   define __kernel_tick(_kk) \
+        kernel_stats::local().tick(_kk)
+#   define __kernel_tock(_kk, _nn) \
+        kernel_stats::local().tick(_kk, _nn)
+#   endif
+
+    /*
+    --------------------------------------------------------
+     * "ddflt" kernels: each op. on dd_flt carries relative
+     * error <= 8 * u^2, with u = mp::_epsilon, see [4].
+    --------------------------------------------------------
+     */
+
+    REAL_TYPE constexpr _dd_eps =
+        + 8. * mp::_epsilon * mp::_epsilon ;
 
 #   include "orient_k.hpp"
 #   include "bisect_k.hpp"
-//  include "linear_k.hpp"
+#   include "linear_k.hpp"
 #   include "inball_k.hpp"
+#   include "integer_k.hpp"
+#   include "expr_k.hpp"
+#   include "construct_k.hpp"
 
     __inline_call REAL_TYPE orient2d (
       __const_ptr(REAL_TYPE) _pa ,
@@ -111,8 +324,18 @@
         REAL_TYPE _rr;
         bool_type _OK;
 
+    #   ifdef USE_KERNEL_INTEGRAL
+        __kernel_tick(ORIENT2D_z);
+
+        _rr = orient2d_z(               // "grid" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[ORIENT2D_f] += +1;
+        __kernel_tick(ORIENT2D_f);
 
         _rr = orient2d_f(               // "float" kernel
             _pa, _pb, _pc, _OK
@@ -123,7 +346,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[ORIENT2D_i] += +1;
+        __kernel_tick(ORIENT2D_i);
 
         _rr = orient2d_i(               // "bound" kernel
             _pa, _pb, _pc, _OK
@@ -132,7 +355,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[ORIENT2D_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(ORIENT2D_d);
+
+        _rr = orient2d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(ORIENT2D_e);
 
         _rr = orient2d_e(               // "exact" kernel
             _pa, _pb, _pc, _OK
@@ -154,8 +387,18 @@
         REAL_TYPE _rr;
         bool_type _OK;
 
+    #   ifdef USE_KERNEL_INTEGRAL
+        __kernel_tick(ORIENT3D_z);
+
+        _rr = orient3d_z(               // "grid" kernel
+            _pa, _pb, _pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[ORIENT3D_f] += +1;
+        __kernel_tick(ORIENT3D_f);
 
         _rr = orient3d_f(               // "float" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -166,7 +409,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[ORIENT3D_i] += +1;
+        __kernel_tick(ORIENT3D_i);
 
         _rr = orient3d_i(               // "bound" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -175,7 +418,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[ORIENT3D_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(ORIENT3D_d);
+
+        _rr = orient3d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(ORIENT3D_e);
 
         _rr = orient3d_e(               // "exact" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -186,6 +439,70 @@
         return (REAL_TYPE) +0.0E+00;
     }
 
+    __inline_call REAL_TYPE orient4d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe
+        )
+    {
+    /*------------ orient4d predicate, "filtered" version */
+        REAL_TYPE _rr;
+        bool_type _OK;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(ORIENT4D_f);
+
+        _rr = orient4d_f(               // "float" kernel
+            _pa, _pb, _pc, _pd, _pe, _OK
+            ) ;
+
+        if (_OK && std::isnormal(_rr))
+            return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(ORIENT4D_i);
+
+        _rr = orient4d_i(               // "bound" kernel
+            _pa, _pb, _pc, _pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(ORIENT4D_d);
+
+        _rr = orient4d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_ADAPTIVE
+        __kernel_tick(ORIENT4D_a);
+
+        _rr = orient4d_a(               // "adapt" kernel
+            _pa, _pb, _pc, _pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(ORIENT4D_e);
+
+        _rr = orient4d_e(               // "exact" kernel
+            _pa, _pb, _pc, _pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+
+        return (REAL_TYPE) +0.0E+00;
+    }
+
     __inline_call REAL_TYPE bisect2d (
       __const_ptr(REAL_TYPE) _pa ,
       __const_ptr(REAL_TYPE) _pb ,
@@ -197,7 +514,7 @@
         bool_type _OK;
 
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[BISECT2D_f] += +1;
+        __kernel_tick(BISECT2D_f);
 
         _rr = bisect2d_f(               // "float" kernel
             _pa, _pb, _pc, _OK
@@ -208,7 +525,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[BISECT2D_i] += +1;
+        __kernel_tick(BISECT2D_i);
 
         _rr = bisect2d_i(               // "bound" kernel
             _pa, _pb, _pc, _OK
@@ -217,7 +534,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[BISECT2D_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(BISECT2D_d);
+
+        _rr = bisect2d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(BISECT2D_e);
 
         _rr = bisect2d_e(               // "exact" kernel
             _pa, _pb, _pc, _OK
@@ -245,7 +572,7 @@
         bool_type _OK;
 
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[BISECT2W_f] += +1;
+        __kernel_tick(BISECT2W_f);
 
         _rr = bisect2w_f(               // "float" kernel
             _pa, _pb, _pc, _OK
@@ -256,7 +583,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[BISECT2W_i] += +1;
+        __kernel_tick(BISECT2W_i);
 
         _rr = bisect2w_i(               // "bound" kernel
             _pa, _pb, _pc, _OK
@@ -265,7 +592,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[BISECT2W_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(BISECT2W_d);
+
+        _rr = bisect2w_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(BISECT2W_e);
 
         _rr = bisect2w_e(               // "exact" kernel
             _pa, _pb, _pc, _OK
@@ -288,7 +625,7 @@
         bool_type _OK;
 
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[BISECT3D_f] += +1;
+        __kernel_tick(BISECT3D_f);
 
         _rr = bisect3d_f(               // "float" kernel
             _pa, _pb, _pc, _OK
@@ -299,7 +636,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[BISECT3D_i] += +1;
+        __kernel_tick(BISECT3D_i);
 
         _rr = bisect3d_i(               // "bound" kernel
             _pa, _pb, _pc, _OK
@@ -308,7 +645,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[BISECT3D_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(BISECT3D_d);
+
+        _rr = bisect3d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(BISECT3D_e);
 
         _rr = bisect3d_e(               // "exact" kernel
             _pa, _pb, _pc, _OK
@@ -336,7 +683,7 @@
         bool_type _OK;
 
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[BISECT3W_f] += +1;
+        __kernel_tick(BISECT3W_f);
 
         _rr = bisect3w_f(               // "float" kernel
             _pa, _pb, _pc, _OK
@@ -347,7 +694,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[BISECT3W_i] += +1;
+        __kernel_tick(BISECT3W_i);
 
         _rr = bisect3w_i(               // "bound" kernel
             _pa, _pb, _pc, _OK
@@ -356,7 +703,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[BISECT3W_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(BISECT3W_d);
+
+        _rr = bisect3w_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(BISECT3W_e);
 
         _rr = bisect3w_e(               // "exact" kernel
             _pa, _pb, _pc, _OK
@@ -379,8 +736,18 @@
         REAL_TYPE _rr;
         bool_type _OK;
 
+    #   ifdef USE_KERNEL_INTEGRAL
+        __kernel_tick(INBALL2D_z);
+
+        _rr = inball2d_z(               // "grid" kernel
+            _pa, _pb, _pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[INBALL2D_f] += +1;
+        __kernel_tick(INBALL2D_f);
 
         _rr = inball2d_f(               // "float" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -391,7 +758,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[INBALL2D_i] += +1;
+        __kernel_tick(INBALL2D_i);
 
         _rr = inball2d_i(               // "bound" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -400,7 +767,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[INBALL2D_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(INBALL2D_d);
+
+        _rr = inball2d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(INBALL2D_e);
 
         _rr = inball2d_e(               // "exact" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -433,7 +810,7 @@
         bool_type _OK;
 
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[INBALL2W_f] += +1;
+        __kernel_tick(INBALL2W_f);
 
         _rr = inball2w_f(               // "float" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -444,7 +821,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[INBALL2W_i] += +1;
+        __kernel_tick(INBALL2W_i);
 
         _rr = inball2w_i(               // "bound" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -453,7 +830,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[INBALL2W_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(INBALL2W_d);
+
+        _rr = inball2w_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(INBALL2W_e);
 
         _rr = inball2w_e(               // "exact" kernel
             _pa, _pb, _pc, _pd, _OK
@@ -478,7 +865,7 @@
         bool_type _OK;
 
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[INBALL3D_f] += +1;
+        __kernel_tick(INBALL3D_f);
 
         _rr = inball3d_f(               // "float" kernel
             _pa, _pb, _pc, _pd, _pe, _OK
@@ -489,7 +876,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[INBALL3D_i] += +1;
+        __kernel_tick(INBALL3D_i);
 
         _rr = inball3d_i(               // "bound" kernel
             _pa, _pb, _pc, _pd, _pe, _OK
@@ -498,7 +885,27 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[INBALL3D_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(INBALL3D_d);
+
+        _rr = inball3d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_ADAPTIVE
+        __kernel_tick(INBALL3D_a);
+
+        _rr = inball3d_a(               // "adapt" kernel
+            _pa, _pb, _pc, _pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(INBALL3D_e);
 
         _rr = inball3d_e(               // "exact" kernel
             _pa, _pb, _pc, _pd, _pe, _OK
@@ -533,7 +940,7 @@
         bool_type _OK;
 
     #   ifdef USE_KERNEL_FLTPOINT
-        _nn_calls[INBALL3W_f] += +1;
+        __kernel_tick(INBALL3W_f);
 
         _rr = inball3w_f(               // "float" kernal
             _pa, _pb, _pc, _pd, _pe, _OK
@@ -544,7 +951,7 @@
     #   endif
 
     #   ifdef USE_KERNEL_INTERVAL
-        _nn_calls[INBALL3D_i] += +1;
+        __kernel_tick(INBALL3W_i);
 
         _rr = inball3w_i(               // "bound" kernel
             _pa, _pb, _pc, _pd, _pe, _OK
@@ -553,7 +960,17 @@
         if (_OK) return _rr ;
     #   endif
 
-        _nn_calls[INBALL3W_e] += +1;
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(INBALL3W_d);
+
+        _rr = inball3w_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(INBALL3W_e);
 
         _rr = inball3w_e(               // "exact" kernel
             _pa, _pb, _pc, _pd, _pe, _OK
@@ -565,11 +982,283 @@
         }
     }
 
+    __inline_call REAL_TYPE inball4d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf
+        )
+    {
+    /*------------ inball4d predicate, "filtered" version */
+        REAL_TYPE _rr;
+        bool_type _OK;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(INBALL4D_f);
+
+        _rr = inball4d_f(               // "float" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK && std::isnormal(_rr))
+            return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(INBALL4D_i);
+
+        _rr = inball4d_i(               // "bound" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(INBALL4D_d);
+
+        _rr = inball4d_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_ADAPTIVE
+        __kernel_tick(INBALL4D_a);
+
+        _rr = inball4d_a(               // "adapt" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(INBALL4D_e);
+
+        _rr = inball4d_e(               // "exact" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+
+        return (REAL_TYPE) +0.0E+00;
+    }
+
+    __inline_call REAL_TYPE inball4w (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __const_ptr(REAL_TYPE) _pf
+        )
+    {
+    /*------------ inball4w predicate, "filtered" version */
+        if (_pa [ 4] == _pb [ 4] &&
+            _pb [ 4] == _pc [ 4] &&
+            _pc [ 4] == _pd [ 4] &&
+            _pd [ 4] == _pe [ 4] &&
+            _pe [ 4] == _pf [ 4] )
+        {
+        return inball4d (   // equal weights, do inball4d
+            _pa, _pb, _pc, _pd, _pe, _pf
+            ) ;
+        }
+        else
+        {
+        REAL_TYPE _rr;      // given weights, full kernel
+        bool_type _OK;
+
+    #   ifdef USE_KERNEL_FLTPOINT
+        __kernel_tick(INBALL4W_f);
+
+        _rr = inball4w_f(               // "float" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK && std::isnormal(_rr))
+            return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(INBALL4W_i);
+
+        _rr = inball4w_i(               // "bound" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(INBALL4W_d);
+
+        _rr = inball4w_d(               // "ddflt" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_ADAPTIVE
+        __kernel_tick(INBALL4W_a);
+
+        _rr = inball4w_a(               // "adapt" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(INBALL4W_e);
+
+        _rr = inball4w_e(               // "exact" kernel
+            _pa, _pb, _pc, _pd, _pe, _pf, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+
+        return (REAL_TYPE) +0.0E+00;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * integer coordinates: exact on grid, or as reals
+    --------------------------------------------------------
+     */
+
+    template <
+    typename  IT, size_t ND
+             >
+    __inline_call void grid_to_real (
+      __const_ptr(IT)        _pz ,
+      __write_ptr(REAL_TYPE) _pp
+        )
+    {
+        for (size_t _ii = +0; _ii < ND; ++_ii)
+        {
+            _pp[_ii] = (REAL_TYPE) _pz[_ii] ;   // exact
+        }
+    }
+
+    template <
+    typename  IT
+             >
+    __inline_call typename std::enable_if <
+        is_grid_type<IT>::value, REAL_TYPE>::type
+        orient2d (
+      __const_ptr(IT)        _pa ,
+      __const_ptr(IT)        _pb ,
+      __const_ptr(IT)        _pc
+        )
+    {
+    /*------------ orient2d predicate, "integer" version */
+        if (grid_range(2, _pa) &&
+            grid_range(2, _pb) &&
+            grid_range(2, _pc) )
+        {
+        __kernel_tick(ORIENT2D_z);
+
+        return orient2d_z(_pa, _pb, _pc) ;
+        }
+
+        REAL_TYPE _ra[2], _rb[2], _rc[2] ;
+        grid_to_real<IT, 2>(_pa, _ra) ;
+        grid_to_real<IT, 2>(_pb, _rb) ;
+        grid_to_real<IT, 2>(_pc, _rc) ;
+
+        return orient2d(_ra, _rb, _rc) ;
+    }
+
+    template <
+    typename  IT
+             >
+    __inline_call typename std::enable_if <
+        is_grid_type<IT>::value, REAL_TYPE>::type
+        orient3d (
+      __const_ptr(IT)        _pa ,
+      __const_ptr(IT)        _pb ,
+      __const_ptr(IT)        _pc ,
+      __const_ptr(IT)        _pd
+        )
+    {
+    /*------------ orient3d predicate, "integer" version */
+    #   ifdef  HAS_KERNEL_INT128
+        if (grid_range(3, _pa) &&
+            grid_range(3, _pb) &&
+            grid_range(3, _pc) &&
+            grid_range(3, _pd) )
+        {
+        __kernel_tick(ORIENT3D_z);
+
+        return orient3d_z(_pa, _pb, _pc, _pd) ;
+        }
+    #   endif
+
+        REAL_TYPE _ra[3], _rb[3], _rc[3], _rd[3] ;
+        grid_to_real<IT, 3>(_pa, _ra) ;
+        grid_to_real<IT, 3>(_pb, _rb) ;
+        grid_to_real<IT, 3>(_pc, _rc) ;
+        grid_to_real<IT, 3>(_pd, _rd) ;
+
+        return orient3d(_ra, _rb, _rc, _rd) ;
+    }
+
+    template <
+    typename  IT
+             >
+    __inline_call typename std::enable_if <
+        is_grid_type<IT>::value, REAL_TYPE>::type
+        inball2d (
+      __const_ptr(IT)        _pa ,
+      __const_ptr(IT)        _pb ,
+      __const_ptr(IT)        _pc ,
+      __const_ptr(IT)        _pd
+        )
+    {
+    /*------------ inball2d predicate, "integer" version */
+    #   ifdef  HAS_KERNEL_INT128
+        if (grid_range(2, _pa) &&
+            grid_range(2, _pb) &&
+            grid_range(2, _pc) &&
+            grid_range(2, _pd) )
+        {
+        __kernel_tick(INBALL2D_z);
+
+        return inball2d_z(_pa, _pb, _pc, _pd) ;
+        }
+    #   endif
+
+        REAL_TYPE _ra[2], _rb[2], _rc[2], _rd[2] ;
+        grid_to_real<IT, 2>(_pa, _ra) ;
+        grid_to_real<IT, 2>(_pb, _rb) ;
+        grid_to_real<IT, 2>(_pc, _rc) ;
+        grid_to_real<IT, 2>(_pd, _rd) ;
+
+        return inball2d(_ra, _rb, _rc, _rd) ;
+    }
+
+#   include "batch_k.hpp"
+#   include "static_k.hpp"
+#   include "prepare_k.hpp"
+#   include "perturb_k.hpp"
+#   include "pool_k.hpp"
+
 #   undef REAL_TYPE
 #   undef INDX_TYPE
 
 #   undef USE_KERNEL_FLTPOINT
 #   undef USE_KERNEL_INTERVAL
+#   undef USE_KERNEL_ADAPTIVE
+#   undef USE_KERNEL_DDFLOAT
+#   undef USE_KERNEL_INTEGRAL
+
+#   undef __kernel_tick
+#   undef __kernel_tock
 
     }
 
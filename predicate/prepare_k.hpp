@@ -0,0 +1,780 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 16 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Prepared predicates, for many queries against one
+     * fixed simplex.
+     *
+     * The float filter is translated about a vertex of the
+     * simplex (rather than the query), so that it becomes
+     * linear in the (lifted) query point: S = Q' * C, with
+     * cofactors C formed once from the simplex. This is a
+     * cofactor expansion along the query row, so its tree
+     * (and hence its rounding) differs from that of the
+     * unprepared "float" kernel, and each bound is derived
+     * for its own tree below: if at most k roundings lie
+     * on any path from a coord. to S, |fl(S) - S| <= g_k
+     * * P, with g_k = k * u / (1 - k * u) and P the
+     * "permanent" of S, formed alongside it from abs.
+     * values. Results |S| > FT = ER * P are then
+     * certified, with ER padded to cover g_k and the
+     * roundings in FT itself.
+     *
+     * Otherwise, the usual interval/adaptive kernels are
+     * run, and the exact kernel reuses the minors of the
+     * simplex, formed lazily on the first exact query. As
+     * this cache is filled on demand, prepared objects are
+     * not safe to query concurrently from multiple threads.
+     *
+    --------------------------------------------------------
+     */
+
+    class orient3d_prepared
+    {
+/*-------------- orient3d for many points vs. a fixed tri */
+    public  :
+    typedef REAL_TYPE           real_type;
+    typedef INDX_TYPE           indx_type;
+
+    real_type                  _pa [3] ;
+    real_type                  _pb [3] ;
+    real_type                  _pc [3] ;
+
+    real_type                  _nx, _ny, _nz ;
+    real_type                  _NX, _NY, _NZ ;
+
+/*------------------------------ exact minors, lazy init. */
+    bool_type                  _exact = false ;
+
+    mp::expansion< 12>         _d3_yz1, _d3_xz1,
+                               _d3_xy1;
+    mp::expansion< 24>         _d3_xyz;
+
+    public  :
+/*------------------------------ is prepared result good? */
+    __inline_call static bool_type pass (
+        real_type  _sgn ,
+        real_type  _FT
+        )
+    {   return (_sgn > +_FT || _sgn < -_FT)
+               && std::isnormal(_sgn) ;
+    }
+
+    public  :
+/*------------------------------ form plane normal at PC */
+    __inline_call orient3d_prepared (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc
+        )
+    {
+        for (indx_type _ii = +0; _ii < +3; ++_ii)
+        {
+            this->_pa[_ii] = _pa[_ii] ;
+            this->_pb[_ii] = _pb[_ii] ;
+            this->_pc[_ii] = _pc[_ii] ;
+        }
+
+        real_type _acx, _acy, _acz ,
+                  _bcx, _bcy, _bcz ;
+
+        _acx = _pa [0] - _pc [0] ;        // coord. diff.
+        _acy = _pa [1] - _pc [1] ;
+        _acz = _pa [2] - _pc [2] ;
+
+        _bcx = _pb [0] - _pc [0] ;
+        _bcy = _pb [1] - _pc [1] ;
+        _bcz = _pb [2] - _pc [2] ;
+
+    /*------------------------------ normal (B-C) x (A-C) */
+        real_type _bcyacz = _bcy * _acz ,
+                  _bczacy = _bcz * _acy ,
+                  _bczacx = _bcz * _acx ,
+                  _bcxacz = _bcx * _acz ,
+                  _bcxacy = _bcx * _acy ,
+                  _bcyacx = _bcy * _acx ;
+
+        this->_nx = _bcyacz - _bczacy ;
+        this->_ny = _bczacx - _bcxacz ;
+        this->_nz = _bcxacy - _bcyacx ;
+
+        this->_NX =
+            std::abs(_bcyacz) + std::abs(_bczacy) ;
+        this->_NY =
+            std::abs(_bczacx) + std::abs(_bcxacz) ;
+        this->_NZ =
+            std::abs(_bcxacy) + std::abs(_bcyacx) ;
+    }
+
+/*------------------------------ "prepared" float filter */
+    __inline_call real_type orient3d_p (
+      __const_ptr(REAL_TYPE) _pd ,
+        bool_type &_OK
+        ) const
+    {
+    /*--------------- orient3d predicate, "prep." version */
+
+    // roundings along the worst path of this tree: coord.
+    // diff. 1, products 3, normal terms 4, DC * N 6, and
+    // the 3-term sum 8. With P also formed in float, ER
+    // must be >= g_8 / (1 - g_8) / (1 - u), which is
+    // ~8 * u + 144 * u^2.
+        real_type constexpr _ER =
+        +    8. * mp::_epsilon
+        +  256. * mp::_epsilon * mp::_epsilon ;
+
+        real_type _dcx, _dcy, _dcz ;
+        real_type _sgn, _FT ;
+
+        _dcx = _pd [0] - this->_pc [0] ;  // coord. diff.
+        _dcy = _pd [1] - this->_pc [1] ;
+        _dcz = _pd [2] - this->_pc [2] ;
+
+        _sgn =                            // 3 x 3 result
+          _dcx * this->_nx
+        + _dcy * this->_ny
+        + _dcz * this->_nz ;
+
+        _FT  =
+          std::abs(_dcx) * this->_NX
+        + std::abs(_dcy) * this->_NY
+        + std::abs(_dcz) * this->_NZ ;
+
+        _FT *= _ER ;
+
+        _OK = pass(_sgn, _FT) ;
+
+        return ( _sgn ) ;
+    }
+
+/*------------------------------ fill exact minors of tri */
+    __normal_call void prepare_exact (
+        )
+    {
+        mp::expansion< 4 > _d2_ab_, _d2_ac_,
+                           _d2_bc_;
+
+        mp::expansion< 1 > _pa_zz_(this->_pa[ 2]);
+        mp::expansion< 1 > _pb_zz_(this->_pb[ 2]);
+        mp::expansion< 1 > _pc_zz_(this->_pc[ 2]);
+
+    /*-------------------------------------- (y,z) minors */
+        compute_det_2x2(this->_pa[ 1], this->_pa[ 2],
+                        this->_pb[ 1], this->_pb[ 2],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(this->_pa[ 1], this->_pa[ 2],
+                        this->_pc[ 1], this->_pc[ 2],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(this->_pb[ 1], this->_pb[ 2],
+                        this->_pc[ 1], this->_pc[ 2],
+                        _d2_bc_ ) ;
+
+        unitary_det_3x3(_d2_bc_, _d2_ac_,
+                        _d2_ab_,
+                        this->_d3_yz1, +3) ;
+
+    /*-------------------------------------- (x,z) minors */
+        compute_det_2x2(this->_pa[ 0], this->_pa[ 2],
+                        this->_pb[ 0], this->_pb[ 2],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(this->_pa[ 0], this->_pa[ 2],
+                        this->_pc[ 0], this->_pc[ 2],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(this->_pb[ 0], this->_pb[ 2],
+                        this->_pc[ 0], this->_pc[ 2],
+                        _d2_bc_ ) ;
+
+        unitary_det_3x3(_d2_bc_, _d2_ac_,
+                        _d2_ab_,
+                        this->_d3_xz1, +3) ;
+
+    /*-------------------------------------- (x,y) minors */
+        compute_det_2x2(this->_pa[ 0], this->_pa[ 1],
+                        this->_pb[ 0], this->_pb[ 1],
+                        _d2_ab_ ) ;
+
+        compute_det_2x2(this->_pa[ 0], this->_pa[ 1],
+                        this->_pc[ 0], this->_pc[ 1],
+                        _d2_ac_ ) ;
+
+        compute_det_2x2(this->_pb[ 0], this->_pb[ 1],
+                        this->_pc[ 0], this->_pc[ 1],
+                        _d2_bc_ ) ;
+
+        unitary_det_3x3(_d2_bc_, _d2_ac_,
+                        _d2_ab_,
+                        this->_d3_xy1, +3) ;
+
+        compute_det_3x3(_d2_bc_, _pa_zz_,
+                        _d2_ac_, _pb_zz_,
+                        _d2_ab_, _pc_zz_,
+                        this->_d3_xyz, +3) ;
+
+        this->_exact = true ;
+    }
+
+/*------------------------------ "prepared" exact version */
+    __normal_call real_type orient3d_e (
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ad[3], _bd[3], _cd[3] ;
+        if (mp::translate_exact<3>(this->_pa, _pd, _ad) &&
+            mp::translate_exact<3>(this->_pb, _pd, _bd) &&
+            mp::translate_exact<3>(this->_pc, _pd, _cd) )
+        {
+            return orient3d_t(_ad, _bd, _cd) ;
+        }
+
+        if (!this->_exact) prepare_exact() ;
+
+        mp::expansion< 24> _dx_yz1, _dy_xz1,
+                           _dz_xy1;
+        mp::expansion< 48> _sum_1 , _sum_2 ;
+
+    /*-------------------------------------- D * minors  */
+        mp::expansion_mul(
+            this->_d3_yz1, _pd[ 0], _dx_yz1) ;
+        mp::expansion_mul(
+            this->_d3_xz1, _pd[ 1], _dy_xz1) ;
+        mp::expansion_mul(
+            this->_d3_xy1, _pd[ 2], _dz_xy1) ;
+
+    /*-------------------------------------- 4 x 4 result */
+        mp::expansion_sub(_dy_xz1, _dx_yz1, _sum_1) ;
+        mp::expansion_sub(
+            this->_d3_xyz, _dz_xy1, _sum_2) ;
+
+        return (REAL_TYPE)
+            mp::expansion_add_sgn(_sum_1, _sum_2) ;
+    }
+
+    public  :
+/*------------------------------ orient3d, prepared first */
+    __inline_call real_type orient3d (
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+        real_type _rr;
+        bool_type _OK;
+
+        __kernel_tick(ORIENT3D_p);
+
+        _rr = orient3d_p(_pd, _OK) ;    // "prep." kernel
+
+        if (_OK) return _rr ;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(ORIENT3D_i);
+
+        _rr = orient3d_i(               // "bound" kernel
+            this->_pa, this->_pb,
+            this->_pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(ORIENT3D_d);
+
+        _rr = orient3d_d(               // "ddflt" kernel
+            this->_pa, this->_pb,
+            this->_pc, _pd, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(ORIENT3D_e);
+
+        return orient3d_e(_pd) ;        // "exact" kernel
+    }
+    } ;
+
+    class inball3d_prepared
+    {
+/*-------------- inball3d for many points vs. a fixed tet */
+    public  :
+    typedef REAL_TYPE           real_type;
+    typedef INDX_TYPE           indx_type;
+
+    real_type                  _pa [3] ;
+    real_type                  _pb [3] ;
+    real_type                  _pc [3] ;
+    real_type                  _pd [3] ;
+
+    real_type                  _cx, _cy, _cz, _cl ;
+    real_type                  _CX, _CY, _CZ, _CL ;
+
+/*------------------------------ exact minors, lazy init. */
+    bool_type                  _exact = false ;
+
+    mp::expansion< 6 >         _a_lift, _b_lift,
+                               _c_lift, _d_lift;
+    mp::expansion< 4 >         _d2_ab_, _d2_ac_,
+                               _d2_ad_,
+                               _d2_bc_, _d2_bd_,
+                               _d2_cd_;
+    mp::expansion< 24>         _d3_abc, _d3_abd,
+                               _d3_acd,
+                               _d3_bcd;
+    mp::expansion< 96>         _d4abcd;
+
+    public  :
+/*------------------------------ is prepared result good? */
+    __inline_call static bool_type pass (
+        real_type  _sgn ,
+        real_type  _FT
+        )
+    {   return (_sgn > +_FT || _sgn < -_FT)
+               && std::isnormal(_sgn) ;
+    }
+
+/*------------------------------ 3 x 3 det., + permanent */
+    __inline_call static void cofactor (
+        real_type  _ua, real_type  _va, real_type  _wa,
+        real_type  _ub, real_type  _vb, real_type  _wb,
+        real_type  _uc, real_type  _vc, real_type  _wc,
+        real_type &_det,
+        real_type &_per
+        )
+    {
+        real_type _ubvc = _ub * _vc, _vbuc = _vb * _uc ;
+        real_type _uavc = _ua * _vc, _vauc = _va * _uc ;
+        real_type _uavb = _ua * _vb, _vaub = _va * _ub ;
+
+        _det =
+          _wa * (_ubvc - _vbuc)
+        - _wb * (_uavc - _vauc)
+        + _wc * (_uavb - _vaub) ;
+
+        _per =
+          std::abs(_wa) * (
+          std::abs(_ubvc) + std::abs(_vbuc))
+        + std::abs(_wb) * (
+          std::abs(_uavc) + std::abs(_vauc))
+        + std::abs(_wc) * (
+          std::abs(_uavb) + std::abs(_vaub)) ;
+    }
+
+    public  :
+/*------------------------------ form cofactors about PD */
+    __inline_call inball3d_prepared (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        )
+    {
+        for (indx_type _ii = +0; _ii < +3; ++_ii)
+        {
+            this->_pa[_ii] = _pa[_ii] ;
+            this->_pb[_ii] = _pb[_ii] ;
+            this->_pc[_ii] = _pc[_ii] ;
+            this->_pd[_ii] = _pd[_ii] ;
+        }
+
+        real_type _adx, _ady, _adz, _adl ,
+                  _bdx, _bdy, _bdz, _bdl ,
+                  _cdx, _cdy, _cdz, _cdl ;
+
+        _adx = _pa [0] - _pd [0] ;        // coord. diff.
+        _ady = _pa [1] - _pd [1] ;
+        _adz = _pa [2] - _pd [2] ;
+
+        _bdx = _pb [0] - _pd [0] ;
+        _bdy = _pb [1] - _pd [1] ;
+        _bdz = _pb [2] - _pd [2] ;
+
+        _cdx = _pc [0] - _pd [0] ;
+        _cdy = _pc [1] - _pd [1] ;
+        _cdz = _pc [2] - _pd [2] ;
+
+        _adl = _adx * _adx + _ady * _ady  // lifted terms
+             + _adz * _adz ;
+        _bdl = _bdx * _bdx + _bdy * _bdy
+             + _bdz * _bdz ;
+        _cdl = _cdx * _cdx + _cdy * _cdy
+             + _cdz * _cdz ;
+
+    /*------------------------------ cofactors of row E-D */
+        cofactor(_ady, _adz, _adl,
+                 _bdy, _bdz, _bdl,
+                 _cdy, _cdz, _cdl,
+                 this->_cx, this->_CX) ;
+
+        cofactor(_adx, _adz, _adl,
+                 _bdx, _bdz, _bdl,
+                 _cdx, _cdz, _cdl,
+                 this->_cy, this->_CY) ;
+
+        cofactor(_adx, _ady, _adl,
+                 _bdx, _bdy, _bdl,
+                 _cdx, _cdy, _cdl,
+                 this->_cz, this->_CZ) ;
+
+        cofactor(_adx, _ady, _adz,
+                 _bdx, _bdy, _bdz,
+                 _cdx, _cdy, _cdz,
+                 this->_cl, this->_CL) ;
+
+        this->_cy = -this->_cy ;
+        this->_cl = -this->_cl ;
+    }
+
+/*------------------------------ "prepared" float filter */
+    __inline_call real_type inball3d_p (
+      __const_ptr(REAL_TYPE) _pe ,
+        bool_type &_OK
+        ) const
+    {
+    /*--------------- inball3d predicate, "prep." version */
+
+    // roundings along the worst path of this tree: coord.
+    // diff. 1, lifted terms 4, 2 x 2 minors 4, w * minor
+    // 9, 3-term sums 11 (the cofactors), ED * C 13, and
+    // the 4-term sum 16. With P also formed in float, ER
+    // must be >= g_16 / (1 - g_16) / (1 - u), which is
+    // ~16 * u + 544 * u^2 (cf. isperrboundA).
+        real_type constexpr _ER =
+        +   17. * mp::_epsilon
+        + 1024. * mp::_epsilon * mp::_epsilon ;
+
+        real_type _edx, _edy, _edz, _edl ;
+        real_type _sgn, _FT ;
+
+        _edx = _pe [0] - this->_pd [0] ;  // coord. diff.
+        _edy = _pe [1] - this->_pd [1] ;
+        _edz = _pe [2] - this->_pd [2] ;
+
+        _edl = _edx * _edx + _edy * _edy  // lifted terms
+             + _edz * _edz ;
+
+        _sgn =                            // 4 x 4 result
+          _edx * this->_cx
+        + _edy * this->_cy
+        + _edz * this->_cz
+        + _edl * this->_cl ;
+
+        _FT  =
+          std::abs(_edx) * this->_CX
+        + std::abs(_edy) * this->_CY
+        + std::abs(_edz) * this->_CZ
+        + _edl * this->_CL ;
+
+        _FT *= _ER ;
+
+        _OK = pass(_sgn, _FT) ;
+
+        return ( _sgn ) ;
+    }
+
+/*------------------------------ fill exact minors of tet */
+    __normal_call void prepare_exact (
+        )
+    {
+        mp::expansion< 1 > _pa_zz_(this->_pa[ 2]);
+        mp::expansion< 1 > _pb_zz_(this->_pb[ 2]);
+        mp::expansion< 1 > _pc_zz_(this->_pc[ 2]);
+        mp::expansion< 1 > _pd_zz_(this->_pd[ 2]);
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(this->_pa[ 0]),
+            mp::expansion_from_sqr(this->_pa[ 1]),
+            mp::expansion_from_sqr(this->_pa[ 2]),
+            this->_a_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(this->_pb[ 0]),
+            mp::expansion_from_sqr(this->_pb[ 1]),
+            mp::expansion_from_sqr(this->_pb[ 2]),
+            this->_b_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(this->_pc[ 0]),
+            mp::expansion_from_sqr(this->_pc[ 1]),
+            mp::expansion_from_sqr(this->_pc[ 2]),
+            this->_c_lift ) ;
+
+        mp::expansion_add(
+            mp::expansion_from_sqr(this->_pd[ 0]),
+            mp::expansion_from_sqr(this->_pd[ 1]),
+            mp::expansion_from_sqr(this->_pd[ 2]),
+            this->_d_lift ) ;
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(this->_pa[ 0], this->_pa[ 1],
+                        this->_pb[ 0], this->_pb[ 1],
+                        this->_d2_ab_ ) ;
+
+        compute_det_2x2(this->_pa[ 0], this->_pa[ 1],
+                        this->_pc[ 0], this->_pc[ 1],
+                        this->_d2_ac_ ) ;
+
+        compute_det_2x2(this->_pa[ 0], this->_pa[ 1],
+                        this->_pd[ 0], this->_pd[ 1],
+                        this->_d2_ad_ ) ;
+
+        compute_det_2x2(this->_pb[ 0], this->_pb[ 1],
+                        this->_pc[ 0], this->_pc[ 1],
+                        this->_d2_bc_ ) ;
+
+        compute_det_2x2(this->_pb[ 0], this->_pb[ 1],
+                        this->_pd[ 0], this->_pd[ 1],
+                        this->_d2_bd_ ) ;
+
+        compute_det_2x2(this->_pc[ 0], this->_pc[ 1],
+                        this->_pd[ 0], this->_pd[ 1],
+                        this->_d2_cd_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(this->_d2_bc_, _pa_zz_,
+                        this->_d2_ac_, _pb_zz_,
+                        this->_d2_ab_, _pc_zz_,
+                        this->_d3_abc, +3) ;
+
+        compute_det_3x3(this->_d2_bd_, _pa_zz_,
+                        this->_d2_ad_, _pb_zz_,
+                        this->_d2_ab_, _pd_zz_,
+                        this->_d3_abd, +3) ;
+
+        compute_det_3x3(this->_d2_cd_, _pa_zz_,
+                        this->_d2_ad_, _pc_zz_,
+                        this->_d2_ac_, _pd_zz_,
+                        this->_d3_acd, +3) ;
+
+        compute_det_3x3(this->_d2_cd_, _pb_zz_,
+                        this->_d2_bd_, _pc_zz_,
+                        this->_d2_bc_, _pd_zz_,
+                        this->_d3_bcd, +3) ;
+
+    /*-------------------------------------- 4 x 4 minors */
+        unitary_det_4x4(this->_d3_bcd, this->_d3_acd,
+                        this->_d3_abd, this->_d3_abc,
+                        this->_d4abcd, +4) ;
+
+        this->_exact = true ;
+    }
+
+/*------------------------------ "prepared" exact version */
+    __normal_call real_type inball3d_e (
+      __const_ptr(REAL_TYPE) _pe
+        )
+    {
+    /*-------------------------------------- translate ? */
+        REAL_TYPE _ae[3], _be[3], _ce[3], _de[3] ;
+        if (mp::translate_exact<3>(this->_pa, _pe, _ae) &&
+            mp::translate_exact<3>(this->_pb, _pe, _be) &&
+            mp::translate_exact<3>(this->_pc, _pe, _ce) &&
+            mp::translate_exact<3>(this->_pd, _pe, _de) )
+        {
+            return inball3d_t(_ae, _be, _ce, _de) ;
+        }
+
+        if (!this->_exact) prepare_exact() ;
+
+        mp::expansion< 6 > _e_lift;
+        mp::expansion< 4 > _d2_ae_, _d2_be_,
+                           _d2_ce_, _d2_de_;
+        mp::expansion< 24> _d3_abe, _d3_ace,
+                           _d3_ade,
+                           _d3_bce, _d3_bde,
+                           _d3_cde;
+        mp::expansion< 96> _d4abce, _d4abde,
+                           _d4acde,
+                           _d4bcde;
+
+        mp::expansion< 1 > _pa_zz_(this->_pa[ 2]);
+        mp::expansion< 1 > _pb_zz_(this->_pb[ 2]);
+        mp::expansion< 1 > _pc_zz_(this->_pc[ 2]);
+        mp::expansion< 1 > _pd_zz_(this->_pd[ 2]);
+        mp::expansion< 1 > _pe_zz_(_pe[ 2]);
+
+    /*-------------------------------------- lifted terms */
+        mp::expansion_add(
+            mp::expansion_from_sqr(_pe[ 0]),
+            mp::expansion_from_sqr(_pe[ 1]),
+            mp::expansion_from_sqr(_pe[ 2]),
+            _e_lift ) ;
+
+    /*-------------------------------------- 2 x 2 minors */
+        compute_det_2x2(this->_pa[ 0], this->_pa[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_ae_ ) ;
+
+        compute_det_2x2(this->_pb[ 0], this->_pb[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_be_ ) ;
+
+        compute_det_2x2(this->_pc[ 0], this->_pc[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_ce_ ) ;
+
+        compute_det_2x2(this->_pd[ 0], this->_pd[ 1],
+                        _pe[ 0], _pe[ 1],
+                        _d2_de_ ) ;
+
+    /*-------------------------------------- 3 x 3 minors */
+        compute_det_3x3(_d2_be_, _pa_zz_,
+                        _d2_ae_, _pb_zz_,
+                        this->_d2_ab_, _pe_zz_,
+                        _d3_abe, +3) ;
+
+        compute_det_3x3(_d2_ce_, _pa_zz_,
+                        _d2_ae_, _pc_zz_,
+                        this->_d2_ac_, _pe_zz_,
+                        _d3_ace, +3) ;
+
+        compute_det_3x3(_d2_de_, _pa_zz_,
+                        _d2_ae_, _pd_zz_,
+                        this->_d2_ad_, _pe_zz_,
+                        _d3_ade, +3) ;
+
+        compute_det_3x3(_d2_ce_, _pb_zz_,
+                        _d2_be_, _pc_zz_,
+                        this->_d2_bc_, _pe_zz_,
+                        _d3_bce, +3) ;
+
+        compute_det_3x3(_d2_de_, _pb_zz_,
+                        _d2_be_, _pd_zz_,
+                        this->_d2_bd_, _pe_zz_,
+                        _d3_bde, +3) ;
+
+        compute_det_3x3(_d2_de_, _pc_zz_,
+                        _d2_ce_, _pd_zz_,
+                        this->_d2_cd_, _pe_zz_,
+                        _d3_cde, +3) ;
+
+    /*-------------------------------------- 4 x 4 minors */
+        unitary_det_4x4(_d3_cde, _d3_bde,
+                        _d3_bce, this->_d3_bcd,
+                        _d4bcde, +4) ;
+
+        unitary_det_4x4(_d3_cde, _d3_ade,
+                        _d3_ace, this->_d3_acd,
+                        _d4acde, +4) ;
+
+        unitary_det_4x4(_d3_bde, _d3_ade,
+                        _d3_abe, this->_d3_abd,
+                        _d4abde, +4) ;
+
+        unitary_det_4x4(_d3_bce, _d3_ace,
+                        _d3_abe, this->_d3_abc,
+                        _d4abce, +4) ;
+
+    /*-------------------------------------- 5 x 5 result */
+        return (REAL_TYPE)
+        compute_sgn_5x5(_d4bcde, this->_a_lift,
+                        _d4acde, this->_b_lift,
+                        _d4abde, this->_c_lift,
+                        _d4abce, this->_d_lift,
+                        this->_d4abcd, _e_lift,
+                        +4) ;
+    }
+
+    public  :
+/*------------------------------ inball3d, prepared first */
+    __inline_call real_type inball3d (
+      __const_ptr(REAL_TYPE) _pe
+        )
+    {
+        real_type _rr;
+        bool_type _OK;
+
+        __kernel_tick(INBALL3D_p);
+
+        _rr = inball3d_p(_pe, _OK) ;    // "prep." kernel
+
+        if (_OK) return _rr ;
+
+    #   ifdef USE_KERNEL_INTERVAL
+        __kernel_tick(INBALL3D_i);
+
+        _rr = inball3d_i(               // "bound" kernel
+            this->_pa, this->_pb,
+            this->_pc, this->_pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_DDFLOAT
+        __kernel_tick(INBALL3D_d);
+
+        _rr = inball3d_d(               // "ddflt" kernel
+            this->_pa, this->_pb,
+            this->_pc, this->_pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+    #   ifdef USE_KERNEL_ADAPTIVE
+        __kernel_tick(INBALL3D_a);
+
+        _rr = inball3d_a(               // "adapt" kernel
+            this->_pa, this->_pb,
+            this->_pc, this->_pd, _pe, _OK
+            ) ;
+
+        if (_OK) return _rr ;
+    #   endif
+
+        __kernel_tick(INBALL3D_e);
+
+        return inball3d_e(_pe) ;        // "exact" kernel
+    }
+    } ;
+
+
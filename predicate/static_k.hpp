@@ -0,0 +1,345 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 16 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * de2363@columbia.edu
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+    // from predicate_k.hpp...
+
+    /*
+    --------------------------------------------------------
+     *
+     * Static filters, for inputs in a known bounding-box.
+     *
+     * The semi-static filters form a roundoff tolerance
+     * FT from the abs. values of each of the minors, etc.
+     * Given bounds on the inputs, the largest such FT can
+     * instead be precomputed once: every coord. diff. in
+     * the box satisfies |fl(a - b)| <= fl(hi - lo) as
+     * rounding is monotone, and FT is built from sums of
+     * products of non-negative terms, so the semi-static
+     * FT is never larger than the same expression of the
+     * box extents. Results |S| > FT are then certified
+     * without forming FT per call. Otherwise the existing
+     * (semi-static + exact) predicates are used.
+     *
+     * All points passed to a static_filter must lie in
+     * its box; this is NOT checked.
+     *
+    --------------------------------------------------------
+     */
+
+    class static_filter
+    {
+/*-------------- precomputed error bounds for a given box */
+    public  :
+    typedef REAL_TYPE           real_type;
+    typedef INDX_TYPE           indx_type;
+
+    real_type                  _ft_orient2d = +0. ;
+    real_type                  _ft_orient3d = +0. ;
+    real_type                  _ft_inball2d = +0. ;
+    real_type                  _ft_inball3d = +0. ;
+
+    indx_type                  _ndim ;
+
+    public  :
+/*------------------------------ is static result "good"? */
+    __inline_call static bool_type pass (
+        real_type  _sgn ,
+        real_type  _FT
+        )
+    {   return (_sgn > +_FT || _sgn < -_FT)
+               && std::isnormal(_sgn) ;
+    }
+
+    public  :
+/*------------------------------ form bounds for a bbox */
+    __inline_call static_filter (
+      __const_ptr(REAL_TYPE) _lo ,
+      __const_ptr(REAL_TYPE) _hi ,
+        indx_type  _nd = +3
+        )
+    {
+        assert ( (_nd == 2 || _nd == 3) &&
+            "static_filter: invalid dimension") ;
+
+        this->_ndim = _nd ;
+
+        real_type _DX, _DY, _DZ, _MM, _LL, _TT ;
+
+        _DX = _hi [0] - _lo [0] ;       // max. coord. diff.
+        _DY = _hi [1] - _lo [1] ;
+
+    /*------------------------------ orient2d / inball2d */
+        _MM = _DX * _DY + _DY * _DX ;
+
+        this->_ft_orient2d =
+            orient2d_er() * _MM ;
+
+        _LL = _DX * _DX + _DY * _DY ;
+
+        this->_ft_inball2d =
+            inball2d_er() * (
+            _LL * _MM + _LL * _MM + _LL * _MM) ;
+
+        if (_nd == +2) return ;
+
+    /*------------------------------ orient3d / inball3d */
+        _DZ = _hi [2] - _lo [2] ;
+
+        this->_ft_orient3d =
+            orient3d_er() * (
+            _DZ * _MM + _DZ * _MM + _DZ * _MM) ;
+
+        _LL = _DX * _DX + _DY * _DY + _DZ * _DZ ;
+
+        _TT = _DZ * _MM + _DZ * _MM + _DZ * _MM ;
+
+        this->_ft_inball3d =
+            inball3d_er() * (
+            _LL * _TT + _LL * _TT +
+            _LL * _TT + _LL * _TT) ;
+    }
+
+/*------------------------------ rel. err. of each filter */
+    __inline_call static constexpr real_type orient2d_er (
+        )
+    {   return +  4. * mp::_epsilon ;
+    }
+    __inline_call static constexpr real_type orient3d_er (
+        )
+    {   return +  8. * mp::_epsilon ;
+    }
+    __inline_call static constexpr real_type inball2d_er (
+        )
+    {   return + 11. * mp::_epsilon ;
+    }
+    __inline_call static constexpr real_type inball3d_er (
+        )
+    {   return + 17. * mp::_epsilon ;
+    }
+
+    public  :
+/*------------------------------ orient2d, "static" first */
+    __inline_call real_type orient2d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc
+        ) const
+    {
+        real_type _acx, _acy, _bcx, _bcy, _sgn ;
+
+        __kernel_tick(ORIENT2D_s);
+
+        _acx = _pa [0] - _pc [0] ;        // coord. diff.
+        _acy = _pa [1] - _pc [1] ;
+
+        _bcx = _pb [0] - _pc [0] ;
+        _bcy = _pb [1] - _pc [1] ;
+
+        _sgn = _acx * _bcy - _acy * _bcx ;
+
+        if (pass(_sgn, this->_ft_orient2d))
+            return _sgn ;
+
+        return geompred::orient2d(_pa, _pb, _pc) ;
+    }
+
+/*------------------------------ orient3d, "static" first */
+    __inline_call real_type orient3d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        ) const
+    {
+        assert ( this->_ndim == 3 &&
+            "static_filter: box is not 3-dim.") ;
+
+        real_type _adx, _ady, _adz ,
+                  _bdx, _bdy, _bdz ,
+                  _cdx, _cdy, _cdz , _sgn ;
+
+        __kernel_tick(ORIENT3D_s);
+
+        _adx = _pa [0] - _pd [0] ;        // coord. diff.
+        _ady = _pa [1] - _pd [1] ;
+        _adz = _pa [2] - _pd [2] ;
+
+        _bdx = _pb [0] - _pd [0] ;
+        _bdy = _pb [1] - _pd [1] ;
+        _bdz = _pb [2] - _pd [2] ;
+
+        _cdx = _pc [0] - _pd [0] ;
+        _cdy = _pc [1] - _pd [1] ;
+        _cdz = _pc [2] - _pd [2] ;
+
+        _sgn =                            // 3 x 3 result
+          _adz * (_bdx * _cdy - _cdx * _bdy)
+        + _bdz * (_cdx * _ady - _adx * _cdy)
+        + _cdz * (_adx * _bdy - _bdx * _ady) ;
+
+        if (pass(_sgn, this->_ft_orient3d))
+            return _sgn ;
+
+        return geompred::orient3d(_pa, _pb, _pc, _pd) ;
+    }
+
+/*------------------------------ inball2d, "static" first */
+    __inline_call real_type inball2d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd
+        ) const
+    {
+        real_type _adx, _ady, _ali ,
+                  _bdx, _bdy, _bli ,
+                  _cdx, _cdy, _cli , _d33 ;
+
+        __kernel_tick(INBALL2D_s);
+
+        _adx = _pa [0] - _pd [0] ;        // coord. diff.
+        _ady = _pa [1] - _pd [1] ;
+
+        _bdx = _pb [0] - _pd [0] ;
+        _bdy = _pb [1] - _pd [1] ;
+
+        _cdx = _pc [0] - _pd [0] ;
+        _cdy = _pc [1] - _pd [1] ;
+
+        _ali = _adx * _adx + _ady * _ady; // lifted terms
+        _bli = _bdx * _bdx + _bdy * _bdy;
+        _cli = _cdx * _cdx + _cdy * _cdy;
+
+        _d33 =                            // 3 x 3 result
+          _ali * (_bdx * _cdy - _cdx * _bdy)
+        + _bli * (_cdx * _ady - _adx * _cdy)
+        + _cli * (_adx * _bdy - _bdx * _ady) ;
+
+        if (pass(_d33, this->_ft_inball2d))
+            return _d33 ;
+
+        return geompred::inball2d(_pa, _pb, _pc, _pd) ;
+    }
+
+/*------------------------------ inball3d, "static" first */
+    __inline_call real_type inball3d (
+      __const_ptr(REAL_TYPE) _pa ,
+      __const_ptr(REAL_TYPE) _pb ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __const_ptr(REAL_TYPE) _pe
+        ) const
+    {
+        assert ( this->_ndim == 3 &&
+            "static_filter: box is not 3-dim.") ;
+
+        real_type _aex, _aey, _aez, _ali ,
+                  _bex, _bey, _bez, _bli ,
+                  _cex, _cey, _cez, _cli ,
+                  _dex, _dey, _dez, _dli ;
+        real_type _ab_, _bc_, _cd_, _da_,
+                  _ac_, _bd_;
+        real_type _abc, _bcd, _cda, _dab;
+        real_type _d44 ;
+
+        __kernel_tick(INBALL3D_s);
+
+        _aex = _pa [0] - _pe [0] ;        // coord. diff.
+        _aey = _pa [1] - _pe [1] ;
+        _aez = _pa [2] - _pe [2] ;
+
+        _bex = _pb [0] - _pe [0] ;
+        _bey = _pb [1] - _pe [1] ;
+        _bez = _pb [2] - _pe [2] ;
+
+        _cex = _pc [0] - _pe [0] ;
+        _cey = _pc [1] - _pe [1] ;
+        _cez = _pc [2] - _pe [2] ;
+
+        _dex = _pd [0] - _pe [0] ;
+        _dey = _pd [1] - _pe [1] ;
+        _dez = _pd [2] - _pe [2] ;
+
+        _ali = _aex * _aex + _aey * _aey  // lifted terms
+             + _aez * _aez ;
+        _bli = _bex * _bex + _bey * _bey
+             + _bez * _bez ;
+        _cli = _cex * _cex + _cey * _cey
+             + _cez * _cez ;
+        _dli = _dex * _dex + _dey * _dey
+             + _dez * _dez ;
+
+        _ab_ = _aex * _bey - _bex * _aey ;// 2 x 2 minors
+        _bc_ = _bex * _cey - _cex * _bey ;
+        _cd_ = _cex * _dey - _dex * _cey ;
+        _da_ = _dex * _aey - _aex * _dey ;
+        _ac_ = _aex * _cey - _cex * _aey ;
+        _bd_ = _bex * _dey - _dex * _bey ;
+
+        _abc =                            // 3 x 3 minors
+          _aez * _bc_ - _bez * _ac_
+        + _cez * _ab_ ;
+        _bcd =
+          _bez * _cd_ - _cez * _bd_
+        + _dez * _bc_ ;
+        _cda =
+          _cez * _da_ + _dez * _ac_
+        + _aez * _cd_ ;
+        _dab =
+          _dez * _ab_ + _aez * _bd_
+        + _bez * _da_ ;
+
+        _d44 =                            // 4 x 4 result
+          _dli * _abc - _cli * _dab
+        + _bli * _cda - _ali * _bcd ;
+
+        if (pass(_d44, this->_ft_inball3d))
+            return _d44 ;
+
+        return geompred::inball3d(
+            _pa, _pb, _pc, _pd, _pe) ;
+    }
+
+    } ;
+
+
@@ -0,0 +1,1202 @@
+
+// g++ -std=c++17 -pedantic -Wall -O3 -DNDEBUG
+// regress.cpp -oregress
+
+// also build with -mfma (or -march=native) to check the
+// FMA variants of the "bound" kernels.
+
+// Regression checks for inputs on which the filtered
+// kernels have previously returned a wrong sign. Each
+// check prints its number of failures; the program
+// returns non-zero if any check fails.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#include "geompred.hpp"
+
+    std::mt19937_64 _rng(+1) ;
+
+    int _fail = +0 ;
+
+    void report (
+        char const *_name, int _nbad, int _nall
+        )
+    {
+        std::printf("%-28s %6d / %6d %s\n",
+            _name, _nbad, _nall,
+            _nbad == 0 ? "pass" : "FAIL") ;
+
+        if (_nbad != 0) _fail += +1 ;
+    }
+
+/*-------------------------------- corners of a rand. box */
+
+    void box_corners (
+        int _nd, int _np, double (*_pp)[6]
+        )
+    {
+    // np distinct corners of an axis-aligned box in E^nd,
+    // with dyadic offsets/extents so that all points are
+    // exactly cospherical. The last coord. is a weight,
+    // linear in the position, so weighted points are
+    // exactly ortho-cospherical too.
+
+        std::uniform_int_distribution<int> _oo(-64, +64) ;
+        std::uniform_int_distribution<int> _ll(+1 , +16) ;
+
+        double _xo[5], _xl[5], _ww[5];
+        for (int _id = 0; _id < _nd; ++_id)
+        {
+            _xo[_id] = _oo(_rng) * .125 ;
+            _xl[_id] = _ll(_rng) * .250 ;
+            _ww[_id] = _oo(_rng) * .500 ;
+        }
+
+        int _nc = 1 << _nd, _ic[32] ;
+        for (int _ii = 0; _ii < _nc; ++_ii)
+            _ic[_ii] = _ii ;
+
+        for (int _ii = 0; _ii < _np; ++_ii)
+        {
+            int _jj = _ii + (int)(_rng() % (_nc - _ii)) ;
+            std::swap(_ic[_ii], _ic[_jj]) ;
+
+            _pp[_ii][_nd] = +0. ;
+            for (int _id = 0; _id < _nd; ++_id)
+            {
+                _pp[_ii][_id] = _xo[_id] +
+                ((_ic[_ii] >> _id) & 1 ? _xl[_id] : 0.) ;
+
+                _pp[_ii][_nd] += _ww[_id] * _pp[_ii][_id] ;
+            }
+        }
+    }
+
+/*-------------------------------- exactly degen. inballs */
+
+    void check_degenerate (
+        int _nn
+        )
+    {
+        using namespace geompred ;
+
+        double _pp[6][6] ;
+        int _nbad[6] = {0}, _nint[6] = {0} ;
+
+        for (int _ii = 0; _ii < _nn; ++_ii)
+        {
+            bool_type _OK ; double _rr ;
+
+            box_corners(2, 4, _pp) ;
+            _nbad[0] += inball2d(
+                _pp[0], _pp[1], _pp[2], _pp[3]) != 0. ;
+            _nbad[1] += inball2w(
+                _pp[0], _pp[1], _pp[2], _pp[3]) != 0. ;
+
+            _rr = inball2d_i(
+                _pp[0], _pp[1], _pp[2], _pp[3], _OK) ;
+            _nint[0] += _OK && _rr != 0. ;
+            _rr = inball2w_i(
+                _pp[0], _pp[1], _pp[2], _pp[3], _OK) ;
+            _nint[1] += _OK && _rr != 0. ;
+
+            box_corners(3, 5, _pp) ;
+            _nbad[2] += inball3d(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4]) != 0. ;
+            _nbad[3] += inball3w(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4]) != 0. ;
+
+            _rr = inball3d_i(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _OK) ;
+            _nint[2] += _OK && _rr != 0. ;
+            _rr = inball3w_i(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _OK) ;
+            _nint[3] += _OK && _rr != 0. ;
+
+            box_corners(4, 6, _pp) ;
+            _nbad[4] += inball4d(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _pp[5]) != 0. ;
+            _nbad[5] += inball4w(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _pp[5]) != 0. ;
+
+            _rr = inball4d_i(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _pp[5], _OK) ;
+            _nint[4] += _OK && _rr != 0. ;
+            _rr = inball4w_i(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _pp[5], _OK) ;
+            _nint[5] += _OK && _rr != 0. ;
+        }
+
+        report("inball2d degenerate", _nbad[0], _nn) ;
+        report("inball2w degenerate", _nbad[1], _nn) ;
+        report("inball3d degenerate", _nbad[2], _nn) ;
+        report("inball3w degenerate", _nbad[3], _nn) ;
+        report("inball4d degenerate", _nbad[4], _nn) ;
+        report("inball4w degenerate", _nbad[5], _nn) ;
+
+        report("inball2d_i degenerate", _nint[0], _nn) ;
+        report("inball2w_i degenerate", _nint[1], _nn) ;
+        report("inball3d_i degenerate", _nint[2], _nn) ;
+        report("inball3w_i degenerate", _nint[3], _nn) ;
+        report("inball4d_i degenerate", _nint[4], _nn) ;
+        report("inball4w_i degenerate", _nint[5], _nn) ;
+    }
+
+/*-------------------------------- rand. pt. on a sphere */
+
+    void sphere_point (
+        double *_pc, double _rr, double *_pp
+        )
+    {
+        std::normal_distribution<double> _nd(0., 1.) ;
+
+        double _xx = _nd(_rng), _yy = _nd(_rng),
+               _zz = _nd(_rng) ;
+        double _ll = std::sqrt(
+            _xx * _xx + _yy * _yy + _zz * _zz) ;
+
+        _pp[0] = _pc[0] + _rr * _xx / _ll ;
+        _pp[1] = _pc[1] + _rr * _yy / _ll ;
+        _pp[2] = _pc[2] + _rr * _zz / _ll ;
+    }
+
+/*-------------------------------- near-cospherical tets */
+
+    void check_prepared_inball (
+        int _nn
+        )
+    {
+        using namespace geompred ;
+
+        std::uniform_real_distribution<double>
+            _uu(-1.E+3, +1.E+3) ;
+
+        int _nbad = +0, _nflt = +0 ;
+
+        for (int _ii = 0; _ii < _nn; ++_ii)
+        {
+            double _pc[3] = {
+                _uu(_rng), _uu(_rng), _uu(_rng) } ;
+
+            double _pp[5][3] ;
+            for (int _jj = 0; _jj < 5; ++_jj)
+                sphere_point(_pc, 1., _pp[_jj]) ;
+
+            inball3d_prepared _tet(
+                _pp[0], _pp[1], _pp[2], _pp[3]) ;
+
+            bool_type _OK ;
+            double _rx = inball3d_e(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _OK) ;
+
+            double _rp = _tet.inball3d_p(_pp[4], _OK) ;
+
+            if (_OK && (_rp > 0.) != (_rx > 0.))
+                _nflt += +1 ;
+
+            double _rr = _tet.inball3d(_pp[4]) ;
+
+            if ((_rr > 0.) != (_rx > 0.) ||
+                (_rr < 0.) != (_rx < 0.))
+                _nbad += +1 ;
+        }
+
+        report("inball3d_p near-cospherical", _nflt, _nn) ;
+        report("inball3d_prepared near-cosph.", _nbad, _nn) ;
+    }
+
+/*-------------------------------- adapt. stage, far away */
+
+    void check_adapt_inball (
+        int _nn
+        )
+    {
+    // small spheres far from the origin, so that the coord.
+    // diff. are inexact and the tails matter
+
+        using namespace geompred ;
+
+        std::uniform_real_distribution<double>
+            _uu(-1.E+6, +1.E+6) ;
+
+        int _nbad = +0 ;
+
+        for (int _ii = 0; _ii < _nn; ++_ii)
+        {
+            double _pc[3] = {
+                _uu(_rng), _uu(_rng), _uu(_rng) } ;
+
+            double _pp[5][3] ;
+            for (int _jj = 0; _jj < 5; ++_jj)
+                sphere_point(_pc, 1.E-6, _pp[_jj]) ;
+
+            bool_type _OK ;
+            double _rx = inball3d_e(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _OK) ;
+
+            double _ra = inball3d_a(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _pp[4], _OK) ;
+
+            if (_OK && ((_ra > 0.) != (_rx > 0.) ||
+                        (_ra < 0.) != (_rx < 0.)))
+                _nbad += +1 ;
+        }
+
+        report("inball3d_a near-cospherical", _nbad, _nn) ;
+    }
+
+/*-------------------------------- near-coplanar queries */
+
+    void check_prepared_orient (
+        int _nn
+        )
+    {
+        using namespace geompred ;
+
+        std::uniform_real_distribution<double>
+            _uu(-1.E+3, +1.E+3) ;
+        std::uniform_real_distribution<double>
+            _tt(-1.E+1, +1.E+1) ;
+
+        int _nbad = +0, _nflt = +0 ;
+
+        for (int _ii = 0; _ii < _nn; ++_ii)
+        {
+    // query is a rounded affine comb. of the tria., so is
+    // within a few ulp of its plane
+
+            double _pp[4][3] ;
+            for (int _jj = 0; _jj < 3; ++_jj)
+            for (int _id = 0; _id < 3; ++_id)
+                _pp[_jj][_id] = _uu(_rng) ;
+
+            double _s1 = _tt(_rng), _s2 = _tt(_rng) ;
+            for (int _id = 0; _id < 3; ++_id)
+                _pp[3][_id] = _pp[0][_id]
+                    + _s1 * (_pp[1][_id] - _pp[0][_id])
+                    + _s2 * (_pp[2][_id] - _pp[0][_id]) ;
+
+            orient3d_prepared _tri(
+                _pp[0], _pp[1], _pp[2]) ;
+
+            bool_type _OK ;
+            double _rx = orient3d_e(
+                _pp[0], _pp[1], _pp[2], _pp[3], _OK) ;
+
+            double _rp = _tri.orient3d_p(_pp[3], _OK) ;
+
+            if (_OK && (_rp > 0.) != (_rx > 0.))
+                _nflt += +1 ;
+
+            double _rr = _tri.orient3d(_pp[3]) ;
+
+            if ((_rr > 0.) != (_rx > 0.) ||
+                (_rr < 0.) != (_rx < 0.))
+                _nbad += +1 ;
+        }
+
+        report("orient3d_p near-coplanar", _nflt, _nn) ;
+        report("orient3d_prepared near-copl.", _nbad, _nn) ;
+    }
+
+/*-------------------------------- exact int. references */
+
+    typedef long long int_type ;
+
+    int_type sign_of (
+        int_type _xx
+        )
+    {   return (_xx > 0) - (_xx < 0) ;
+    }
+
+    int_type orient2i (         // (b-a) x (c-a)
+        int_type const *_pa, int_type const *_pb,
+        int_type const *_pc
+        )
+    {
+        return (_pb[0] - _pa[0]) * (_pc[1] - _pa[1])
+             - (_pb[1] - _pa[1]) * (_pc[0] - _pa[0]) ;
+    }
+
+    int_type orient3i (         // det(a-d, b-d, c-d)
+        int_type const *_pa, int_type const *_pb,
+        int_type const *_pc, int_type const *_pd
+        )
+    {
+        int_type _ad[3], _bd[3], _cd[3] ;
+        for (int _id = 0; _id < 3; ++_id)
+        {
+            _ad[_id] = _pa[_id] - _pd[_id] ;
+            _bd[_id] = _pb[_id] - _pd[_id] ;
+            _cd[_id] = _pc[_id] - _pd[_id] ;
+        }
+
+        return
+          _ad[0] * (_bd[1] * _cd[2] - _bd[2] * _cd[1])
+        - _ad[1] * (_bd[0] * _cd[2] - _bd[2] * _cd[0])
+        + _ad[2] * (_bd[0] * _cd[1] - _bd[1] * _cd[0]) ;
+    }
+
+    void cross3i (
+        int_type const *_uu, int_type const *_vv,
+        int_type *_ww
+        )
+    {
+        _ww[0] = _uu[1] * _vv[2] - _uu[2] * _vv[1] ;
+        _ww[1] = _uu[2] * _vv[0] - _uu[0] * _vv[2] ;
+        _ww[2] = _uu[0] * _vv[1] - _uu[1] * _vv[0] ;
+    }
+
+/*-------------------------------- pts. on a small lattice */
+
+    void lattice_pts (
+        int _nd, int _np, int_type (*_kk)[3],
+        double (*_pp)[6], double *_hs = nullptr
+        )
+    {
+    // lattice coord. k in [-2,+2], mapped to o + k * h,
+    // with a large offset o half of the time, so that the
+    // float filters fail and the later stages are used.
+    // Signs (and hence classes) follow those of k.
+
+        std::uniform_int_distribution<int> _ik(-2, +2) ;
+        std::uniform_int_distribution<int>
+            _io(-(1 << 20), +(1 << 20)) ;
+
+        bool_type _big = _rng() % 2 ;
+        double _oo[3], _hh = _big ?
+            std::ldexp(1., -20) : 1. ;
+        for (int _id = 0; _id < _nd; ++_id)
+            _oo[_id] = _big ? _io(_rng) : 0 ;
+
+        if (_hs != nullptr) *_hs = _hh ;
+
+        for (int _ii = 0; _ii < _np; ++_ii)
+        for (int _id = 0; _id < _nd; ++_id)
+        {
+            _kk[_ii][_id] = _ik(_rng) ;
+            _pp[_ii][_id] =
+                _oo[_id] + _kk[_ii][_id] * _hh ;
+        }
+    }
+
+/*-------------------------------- segseg2d, lattice pts. */
+
+    int segseg2i (
+        int_type const *_pa, int_type const *_pb,
+        int_type const *_pc, int_type const *_pd
+        )
+    {
+        using namespace geompred ;
+
+        int_type _ab[2] = {
+            _pb[0] - _pa[0], _pb[1] - _pa[1] } ;
+        int_type _cd[2] = {
+            _pd[0] - _pc[0], _pd[1] - _pc[1] } ;
+        int_type _ac[2] = {
+            _pc[0] - _pa[0], _pc[1] - _pa[1] } ;
+
+        int_type _dd = _ab[0] * _cd[1] - _ab[1] * _cd[0] ;
+
+        if (_dd != 0)
+        {
+    // a + t * ab = c + s * cd, with t = tn / dd, etc.
+            int_type _tn = _ac[0] * _cd[1] - _ac[1] * _cd[0] ;
+            int_type _sn = _ac[0] * _ab[1] - _ac[1] * _ab[0] ;
+            if (_dd < 0)
+            {
+                _dd = -_dd; _tn = -_tn; _sn = -_sn;
+            }
+
+            if (_tn < 0 || _tn > _dd ||
+                _sn < 0 || _sn > _dd)
+                return LINEAR_DISJOINT ;
+
+            return _tn > 0 && _tn < _dd &&
+                   _sn > 0 && _sn < _dd ?
+                LINEAR_CROSSING : LINEAR_TOUCHING ;
+        }
+
+    // parallel, or degenerate: project onto the line, if
+    // the pts. are all collinear at all
+        int_type const *_p0 = _pa, *_p1 = _pb ;
+        if (_ab[0] == 0 && _ab[1] == 0)
+        {
+            _p0 = _pc; _p1 = _pd;
+        }
+
+        int_type _uu[2] = {
+            _p1[0] - _p0[0], _p1[1] - _p0[1] } ;
+
+        if (_uu[0] == 0 && _uu[1] == 0)
+        {
+    // both segments are single pts.
+            return _pa[0] == _pc[0] && _pa[1] == _pc[1] ?
+                LINEAR_TOUCHING : LINEAR_DISJOINT ;
+        }
+
+        int_type const *_qq[4] = { _pa, _pb, _pc, _pd } ;
+        int_type _tt[4] ;
+        for (int _ii = 0; _ii < 4; ++_ii)
+        {
+            if (orient2i(_p0, _p1, _qq[_ii]) != 0)
+                return LINEAR_DISJOINT ;
+
+            _tt[_ii] =
+                (_qq[_ii][0] - _p0[0]) * _uu[0] +
+                (_qq[_ii][1] - _p0[1]) * _uu[1] ;
+        }
+
+        int_type _lo = std::max(
+            std::min(_tt[0], _tt[1]),
+            std::min(_tt[2], _tt[3])) ;
+        int_type _hi = std::min(
+            std::max(_tt[0], _tt[1]),
+            std::max(_tt[2], _tt[3])) ;
+
+        if (_lo >  _hi) return LINEAR_DISJOINT ;
+        if (_lo == _hi) return LINEAR_TOUCHING ;
+
+        return LINEAR_OVERLAPS ;
+    }
+
+/*-------------------------------- pt. P / D vs. tria. T  */
+
+    int pointtri3i (            // -1 out, 0 bnd., +1 in
+        int_type const *_pp, int_type _dd,
+        int_type const *_ta, int_type const *_tb,
+        int_type const *_tc
+        )
+    {
+    // the pt. P / D is in the plane of T, take the signs of
+    // n . (e_i x (p - t_i)), with n the normal of T
+        int_type const *_tt[3] = { _ta, _tb, _tc } ;
+
+        int_type _e1[3], _e2[3], _nn[3] ;
+        for (int _id = 0; _id < 3; ++_id)
+        {
+            _e1[_id] = _tb[_id] - _ta[_id] ;
+            _e2[_id] = _tc[_id] - _ta[_id] ;
+        }
+        cross3i(_e1, _e2, _nn) ;
+
+        int _nz = 0, _np = 0, _nm = 0 ;
+        for (int _ii = 0; _ii < 3; ++_ii)
+        {
+            int_type const *_t0 = _tt[_ii] ;
+            int_type const *_t1 = _tt[(_ii + 1) % 3] ;
+
+            int_type _ee[3], _pq[3], _ww[3] ;
+            for (int _id = 0; _id < 3; ++_id)
+            {
+                _ee[_id] = _t1[_id] - _t0[_id] ;
+                _pq[_id] = _pp[_id] - _dd * _t0[_id] ;
+            }
+            cross3i(_ee, _pq, _ww) ;
+
+            int_type _sg = sign_of(
+                _nn[0] * _ww[0] + _nn[1] * _ww[1] +
+                _nn[2] * _ww[2]) * sign_of(_dd) ;
+
+            _nz += _sg == 0 ;
+            _np += _sg >  0 ;
+            _nm += _sg <  0 ;
+        }
+
+        if (_np > 0 && _nm > 0) return -1 ;
+
+        return _nz > 0 ? 0 : +1 ;
+    }
+
+    bool_type flat_tria (
+        int_type const *_ta, int_type const *_tb,
+        int_type const *_tc
+        )
+    {
+        int_type _e1[3], _e2[3], _nn[3] ;
+        for (int _id = 0; _id < 3; ++_id)
+        {
+            _e1[_id] = _tb[_id] - _ta[_id] ;
+            _e2[_id] = _tc[_id] - _ta[_id] ;
+        }
+        cross3i(_e1, _e2, _nn) ;
+
+        return _nn[0] == 0 && _nn[1] == 0 && _nn[2] == 0 ;
+    }
+
+/*-------------------------------- segtri3d, lattice pts. */
+
+    int segtri3i (
+        int_type const *_pa, int_type const *_pb,
+        int_type const *_ta, int_type const *_tb,
+        int_type const *_tc
+        )
+    {
+        using namespace geompred ;
+
+        int_type _da = orient3i(_ta, _tb, _tc, _pa) ;
+        int_type _db = orient3i(_ta, _tb, _tc, _pb) ;
+
+        if (sign_of(_da) * sign_of(_db) > 0)
+            return LINEAR_DISJOINT ;
+
+        if (_da == 0 && _db == 0)
+        {
+    // coplanar: contact if an end-pt. is in T, or [a,b]
+    // meets an edge of T, tested via the 2d reference
+            for (int_type const *_pq : {_pa, _pb})
+            if (pointtri3i(_pq, 1, _ta, _tb, _tc) >= 0)
+                return LINEAR_OVERLAPS ;
+
+            int_type _nn[3], _e1[3], _e2[3] ;
+            for (int _id = 0; _id < 3; ++_id)
+            {
+                _e1[_id] = _tb[_id] - _ta[_id] ;
+                _e2[_id] = _tc[_id] - _ta[_id] ;
+            }
+            cross3i(_e1, _e2, _nn) ;
+
+            int _ix = 0 ;               // drop max. normal
+            for (int _id = 1; _id < 3; ++_id)
+            if (std::abs(_nn[_id]) > std::abs(_nn[_ix]))
+                _ix = _id ;
+
+            int_type _qq[5][2] ;
+            int_type const *_pt[5] = {
+                _pa, _pb, _ta, _tb, _tc } ;
+            for (int _ii = 0; _ii < 5; ++_ii)
+            {
+                _qq[_ii][0] = _pt[_ii][(_ix + 1) % 3] ;
+                _qq[_ii][1] = _pt[_ii][(_ix + 2) % 3] ;
+            }
+
+            for (int _ii = 0; _ii < 3; ++_ii)
+            if (segseg2i(_qq[0], _qq[1], _qq[2 + _ii],
+                    _qq[2 + (_ii + 1) % 3]) !=
+                        LINEAR_DISJOINT)
+                return LINEAR_OVERLAPS ;
+
+            return LINEAR_DISJOINT ;
+        }
+
+    // single hit pt. p = (b * da - a * db) / (da - db)
+        int_type _dd = _da - _db, _pp[3] ;
+        for (int _id = 0; _id < 3; ++_id)
+            _pp[_id] = _pb[_id] * _da - _pa[_id] * _db ;
+
+        int _in = pointtri3i(_pp, _dd, _ta, _tb, _tc) ;
+
+        if (_in < 0) return LINEAR_DISJOINT ;
+
+        return _in > 0 && _da != 0 && _db != 0 ?
+            LINEAR_CROSSING : LINEAR_TOUCHING ;
+    }
+
+/*-------------------------------- raytri3d, lattice pts. */
+
+    int raytri3i (
+        int_type const *_po, int_type const *_pq,
+        int_type const *_ta, int_type const *_tb,
+        int_type const *_tc
+        )
+    {
+        using namespace geompred ;
+
+        int_type _do = orient3i(_ta, _tb, _tc, _po) ;
+        int_type _dq = orient3i(_ta, _tb, _tc, _pq) ;
+
+        if (_do == _dq)                 // parallel to T
+            return _do == 0 ?
+                LINEAR_COPLANAR : LINEAR_DISJOINT ;
+
+    // hit at t = do / (do - dq) along o->q, need t >= 0
+        int_type _dd = _do - _dq ;
+        if (sign_of(_do) * sign_of(_dd) < 0)
+            return LINEAR_DISJOINT ;
+
+        int_type _pp[3] ;
+        for (int _id = 0; _id < 3; ++_id)
+            _pp[_id] = _pq[_id] * _do - _po[_id] * _dq ;
+
+        int _in = pointtri3i(_pp, _dd, _ta, _tb, _tc) ;
+
+        if (_in < 0) return LINEAR_DISJOINT ;
+
+        return _in > 0 && _do != 0 ?
+            LINEAR_CROSSING : LINEAR_TOUCHING ;
+    }
+
+/*-------------------------------- degenerate linear tests */
+
+    void check_linear (
+        int _nn
+        )
+    {
+        using namespace geompred ;
+
+        int _nbad[3] = {0} ;
+
+        for (int _ii = 0; _ii < _nn; ++_ii)
+        {
+            int_type _kk[5][3] ; double _pp[5][6] ;
+
+            lattice_pts(2, 4, _kk, _pp) ;
+            _nbad[0] += (int)segseg2d(
+                _pp[0], _pp[1], _pp[2], _pp[3]) !=
+                segseg2i(_kk[0], _kk[1], _kk[2], _kk[3]) ;
+
+            do lattice_pts(3, 5, _kk, _pp) ;
+            while (flat_tria(_kk[2], _kk[3], _kk[4])) ;
+
+            _nbad[1] += (int)segtri3d(
+                _pp[0], _pp[1], _pp[2], _pp[3], _pp[4]) !=
+                segtri3i(_kk[0], _kk[1],
+                         _kk[2], _kk[3], _kk[4]) ;
+
+            do lattice_pts(3, 5, _kk, _pp) ;
+            while (flat_tria(_kk[2], _kk[3], _kk[4]) ||
+                  (_kk[0][0] == _kk[1][0] &&
+                   _kk[0][1] == _kk[1][1] &&
+                   _kk[0][2] == _kk[1][2])) ;
+
+            _nbad[2] += (int)raytri3d(
+                _pp[0], _pp[1], _pp[2], _pp[3], _pp[4]) !=
+                raytri3i(_kk[0], _kk[1],
+                         _kk[2], _kk[3], _kk[4]) ;
+        }
+
+    // collinear pts. that are all equal along y, and were
+    // once compared along y (TOUCHING)
+        double _pa[2] = {+0., +1.}, _pc[2] = {-2., +1.} ;
+        _nbad[0] += segseg2d(_pa, _pa, _pc, _pc) !=
+            LINEAR_DISJOINT ;
+
+        report("segseg2d lattice", _nbad[0], _nn) ;
+        report("segtri3d lattice", _nbad[1], _nn) ;
+        report("raytri3d lattice", _nbad[2], _nn) ;
+    }
+
+/*-------------------------------- locate-kd, lattice pts. */
+
+    template <
+        size_t      NF
+             >
+    bool_type locate_bad (
+        int _lc, double const(&_ss) [NF],
+        int_type const(&_ri) [NF], int_type _rc
+        )
+    {
+        using namespace geompred ;
+
+    // the reference class: ri[i] is the cell volume with q
+    // in place of vertex i, compared to the volume rc
+        int _lr = LOCATE_INTERIOR ;
+        for (size_t _ii = 0; _ii < NF; ++_ii)
+        {
+            if (_ri[_ii] == 0)
+                _lr = std::min(_lr, (int)LOCATE_BOUNDARY) ;
+            else
+            if (sign_of(_ri[_ii]) != sign_of(_rc))
+                _lr = LOCATE_OUTSIDE ;
+        }
+
+        if (_lc != _lr) return true ;
+
+    // face signs: exact zeros, and consistent in sign with
+    // the reference, up to the kernel's sign convention
+        int_type _sr = 0 ;
+        for (size_t _ii = 0; _ii < NF; ++_ii)
+        {
+            if ((_ss[_ii] == 0.) != (_ri[_ii] == 0))
+                return true ;
+
+            if (_ri[_ii] == 0) continue ;
+
+            int_type _sx = sign_of(_ri[_ii]) *
+                (_ss[_ii] > 0. ? +1 : -1) ;
+
+            if (_sr != 0 && _sx != _sr) return true ;
+
+            _sr = _sx ;
+        }
+
+        return false ;
+    }
+
+    void check_locate (
+        int _nn
+        )
+    {
+        using namespace geompred ;
+
+        int _nbad[2] = {0} ;
+
+        for (int _ii = 0; _ii < _nn; ++_ii)
+        {
+            int_type _kk[5][3] ; double _pp[5][6] ;
+            int_type _rc ;
+
+            do lattice_pts(2, 4, _kk, _pp) ;
+            while ((_rc =
+                orient2i(_kk[1], _kk[2], _kk[3])) == 0) ;
+
+            double _s2[3] ;
+            int _l2 = locate2d(
+                _pp[0], _pp[1], _pp[2], _pp[3], _s2) ;
+
+            int_type _r2[3] = {
+                orient2i(_kk[0], _kk[2], _kk[3]),
+                orient2i(_kk[1], _kk[0], _kk[3]),
+                orient2i(_kk[1], _kk[2], _kk[0]) } ;
+
+            _nbad[0] += locate_bad(_l2, _s2, _r2, _rc) ;
+
+            do lattice_pts(3, 5, _kk, _pp) ;
+            while ((_rc = orient3i(
+                _kk[1], _kk[2], _kk[3], _kk[4])) == 0) ;
+
+            double _s3[4] ;
+            int _l3 = locate3d(_pp[0],
+                _pp[1], _pp[2], _pp[3], _pp[4], _s3) ;
+
+            int_type _r3[4] = {
+                orient3i(_kk[0], _kk[2], _kk[3], _kk[4]),
+                orient3i(_kk[1], _kk[0], _kk[3], _kk[4]),
+                orient3i(_kk[1], _kk[2], _kk[0], _kk[4]),
+                orient3i(_kk[1], _kk[2], _kk[3], _kk[0]) } ;
+
+            _nbad[1] += locate_bad(_l3, _s3, _r3, _rc) ;
+        }
+
+        report("locate2d lattice", _nbad[0], _nn) ;
+        report("locate3d lattice", _nbad[1], _nn) ;
+    }
+
+/*-------------------------------- SoS lift perturbation */
+
+    void check_sos_inball (
+        int _nn
+        )
+    {
+    // when inball3d is zero, inball3d_sos should match
+    // inball3w with weights w_i = -delta^(k+1), for pt. i
+    // of rank k in the index order (delta small enough).
+
+        using namespace geompred ;
+
+        double const _dl = std::ldexp(1., -40) ;
+
+        int _nbad = +0, _nall = +0 ;
+
+        for (int _ii = 0; _ii < _nn + 1; ++_ii)
+        {
+            double _pp[6][6] ; int _id[5] ;
+
+            if (_ii == _nn)
+            {
+    // apex over a cocircular square: C_0 vanishes
+
+                double const _pq[5][3] = {
+                    {+0., +0., +1.}, {+1., +0., +0.},
+                    {+0., +1., +0.}, {-1., +0., +0.},
+                    {+0., -1., +0.} } ;
+
+                for (int _jj = 0; _jj < 5; ++_jj)
+                {
+                    _pp[_jj][0] = _pq[_jj][0] ;
+                    _pp[_jj][1] = _pq[_jj][1] ;
+                    _pp[_jj][2] = _pq[_jj][2] ;
+                    _id[_jj] = _jj ;
+                }
+            }
+            else
+            {
+                box_corners(3, 5, _pp) ;
+
+                for (int _jj = 0; _jj < 5; ++_jj)
+                    _id[_jj] = _jj ;
+
+                std::shuffle(_id, _id + 5, _rng) ;
+            }
+
+            double _rr = inball3d_sos(
+                _pp[0], _pp[1], _pp[2], _pp[3], _pp[4],
+                _id[0], _id[1], _id[2], _id[3], _id[4]) ;
+
+            for (int _jj = 0; _jj < 5; ++_jj)
+                _pp[_jj][3] = -std::pow(_dl, _id[_jj] + 1) ;
+
+            double _rw = inball3w(
+                _pp[0], _pp[1], _pp[2], _pp[3], _pp[4]) ;
+
+            _nall += +1 ;
+            _nbad += _rw == 0. || (_rr > 0.) != (_rw > 0.) ;
+        }
+
+        report("inball3d_sos lift perturb.", _nbad, _nall) ;
+    }
+
+/*-------------------------------- exact int. determinant */
+
+    int_type det_i (
+        int _nr, int_type const (*_mm)[5],
+        int _cm = 0
+        )
+    {
+    // Laplace expansion along the first column not in the
+    // mask cm, over rows 0,...,nr-1 (nr small)
+        if (_nr == 0) return +1 ;
+
+        int _jc = 0 ;
+        while ((_cm >> _jc) & 1) ++_jc ;
+
+        int_type _dd = 0 ;
+        for (int _ir = 0; _ir < _nr; ++_ir)
+        {
+            if (_mm[_ir][_jc] == 0) continue ;
+
+            int_type _sm[5][5] ;
+            for (int _jr = 0, _kr = 0; _jr < _nr; ++_jr)
+            if (_jr != _ir)
+            {
+                for (int _kc = 0; _kc < 5; ++_kc)
+                    _sm[_kr][_kc] = _mm[_jr][_kc] ;
+                _kr += 1 ;
+            }
+
+            int_type _cf = _mm[_ir][_jc] *
+                det_i(_nr - 1, _sm, _cm | (1 << _jc)) ;
+
+            _dd += _ir % 2 == 0 ? _cf : -_cf ;
+        }
+        return _dd ;
+    }
+
+/*-------------------------------- orient-kd, eps-poly.   */
+
+    int_type orient_sos_i (
+        int _nd, int_type const (*_kk)[3],
+        int const *_rk
+        )
+    {
+    // det. of rows [p_i + eps_i, 1], with coord. j of the
+    // pt. of rank i (from 1) perturbed by eps^(2^(i*d-j)),
+    // expanded as a polynomial in eps: each monomial is a
+    // bit-mask of perturbations, whose value orders them.
+    // The sign is that of the least non-zero monomial.
+        int _nr = _nd + 1 ;
+
+        int_type _cf[1 << 12] = {0} ;
+
+        int _pm[4] = {0, 1, 2, 3} ;
+        do
+        {
+            int _sg = +1 ;                  // parity of pm
+            for (int _ii = 0; _ii < _nr; ++_ii)
+            for (int _jj = _ii + 1; _jj < _nr; ++_jj)
+                if (_pm[_ii] > _pm[_jj]) _sg = -_sg ;
+
+            for (int _ss = 0; _ss < (1 << _nr); ++_ss)
+            {
+                int_type _tt = _sg ; int _mk = 0 ;
+                for (int _ir = 0; _ir < _nr; ++_ir)
+                {
+                    int _jc = _pm[_ir] ;
+                    if ((_ss >> _ir) & 1)
+                    {
+                        if (_jc == _nd) { _tt = 0; break; }
+                        _mk |= 1 << (
+                            _rk[_ir] * _nd - (_jc + 1)) ;
+                    }
+                    else
+                    {
+                        _tt *= _jc == _nd ?
+                            1 : _kk[_ir][_jc] ;
+                    }
+                }
+                _cf[_mk] += _tt ;
+            }
+        }
+        while (std::next_permutation(_pm, _pm + _nr)) ;
+
+        for (int _mk = 0; _mk < (1 << 12); ++_mk)
+            if (_cf[_mk] != 0) return sign_of(_cf[_mk]) ;
+
+        return 0 ;
+    }
+
+/*-------------------------------- inball-kd, lift series */
+
+    int_type inball_sos_i (
+        int _nd, int_type const (*_kk)[3],
+        int_type const *_ww, int const *_rk
+        )
+    {
+    // det. of rows [p_i, |p_i|^2 - w_i + delta^(i+1), 1],
+    // with i the rank (from 0): D, then the cofactors C_i
+    // of the lifted column in rank order. Returns zero if
+    // they all vanish (pts. themselves degenerate).
+        int _nr = _nd + 2 ;
+
+        int_type _mm[5][5] = {{0}} ;
+        for (int _ir = 0; _ir < _nr; ++_ir)
+        {
+            _mm[_ir][_nd] = -_ww[_ir] ;
+            for (int _id = 0; _id < _nd; ++_id)
+            {
+                _mm[_ir][_id] = _kk[_ir][_id] ;
+                _mm[_ir][_nd] +=
+                    _kk[_ir][_id] * _kk[_ir][_id] ;
+            }
+            _mm[_ir][_nd + 1] = +1 ;
+        }
+
+        int_type _dd = det_i(_nr, _mm) ;
+        if (_dd != 0) return sign_of(_dd) ;
+
+        for (int _ik = 0; _ik < _nr; ++_ik)
+        {
+            int _ir = 0 ;
+            while (_rk[_ir] != _ik) ++_ir ;
+
+            int_type _sm[5][5] = {{0}} ;
+            for (int _jr = 0, _kr = 0; _jr < _nr; ++_jr)
+            if (_jr != _ir)
+            {
+                for (int _id = 0; _id < _nd; ++_id)
+                    _sm[_kr][_id] = _kk[_jr][_id] ;
+                _sm[_kr][_nd] = +1 ;
+                _kr += 1 ;
+            }
+
+            int_type _cc = det_i(_nr - 1, _sm) ;
+            if (_cc == 0) continue ;
+
+            return (_ir + _nd) % 2 == 0 ?
+                sign_of(_cc) : -sign_of(_cc) ;
+        }
+
+        return 0 ;
+    }
+
+/*-------------------------------- rand. distinct indices */
+
+    void sos_index (
+        int _np, int *_id, int *_rk
+        )
+    {
+        std::uniform_int_distribution<int> _ig(1, 8) ;
+
+        int _ix[6] = {0, 1, 2, 3, 4, 5} ;
+        std::shuffle(_ix, _ix + _np, _rng) ;
+
+        for (int _ii = 0, _iv = 0; _ii < _np; ++_ii)
+        {
+            _iv += _ig(_rng) ;              // with gaps
+            _id[_ix[_ii]] = _iv ;
+            _rk[_ix[_ii]] = _ii ;
+        }
+    }
+
+/*-------------------------------- orient-kd sos on grids */
+
+    void check_sos_orient (
+        int _nn
+        )
+    {
+    // lattice pts. are often collinear / coplanar: compare
+    // with the eps-polynomial, and check that swapping two
+    // (pt., index) pairs flips the (never zero) sign
+        using namespace geompred ;
+
+        int _nbad[4] = {0}, _ndeg[2] = {0} ;
+
+        for (int _ii = 0; _ii < _nn; ++_ii)
+        {
+            int_type _kk[5][3] ; double _pp[5][6] ;
+            int _id[5], _rk[5], _r1[5] ;
+
+            lattice_pts(2, 3, _kk, _pp) ;
+            sos_index(3, _id, _rk) ;
+            for (int _jj = 0; _jj < 3; ++_jj)
+                _r1[_jj] = _rk[_jj] + 1 ;
+
+            double _r2 = orient2d_sos(
+                _pp[0], _pp[1], _pp[2],
+                _id[0], _id[1], _id[2]) ;
+
+            _ndeg[0] += orient2d(
+                _pp[0], _pp[1], _pp[2]) == 0. ;
+
+            _nbad[0] += _r2 == 0. ||
+                sign_of(_r2 > 0. ? +1 : -1) !=
+                orient_sos_i(2, _kk, _r1) ;
+
+            _nbad[1] += (_r2 > 0.) == (orient2d_sos(
+                _pp[1], _pp[0], _pp[2],
+                _id[1], _id[0], _id[2]) > 0.) ;
+            _nbad[1] += (_r2 > 0.) == (orient2d_sos(
+                _pp[0], _pp[2], _pp[1],
+                _id[0], _id[2], _id[1]) > 0.) ;
+
+            lattice_pts(3, 4, _kk, _pp) ;
+            sos_index(4, _id, _rk) ;
+            for (int _jj = 0; _jj < 4; ++_jj)
+                _r1[_jj] = _rk[_jj] + 1 ;
+
+            double _r3 = orient3d_sos(
+                _pp[0], _pp[1], _pp[2], _pp[3],
+                _id[0], _id[1], _id[2], _id[3]) ;
+
+            _ndeg[1] += orient3d(
+                _pp[0], _pp[1], _pp[2], _pp[3]) == 0. ;
+
+            _nbad[2] += _r3 == 0. ||
+                sign_of(_r3 > 0. ? +1 : -1) !=
+                orient_sos_i(3, _kk, _r1) ;
+
+            _nbad[3] += (_r3 > 0.) == (orient3d_sos(
+                _pp[1], _pp[0], _pp[2], _pp[3],
+                _id[1], _id[0], _id[2], _id[3]) > 0.) ;
+            _nbad[3] += (_r3 > 0.) == (orient3d_sos(
+                _pp[0], _pp[1], _pp[3], _pp[2],
+                _id[0], _id[1], _id[3], _id[2]) > 0.) ;
+        }
+
+        report("orient2d_sos eps-poly.", _nbad[0], _nn) ;
+        report("orient2d_sos antisymmetry", _nbad[1], _nn) ;
+        report("orient3d_sos eps-poly.", _nbad[2], _nn) ;
+        report("orient3d_sos antisymmetry", _nbad[3], _nn) ;
+
+        std::printf("  (%d / %d and %d / %d collinear, "
+            "coplanar)\n", _ndeg[0], _nn, _ndeg[1], _nn) ;
+    }
+
+/*-------------------------------- inball-kd sos on grids */
+
+    void check_sos_lattice (
+        int _nn
+        )
+    {
+    // as above, vs. the lift series D, C_0, C_1, ... where
+    // that is non-zero, and antisymmetry throughout. The
+    // weighted pts. carry small int. weights, scaled with
+    // the lattice so that the signs follow those of k.
+        using namespace geompred ;
+
+        std::uniform_int_distribution<int> _iw(-2, +2) ;
+
+        int _nbad[6] = {0}, _nall[3] = {0} ;
+
+        for (int _ii = 0; _ii < _nn; ++_ii)
+        for (int _it = 0; _it < 3; ++_it)
+        {
+            int _nd = _it == 2 ? 3 : 2 ;
+            int _np = _nd + 2 ;
+
+            int_type _kk[5][3], _ww[5] = {0} ;
+            double _pp[5][6] ;
+            int _id[5], _rk[5] ;
+
+            double _hh ;
+            lattice_pts(_nd, _np, _kk, _pp, &_hh) ;
+            sos_index(_np, _id, _rk) ;
+
+            if (_it != 0)
+            for (int _jj = 0; _jj < _np; ++_jj)
+            {
+                _ww[_jj] = _iw(_rng) ;
+                _pp[_jj][_nd] = _ww[_jj] * _hh * _hh ;
+            }
+
+            auto _eval = [&](int _i0, int _i1)
+            {
+                int _ix[5] = {0, 1, 2, 3, 4} ;
+                std::swap(_ix[_i0], _ix[_i1]) ;
+
+                double const *_qq[5] ;
+                int _jd[5] ;
+                for (int _jj = 0; _jj < _np; ++_jj)
+                {
+                    _qq[_jj] = _pp[_ix[_jj]] ;
+                    _jd[_jj] = _id[_ix[_jj]] ;
+                }
+
+                if (_it == 0)
+                return inball2d_sos(
+                    _qq[0], _qq[1], _qq[2], _qq[3],
+                    _jd[0], _jd[1], _jd[2], _jd[3]) ;
+                else
+                if (_it == 1)
+                return inball2w_sos(
+                    _qq[0], _qq[1], _qq[2], _qq[3],
+                    _jd[0], _jd[1], _jd[2], _jd[3]) ;
+                else
+                return inball3w_sos(
+                    _qq[0], _qq[1], _qq[2], _qq[3],
+                    _qq[4],
+                    _jd[0], _jd[1], _jd[2], _jd[3],
+                    _jd[4]) ;
+            } ;
+
+            double _rr = _eval(0, 0) ;
+
+            int_type _rx = inball_sos_i(
+                _nd, _kk, _ww, _rk) ;
+
+            if (_rx != 0)
+            {
+                _nall[_it] += 1 ;
+                _nbad[2 * _it + 0] += _rr == 0. ||
+                    (_rr > 0. ? +1 : -1) != _rx ;
+            }
+
+            _nbad[2 * _it + 1] += _rr == 0. ||
+                (_rr > 0.) == (_eval(0, 1) > 0.) ||
+                (_rr > 0.) == (_eval(1, _np - 1) > 0.) ;
+        }
+
+        report("inball2d_sos lift series", _nbad[0], _nall[0]) ;
+        report("inball2d_sos antisymmetry", _nbad[1], _nn) ;
+        report("inball2w_sos lift series", _nbad[2], _nall[1]) ;
+        report("inball2w_sos antisymmetry", _nbad[3], _nn) ;
+        report("inball3w_sos lift series", _nbad[4], _nall[2]) ;
+        report("inball3w_sos antisymmetry", _nbad[5], _nn) ;
+    }
+
+int main () {
+
+    check_degenerate(+10000) ;
+
+    check_prepared_inball(+100000) ;
+
+    check_adapt_inball(+100000) ;
+
+    check_prepared_orient(+100000) ;
+
+    check_sos_inball(+10000) ;
+
+    check_sos_orient(+20000) ;
+
+    check_sos_lattice(+20000) ;
+
+    check_linear(+20000) ;
+
+    check_locate(+20000) ;
+
+    return _fail == 0 ? +0 : +1 ;
+}